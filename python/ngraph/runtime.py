@@ -15,7 +15,7 @@
 # ******************************************************************************
 """Provide a layer of abstraction for the ngraph++ runtime environment."""
 import logging
-from typing import List, Union
+from typing import List, Tuple, Union
 
 import numpy as np
 
@@ -82,26 +82,43 @@ class Computation(object):
             element_type = result.get_element_type()
             self.result_views.append(runtime.backend.create_tensor(element_type, shape))
 
+        # Backends keeping tensors in host memory run directly on the numpy arrays. The last
+        # array wrapped for each parameter and result is kept with its tensor for reuse.
+        self.zero_copy = Computation._is_host_tensor(self.result_views[0])
+        self.input_wrappers = [(None, None)] * len(self.parameters)  # type: List[Tuple]
+        self.output_wrappers = [(None, None)] * len(self.results)  # type: List[Tuple]
+
     def __repr__(self):  # type: () -> str
         params_string = ', '.join([param.name for param in self.parameters])
         return '<Computation: {}({})>'.format(self.function.get_name(), params_string)
 
-    def __call__(self, *input_values):  # type: (*NumericData) -> List[NumericData]
-        """Run computation on input values and return result."""
-        for tensor_view, value in zip(self.tensor_views, input_values):
-            if not isinstance(value, np.ndarray):
-                value = np.array(value)
-            Computation._write_ndarray_to_tensor_view(value, tensor_view)
-
-        self.runtime.backend.call(self.handle, self.result_views, self.tensor_views)
-
-        results = []
-        for result_view in self.result_views:
-            result = np.ndarray(result_view.shape, dtype=get_dtype(result_view.element_type))
-            Computation._read_tensor_view_to_ndarray(result_view, result)
-            results.append(result)
+    def __call__(self, *input_values, **kwargs):
+        # type: (*NumericData, **List[np.ndarray]) -> List[NumericData]
+        """Run computation on input values and return result.
 
-        return results
+        :param outputs: Optional arrays, one per result, to write the results into and return.
+                        Passing the same arrays on every call avoids allocating results. They
+                        must not be any of the input values.
+        """
+        outputs = kwargs.pop('outputs', None)
+        if kwargs:
+            raise TypeError('Unexpected keyword arguments: {}'.format(', '.join(kwargs)))
+        if outputs is None:
+            outputs = [np.ndarray(view.shape, dtype=get_dtype(view.element_type))
+                       for view in self.result_views]
+        elif len(outputs) != len(self.result_views):
+            raise UserInputError('Expected %d output arrays, got %d.',
+                                 len(self.result_views), len(outputs))
+
+        input_tensors = [self._bind_input(index, value) for index, value in enumerate(input_values)]
+        output_tensors = [self._bind_output(index, output) for index, output in enumerate(outputs)]
+
+        self.runtime.backend.call(self.handle, output_tensors, input_tensors)
+
+        for result_view, output_tensor, output in zip(self.result_views, output_tensors, outputs):
+            if output_tensor is result_view:
+                Computation._read_tensor_view_to_array(result_view, output)
+        return outputs
 
     def serialize(self, indent=0):  # type: (int) -> str
         """Serialize function (compute graph) to a JSON string.
@@ -111,6 +128,50 @@ class Computation(object):
         """
         return serialize(self.function, indent)
 
+    def _bind_input(self, index, value):  # type: (int, NumericData) -> Tensor
+        """Return a tensor holding value for parameter index."""
+        tensor_view = self.tensor_views[index]
+        if not isinstance(value, np.ndarray):
+            value = np.array(value)
+        if self._can_wrap(value, tensor_view):
+            return self._wrap(self.input_wrappers, index, value, tensor_view)
+        Computation._write_ndarray_to_tensor_view(value, tensor_view)
+        return tensor_view
+
+    def _bind_output(self, index, output):  # type: (int, np.ndarray) -> Tensor
+        """Return the tensor to write result index to, before it is read into output."""
+        result_view = self.result_views[index]
+        if list(output.shape) != list(result_view.shape):
+            raise UserInputError('Provided output\'s shape: %s does not match the expected: %s.',
+                                 list(output.shape), list(result_view.shape))
+        if self._can_wrap(output, result_view):
+            return self._wrap(self.output_wrappers, index, output, result_view)
+        return result_view
+
+    def _can_wrap(self, value, tensor_view):  # type: (np.ndarray, Tensor) -> bool
+        """Return True if the tensor can use the memory of value instead of a copy."""
+        return (self.zero_copy
+                and value.dtype == get_dtype(tensor_view.element_type)
+                and list(value.shape) == list(tensor_view.shape)
+                and value.flags.c_contiguous and value.flags.writeable)
+
+    def _wrap(self, wrappers, index, array, tensor_view):
+        # type: (List[Tuple], int, np.ndarray, Tensor) -> Tensor
+        """Return a tensor wrapping array, reusing the previous one if array is unchanged."""
+        wrapped_array, tensor = wrappers[index]
+        if wrapped_array is not array:
+            tensor = self.runtime.backend.create_tensor(tensor_view.element_type,
+                                                        tensor_view.shape, array)
+            wrappers[index] = (array, tensor)
+        return tensor
+
+    @staticmethod
+    def _is_host_tensor(tensor_view):  # type: (Tensor) -> bool
+        try:
+            return tensor_view.data is not None
+        except RuntimeError:
+            return False
+
     @staticmethod
     def _get_buffer_size(element_type, element_count):  # type: (Tensor, int) -> int
         return int((element_type.bitwidth / 8.0) * element_count)
@@ -141,3 +202,14 @@ class Computation(object):
         buffer_size = Computation._get_buffer_size(
             tensor_view.element_type, tensor_view.element_count)
         tensor_view.read(util.numpy_to_c(output), 0, buffer_size)
+
+    @staticmethod
+    def _read_tensor_view_to_array(tensor_view, output):
+        # type: (Tensor, np.ndarray) -> None
+        dtype = get_dtype(tensor_view.element_type)
+        if output.flags.c_contiguous and output.dtype == dtype:
+            Computation._read_tensor_view_to_ndarray(tensor_view, output)
+        else:
+            result = np.ndarray(tensor_view.shape, dtype=dtype)
+            Computation._read_tensor_view_to_ndarray(tensor_view, result)
+            np.copyto(output, result, casting='unsafe')
@@ -27,7 +27,10 @@ void regclass_pyngraph_passes_Manager(py::module m)
 {
     py::class_<ngraph::pass::Manager, std::shared_ptr<ngraph::pass::Manager>> manager(m, "Manager");
     manager.doc() = "ngraph.impl.pass.Manager wraps ngraph::pass::Manager";
-    manager.def("run_passes", &ngraph::pass::Manager::run_passes);
+    manager.def("run_passes",
+                [](ngraph::pass::Manager& self,
+                   std::shared_ptr<ngraph::Function> function,
+                   bool transitive) { self.run_passes(function, transitive); });
     manager.def("register_pass",
                 &ngraph::pass::Manager::register_pass<ngraph::pass::ReshapeElimination>);
 }
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
@@ -34,6 +35,25 @@ void regclass_pyngraph_runtime_Backend(py::module m)
                 (std::shared_ptr<ngraph::runtime::Tensor>(ngraph::runtime::Backend::*)(
                     const ngraph::element::Type&, const ngraph::Shape&)) &
                     ngraph::runtime::Backend::create_tensor);
+    // Wraps a caller-owned array without copying it, the array is kept alive by the tensor
+    backend.def("create_tensor",
+                [](ngraph::runtime::Backend& self,
+                   const ngraph::element::Type& element_type,
+                   const ngraph::Shape& shape,
+                   py::array array) {
+                    if (!(array.flags() & py::array::c_style))
+                    {
+                        throw std::invalid_argument("Array must be C-contiguous");
+                    }
+                    if (array.itemsize() != element_type.size() ||
+                        static_cast<size_t>(array.size()) != ngraph::shape_size(shape))
+                    {
+                        throw std::invalid_argument(
+                            "Array does not match the tensor type and shape");
+                    }
+                    return self.create_tensor(element_type, shape, array.mutable_data());
+                },
+                py::keep_alive<0, 4>());
     backend.def("compile",
                 (std::shared_ptr<ngraph::Function>(ngraph::runtime::Backend::*)(
                     std::shared_ptr<ngraph::Function>)) &
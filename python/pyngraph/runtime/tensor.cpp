@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
@@ -23,6 +24,55 @@
 
 namespace py = pybind11;
 
+static py::dtype get_numpy_dtype(const ngraph::element::Type& type)
+{
+    if (type == ngraph::element::boolean)
+    {
+        return py::dtype::of<bool>();
+    }
+    else if (type == ngraph::element::f32)
+    {
+        return py::dtype::of<float>();
+    }
+    else if (type == ngraph::element::f64)
+    {
+        return py::dtype::of<double>();
+    }
+    else if (type == ngraph::element::i8)
+    {
+        return py::dtype::of<int8_t>();
+    }
+    else if (type == ngraph::element::i16)
+    {
+        return py::dtype::of<int16_t>();
+    }
+    else if (type == ngraph::element::i32)
+    {
+        return py::dtype::of<int32_t>();
+    }
+    else if (type == ngraph::element::i64)
+    {
+        return py::dtype::of<int64_t>();
+    }
+    else if (type == ngraph::element::u8)
+    {
+        return py::dtype::of<uint8_t>();
+    }
+    else if (type == ngraph::element::u16)
+    {
+        return py::dtype::of<uint16_t>();
+    }
+    else if (type == ngraph::element::u32)
+    {
+        return py::dtype::of<uint32_t>();
+    }
+    else if (type == ngraph::element::u64)
+    {
+        return py::dtype::of<uint64_t>();
+    }
+    throw std::runtime_error("No numpy dtype for element type " + type.c_type_string());
+}
+
 void regclass_pyngraph_runtime_Tensor(py::module m)
 {
     py::class_<ngraph::runtime::Tensor, std::shared_ptr<ngraph::runtime::Tensor>> tensor(m,
@@ -32,6 +82,18 @@ void regclass_pyngraph_runtime_Tensor(py::module m)
                (void (ngraph::runtime::Tensor::*)(const void*, size_t, size_t)) &
                    ngraph::runtime::Tensor::write);
     tensor.def("read", &ngraph::runtime::Tensor::read);
+    // A numpy array viewing the tensor memory and keeping the tensor alive. It provides the
+    // buffer protocol, pybind11's own buffer hook can't raise for tensors off the host.
+    tensor.def_property_readonly("data", [](py::object self) {
+        auto& tensor = self.cast<ngraph::runtime::Tensor&>();
+        void* data = tensor.get_host_data_ptr();
+        if (data == nullptr)
+        {
+            throw std::runtime_error("Tensor memory is not accessible from the host");
+        }
+        std::vector<size_t> shape(tensor.get_shape().begin(), tensor.get_shape().end());
+        return py::array(get_numpy_dtype(tensor.get_element_type()), shape, data, self);
+    });
 
     tensor.def_property_readonly("shape", &ngraph::runtime::Tensor::get_shape);
     tensor.def_property_readonly("element_count", &ngraph::runtime::Tensor::get_element_count);
@@ -19,8 +19,9 @@ import json
 
 import ngraph as ng
 from test.ngraph.util import get_runtime, run_op_node
-from ngraph.impl import Function, NodeVector
+from ngraph.impl import Function, NodeVector, Shape
 from ngraph.exceptions import UserInputError
+from ngraph.utils.types import get_element_type
 
 
 @pytest.mark.parametrize('dtype', [np.float32, np.float64,
@@ -227,3 +228,40 @@ def test_constant_get_data_unsigned_integer(data_type):
     node = ng.constant(input_data, dtype=data_type)
     retrieved_data = node.get_data()
     assert np.allclose(input_data, retrieved_data)
+
+
+@pytest.config.gpu_skip(reason='Tensors are not held in host memory')
+def test_computation_reuses_output_arrays():
+    runtime = get_runtime()
+    shape = [2, 2]
+    parameter_a = ng.parameter(shape, dtype=np.float32, name='A')
+    parameter_b = ng.parameter(shape, dtype=np.float32, name='B')
+    computation = runtime.computation(parameter_a * parameter_b, parameter_a, parameter_b)
+
+    value_a = np.array([[1, 2], [3, 4]], dtype=np.float32)
+    value_b = np.array([[5, 6], [7, 8]], dtype=np.float32)
+    output = np.empty(shape, dtype=np.float32)
+    result = computation(value_a, value_b, outputs=[output])
+    assert result[0] is output
+    assert np.allclose(output, value_a * value_b)
+
+    # Inputs modified in place are picked up by the next call
+    value_a += 1
+    computation(value_a, value_b, outputs=[output])
+    assert np.allclose(output, value_a * value_b)
+
+    with pytest.raises(UserInputError):
+        computation(value_a, value_b, outputs=[np.empty([4], dtype=np.float32)])
+
+
+@pytest.config.gpu_skip(reason='Tensors are not held in host memory')
+def test_tensor_wraps_numpy_array():
+    runtime = get_runtime()
+    array = np.arange(6, dtype=np.float32).reshape(2, 3)
+    tensor = runtime.backend.create_tensor(get_element_type(np.float32), Shape([2, 3]), array)
+
+    view = tensor.data
+    assert np.shares_memory(view, array)
+    view[0, 0] = 10
+    assert array[0, 0] == 10
+    assert memoryview(view).shape == (2, 3)
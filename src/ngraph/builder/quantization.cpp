@@ -350,5 +350,64 @@ namespace ngraph
                                                                       sum_scale,
                                                                       with_relu);
         }
+
+        std::shared_ptr<Node> ScaledQuantizedDot(std::shared_ptr<Node> input,
+                                                 std::shared_ptr<Node> weights,
+                                                 std::shared_ptr<Node> min_input,
+                                                 std::shared_ptr<Node> max_input,
+                                                 std::shared_ptr<Node> min_weights,
+                                                 std::shared_ptr<Node> max_weights,
+                                                 std::shared_ptr<Node> min_freezed_output,
+                                                 std::shared_ptr<Node> max_freezed_output,
+                                                 const bool with_relu)
+        {
+            auto output_et = with_relu ? element::u8 : element::i8;
+            auto requantization_scale = quantization_util::get_scale(min_input,
+                                                                     max_input,
+                                                                     min_weights,
+                                                                     max_weights,
+                                                                     min_freezed_output,
+                                                                     max_freezed_output,
+                                                                     output_et);
+
+            return make_shared<op::QuantizedDot>(
+                input, weights, requantization_scale, true, with_relu);
+        }
+
+        std::shared_ptr<Node> ScaledQuantizedDotBias(std::shared_ptr<Node> input,
+                                                     std::shared_ptr<Node> weights,
+                                                     std::shared_ptr<Node> bias,
+                                                     std::shared_ptr<Node> min_input,
+                                                     std::shared_ptr<Node> max_input,
+                                                     std::shared_ptr<Node> min_weights,
+                                                     std::shared_ptr<Node> max_weights,
+                                                     std::shared_ptr<Node> min_freezed_output,
+                                                     std::shared_ptr<Node> max_freezed_output,
+                                                     const bool with_relu)
+        {
+            auto output_et = with_relu ? element::u8 : element::i8;
+            auto requantization_scale = quantization_util::get_scale(min_input,
+                                                                     max_input,
+                                                                     min_weights,
+                                                                     max_weights,
+                                                                     min_freezed_output,
+                                                                     max_freezed_output,
+                                                                     output_et);
+
+            if (bias->get_element_type() != element::i32)
+            {
+                auto zero = make_constant(element::i32, min_input->get_shape(), 0);
+                AxisSet quantization_axes;
+                auto bias_scale = quantization_util::get_bias_scale(
+                    min_input, max_input, min_weights, max_weights);
+                op::Quantize::RoundMode round_mode =
+                    op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN;
+
+                bias = make_shared<op::Quantize>(
+                    bias, bias_scale, zero, element::i32, quantization_axes, round_mode);
+            }
+            return make_shared<op::QuantizedDotBias>(
+                input, weights, bias, requantization_scale, true, with_relu);
+        }
     }
 }
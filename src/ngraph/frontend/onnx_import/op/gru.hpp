@@ -16,26 +16,23 @@
 
 #pragma once
 
-#include <cstddef>
-#include <cstring>
+#include "core/node.hpp"
+#include "ngraph/node_vector.hpp"
 
 namespace ngraph
 {
-    namespace runtime
+    namespace onnx_import
     {
-        namespace cpu
+        namespace op
         {
-            namespace kernel
+            namespace set_1
             {
-                template <typename ElementType>
-                void result(const void* arg, void* out, size_t count, int arena)
-                {
-                    if (arg != out)
-                    {
-                        memcpy(out, arg, sizeof(ElementType) * count);
-                    }
-                }
-            }
-        }
-    }
-}
+                NodeVector gru(const Node& node);
+
+            } // namespace set_1
+
+        } //namespace op
+
+    } // namespace onnx_import
+
+} // namespace ngraph
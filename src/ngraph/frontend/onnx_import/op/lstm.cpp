@@ -14,25 +14,32 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <iterator>
-#include <map>
+#include <limits>
 #include <memory>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include "exceptions.hpp"
 #include "lstm.hpp"
+#include "ngraph/coordinate.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/concat.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
 #include "ngraph/op/dot.hpp"
+#include "ngraph/op/equal.hpp"
+#include "ngraph/op/greater.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/reshape.hpp"
+#include "ngraph/op/select.hpp"
 #include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/slice.hpp"
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
@@ -62,145 +69,175 @@ namespace ngraph
                     return {std::make_shared<ngraph::op::Multiply>(args.at(0), args.at(1))};
                 }
 
-                // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~ ACTIVATION FUNCTIONS ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-
-                std::shared_ptr<ngraph::Node> sigmoid(const std::shared_ptr<ngraph::Node>& arg)
+                std::shared_ptr<ngraph::Node> add_bias(const std::shared_ptr<ngraph::Node>& node,
+                                                       const std::shared_ptr<ngraph::Node>& bias)
                 {
-                    return std::make_shared<ngraph::op::Sigmoid>(arg);
+                    return std::make_shared<ngraph::op::Add>(
+                        node,
+                        std::make_shared<ngraph::op::Broadcast>(
+                            bias, node->get_shape(), AxisSet{0}));
                 }
 
-                std::shared_ptr<ngraph::Node> tanh(const std::shared_ptr<ngraph::Node>& arg)
+                // Slices gate `index` out of gates concatenated along the last axis.
+                std::shared_ptr<ngraph::Node> gate(const std::shared_ptr<ngraph::Node>& gates,
+                                                   std::size_t index,
+                                                   std::size_t hidden_size)
                 {
-                    return std::make_shared<ngraph::op::Tanh>(arg);
+                    return std::make_shared<ngraph::op::Slice>(
+                        gates,
+                        Coordinate{0, index * hidden_size},
+                        Coordinate{gates->get_shape().at(0), (index + 1) * hidden_size});
                 }
 
                 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~ INPUT NODES PARSING ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
-                enum class LSTMInput
+                // We have input, output, forget and cell gates
+                constexpr std::size_t gates_count{4};
+
+                // ONNX concatenates the gates in [iofc] order. They are reordered to [ifco], the
+                // order of the LSTM kernel of the CPU backend, which fuses the cells built below.
+                // The ONNX index of each gate in [ifco] order:
+                constexpr std::size_t onnx_gate_index[gates_count]{0, 2, 3, 1};
+
+                /// \brief Returns the `group`-th block of four gates of `direction` of `node`.
+                ///
+                /// \param node    A tensor of shape [num_directions, groups * 4 * hidden_size, ...]
+                /// \param groups  The number of blocks of gates, 2 for the biases and 1 otherwise.
+                ///
+                /// \return The block of shape [4 * hidden_size, ...] with the gates in [ifco]
+                ///         order. Constants are reordered here, so that weights stay constants.
+                std::shared_ptr<ngraph::Node> direction_gates(
+                    const std::shared_ptr<ngraph::Node>& node,
+                    std::size_t direction,
+                    std::size_t groups,
+                    std::size_t group)
                 {
-                    LSTM_INPUT_X,
-                    LSTM_INPUT_W,
-                    LSTM_INPUT_R,
-                    LSTM_INPUT_B,
-                    LSTM_INPUT_SEQ_LENGTHS,
-                    LSTM_INPUT_INIT_H,
-                    LSTM_INPUT_INIT_C,
-                    LSTM_INPUT_P
-                };
+                    const Shape& shape = node->get_shape();
+                    const std::size_t gate_rows = shape.at(1) / (groups * gates_count);
+                    Shape gates_shape(std::next(std::begin(shape)), std::end(shape));
+                    gates_shape.at(0) = gates_count * gate_rows;
 
-                std::string to_str(const LSTMInput& in)
-                {
-                    switch (in)
+                    auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(node);
+                    if (constant && constant->get_element_type() == element::f32)
+                    {
+                        const auto values = constant->get_vector<float>();
+                        const std::size_t gate_size = shape_size(gates_shape) / gates_count;
+                        auto first = std::begin(values) +
+                                     (direction * groups + group) * gates_count * gate_size;
+                        std::vector<float> gates;
+                        gates.reserve(shape_size(gates_shape));
+                        for (std::size_t index : onnx_gate_index)
+                        {
+                            gates.insert(std::end(gates),
+                                         first + index * gate_size,
+                                         first + (index + 1) * gate_size);
+                        }
+                        return std::make_shared<ngraph::op::Constant>(
+                            element::f32, gates_shape, gates);
+                    }
+
+                    NodeVector gates;
+                    for (std::size_t index : onnx_gate_index)
                     {
-                    case LSTMInput::LSTM_INPUT_X: return "X";
-                    case LSTMInput::LSTM_INPUT_W: return "W";
-                    case LSTMInput::LSTM_INPUT_R: return "R";
-                    case LSTMInput::LSTM_INPUT_B: return "B";
-                    case LSTMInput::LSTM_INPUT_SEQ_LENGTHS: return "sequence_lens";
-                    case LSTMInput::LSTM_INPUT_INIT_H: return "initial_h";
-                    case LSTMInput::LSTM_INPUT_INIT_C: return "initial_c";
-                    case LSTMInput::LSTM_INPUT_P: return "P";
-                    default: return "Unrecognized input value!";
+                        Coordinate lower(shape.size(), 0);
+                        Coordinate upper(shape);
+                        lower.at(0) = direction;
+                        upper.at(0) = direction + 1;
+                        lower.at(1) = (group * gates_count + index) * gate_rows;
+                        upper.at(1) = lower.at(1) + gate_rows;
+                        gates.push_back(std::make_shared<ngraph::op::Slice>(node, lower, upper));
                     }
+                    return std::make_shared<ngraph::op::Reshape>(
+                        std::make_shared<ngraph::op::Concat>(gates, 1),
+                        reshape::get_default_axis_vector(shape.size()),
+                        gates_shape);
                 }
 
-                struct LSTMNgInputMap
+                /// \brief Returns `direction` of `node`, a tensor of shape [num_directions, ...],
+                ///        with the direction axis removed.
+                std::shared_ptr<ngraph::Node>
+                    direction_input(const std::shared_ptr<ngraph::Node>& node,
+                                    std::size_t direction)
                 {
-                    using container_type = std::map<LSTMInput, std::shared_ptr<ngraph::Node>>;
-                    using iterator = typename container_type::iterator;
+                    const Shape& shape = node->get_shape();
+                    Coordinate lower(shape.size(), 0);
+                    Coordinate upper(shape);
+                    lower.at(0) = direction;
+                    upper.at(0) = direction + 1;
+                    return std::make_shared<ngraph::op::Reshape>(
+                        std::make_shared<ngraph::op::Slice>(node, lower, upper),
+                        reshape::get_default_axis_vector(shape.size()),
+                        Shape(std::next(std::begin(shape)), std::end(shape)));
+                }
 
-                    explicit LSTMNgInputMap(const Node& node)
+                bool is_zero_constant(const std::shared_ptr<ngraph::Node>& node)
+                {
+                    auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(node);
+                    if (!constant || constant->get_element_type() != element::f32)
                     {
-                        const auto& ng_inputs = node.get_ng_inputs();
-                        // We have input, output, forget and cell gates
-                        constexpr std::size_t gates_count{4};
-                        // Peepholes add additional connections to input, output and forget gates.
-                        constexpr std::size_t peepholes_count{3};
-
-                        // ----- Mandatory inputs ------
-                        // Packed input sequences. Shape: [seq_length, batch_size, input_size]
-                        m_map[LSTMInput::LSTM_INPUT_X] = ng_inputs.at(0);
-                        // Weight tensor for the gates. Shape: [num_directions, 4*hidden_size, input_size]
-                        m_map[LSTMInput::LSTM_INPUT_W] = ng_inputs.at(1);
-                        // The recurrence weight tensor. Shape: [num_directions, 4*hidden_size, hidden_size]
-                        m_map[LSTMInput::LSTM_INPUT_R] = ng_inputs.at(2);
-
-                        const std::size_t hidden_size =
-                            m_map[LSTMInput::LSTM_INPUT_R]->get_shape().back();
-                        const std::size_t batch_size =
-                            m_map[LSTMInput::LSTM_INPUT_X]->get_shape().at(1);
-                        const std::size_t num_directions =
-                            m_map[LSTMInput::LSTM_INPUT_W]->get_shape().front();
-
-                        // ------ Optional inputs ------
-                        // The bias tensor for input gate. Shape [num_directions, 8*hidden_size]
-                        if (ng_inputs.size() >= 4)
-                        {
-                            m_map[LSTMInput::LSTM_INPUT_B] = ng_inputs.at(3);
-                        }
-                        else
-                        {
-                            m_map[LSTMInput::LSTM_INPUT_B] = common::make_constant_node<float>(
-                                element::f32,
-                                {num_directions, 2 * gates_count * hidden_size},
-                                {0.f});
-                        }
-                        // The lengths of the sequences in a batch. Shape [batch_size]
-                        if (ng_inputs.size() >= 5)
-                        {
-                            m_map[LSTMInput::LSTM_INPUT_SEQ_LENGTHS] = ng_inputs.at(4);
-                        }
-                        else
-                        {
-                            m_map[LSTMInput::LSTM_INPUT_SEQ_LENGTHS] =
-                                common::make_constant_node<std::int32_t>(
-                                    element::i32,
-                                    {batch_size},
-                                    {static_cast<std::int32_t>(
-                                        m_map[LSTMInput::LSTM_INPUT_X]->get_shape().at(0))});
-                        }
-                        // The initial value of the hidden. Shape [num_directions, batch_size, hidden_size]
-                        if (ng_inputs.size() >= 6)
-                        {
-                            m_map[LSTMInput::LSTM_INPUT_INIT_H] = ng_inputs.at(5);
-                        }
-                        else
-                        {
-                            m_map[LSTMInput::LSTM_INPUT_INIT_H] = common::make_constant_node<float>(
-                                element::f32, {num_directions, batch_size, hidden_size}, {0.f});
-                        }
-                        // The initial value of the cell. Shape [num_directions, batch_size, hidden_size]
-                        if (ng_inputs.size() >= 7)
-                        {
-                            m_map[LSTMInput::LSTM_INPUT_INIT_C] = ng_inputs.at(6);
-                        }
-                        else
-                        {
-                            m_map[LSTMInput::LSTM_INPUT_INIT_C] = common::make_constant_node<float>(
-                                element::f32, {num_directions, batch_size, hidden_size}, {0.f});
-                        }
-                        // The weight tensor for peepholes. Shape [num_directions, 3*hidde_size]
-                        if (ng_inputs.size() >= 8)
-                        {
-                            m_map[LSTMInput::LSTM_INPUT_P] = ng_inputs.at(7);
-                        }
-                        else
+                        return false;
+                    }
+                    for (float value : constant->get_vector<float>())
+                    {
+                        if (value != 0.f)
                         {
-                            m_map[LSTMInput::LSTM_INPUT_P] = common::make_constant_node<float>(
-                                element::f32,
-                                {num_directions, peepholes_count * hidden_size},
-                                {0.f});
+                            return false;
                         }
                     }
+                    return true;
+                }
+
+                /// \brief Returns `Compare(sequence_lens, step)` broadcast to `shape`, a boolean
+                ///        tensor of shape [batch_size, hidden_size].
+                template <typename Compare>
+                std::shared_ptr<ngraph::Node>
+                    compare_lengths(const std::shared_ptr<ngraph::Node>& sequence_lens,
+                                    std::size_t step,
+                                    const Shape& shape)
+                {
+                    return std::make_shared<Compare>(
+                        std::make_shared<ngraph::op::Broadcast>(sequence_lens, shape, AxisSet{1}),
+                        common::make_constant_node<std::int32_t>(
+                            element::i32, shape, {static_cast<std::int32_t>(step)}));
+                }
+
+                /// \brief Returns `Compare(sequence_lens, step)` as a mask of zeros and ones.
+                template <typename Compare>
+                std::shared_ptr<ngraph::Node>
+                    lengths_mask(const std::shared_ptr<ngraph::Node>& sequence_lens,
+                                 std::size_t step,
+                                 const Shape& shape)
+                {
+                    return std::make_shared<ngraph::op::Convert>(
+                        compare_lengths<Compare>(sequence_lens, step, shape), element::f32);
+                }
 
-                    std::shared_ptr<ngraph::Node>& at(const LSTMInput& key)
+                /// \brief Returns the state of each sequence at its last step, out of the states
+                ///        `states` of all timesteps.
+                std::shared_ptr<ngraph::Node>
+                    last_steps(const NodeVector& states,
+                               const std::shared_ptr<ngraph::Node>& sequence_lens)
+                {
+                    const Shape& shape = states.front()->get_shape();
+                    std::shared_ptr<ngraph::Node> last;
+                    for (std::size_t t = 0; t < states.size(); ++t)
                     {
-                        return m_map.at(key);
+                        auto state =
+                            states.at(t) *
+                            lengths_mask<ngraph::op::Equal>(sequence_lens, t + 1, shape);
+                        last = last ? last + state : state;
                     }
-                    iterator begin() { return m_map.begin(); }
-                    iterator end() { return m_map.end(); }
-                    container_type m_map;
-                };
+                    return last;
+                }
+
+                std::shared_ptr<ngraph::Node> concat(const NodeVector& nodes, std::size_t axis)
+                {
+                    if (nodes.size() == 1)
+                    {
+                        return nodes.front();
+                    }
+                    return std::make_shared<ngraph::op::Concat>(nodes, axis);
+                }
 
                 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~ ATTRIBUTES PARSING ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
@@ -214,14 +251,68 @@ namespace ngraph
                 struct LSTMAttributes
                 {
                     explicit LSTMAttributes(const Node& node)
-                        : m_direction{LSTMDirection::LSTM_DIRECTION_FORWARD}
-                        , m_hidden_size{node.get_attribute_value<std::int64_t>("hidden_size")}
+                        : m_hidden_size{static_cast<std::size_t>(
+                              node.get_attribute_value<std::int64_t>("hidden_size"))}
                     {
+                        const auto direction =
+                            node.get_attribute_value<std::string>("direction", "forward");
+                        if (direction == "forward")
+                        {
+                            m_direction = LSTMDirection::LSTM_DIRECTION_FORWARD;
+                        }
+                        else if (direction == "reverse")
+                        {
+                            m_direction = LSTMDirection::LSTM_DIRECTION_REVERSE;
+                        }
+                        else
+                        {
+                            ASSERT_VALID_ARGUMENT(node, direction == "bidirectional")
+                                << "invalid direction '" << direction << "'";
+                            m_direction = LSTMDirection::LSTM_DIRECTION_BIDIRECTIONAL;
+                        }
+
+                        const std::vector<std::string> activations{"Sigmoid", "Tanh", "Tanh"};
+                        auto node_activations = node.get_attribute_value<std::vector<std::string>>(
+                            "activations", activations);
+                        ASSERT_IS_SUPPORTED(
+                            node,
+                            node_activations == activations ||
+                                (m_direction == LSTMDirection::LSTM_DIRECTION_BIDIRECTIONAL &&
+                                 node_activations ==
+                                     std::vector<std::string>{
+                                         "Sigmoid", "Tanh", "Tanh", "Sigmoid", "Tanh", "Tanh"}))
+                            << "only the 'Sigmoid', 'Tanh' and 'Tanh' activations are supported";
+                        ASSERT_IS_SUPPORTED(
+                            node,
+                            node.get_attribute_value<std::vector<float>>("activation_alpha", {})
+                                    .empty() &&
+                                node.get_attribute_value<std::vector<float>>("activation_beta",
+                                                                             {})
+                                    .empty())
+                            << "activation_alpha and activation_beta are not supported";
+                        ASSERT_IS_SUPPORTED(node,
+                                            std::isinf(node.get_attribute_value<float>(
+                                                "clip", std::numeric_limits<float>::infinity())))
+                            << "clip is not supported";
+                        ASSERT_IS_SUPPORTED(
+                            node, node.get_attribute_value<std::int64_t>("input_forget", 0) == 0)
+                            << "input_forget is not supported";
+                    }
+
+                    std::size_t get_num_directions() const
+                    {
+                        return m_direction == LSTMDirection::LSTM_DIRECTION_BIDIRECTIONAL ? 2 : 1;
+                    }
+
+                    // The second direction of a bidirectional LSTM runs in reverse
+                    bool is_reverse(std::size_t direction) const
+                    {
+                        return m_direction == LSTMDirection::LSTM_DIRECTION_REVERSE ||
+                               direction == 1;
                     }
 
-                    // Currently only LSTM_DIRECTION_FORWARD is supported.
                     LSTMDirection m_direction;
-                    std::int64_t m_hidden_size;
+                    std::size_t m_hidden_size;
                 };
 
             } // anonymous namespace
@@ -230,35 +321,61 @@ namespace ngraph
             {
                 NodeVector lstm(const Node& node)
                 {
-                    LSTMNgInputMap input_map{node};
-                    LSTMAttributes attributes{node};
+                    const NodeVector ng_inputs{node.get_ng_inputs()};
+                    const LSTMAttributes attributes{node};
+                    const std::size_t hidden_size = attributes.m_hidden_size;
+                    const std::size_t num_directions = attributes.get_num_directions();
 
-                    if (attributes.m_direction == LSTMDirection::LSTM_DIRECTION_FORWARD)
-                    {
-                        // Since we have forward LSTM we can squeeze `num_directions` axis from inputs.
-                        for (auto& ng_in : input_map)
-                        {
-                            if (ng_in.first != LSTMInput::LSTM_INPUT_X &&
-                                ng_in.first != LSTMInput::LSTM_INPUT_SEQ_LENGTHS)
-                            {
-                                ASSERT_VALID_ARGUMENT(node, ng_in.second->get_shape().at(0) == 1)
-                                    << "Input: { " << to_str(ng_in.first)
-                                    << " } first axis has size different "
-                                       "from 1, while direction attribute set to 'forward'.";
-                                ng_in.second = reshape::squeeze(ng_in.second);
-                            }
-                        }
-                    }
-
-                    // ------ VARIABLE'S NAMES AND ACRONYM DEFINITIONS ------
-                    // The names used below are analogous to the one used in ONNX documentation.
-                    //
                     // ------ INPUTS ------
                     // X - The input tensor. [seq_length, batch_size, input_size]
                     // W - The weight tensor. [num_directions, 4*hidden_size, input_size]
-                    // R - The recurrence weight tensor. [num_directions, 4*hidden_size, hidden_size]
+                    // R - The recurrence weight tensor.
+                    //     [num_directions, 4*hidden_size, hidden_size]
                     // B - The bias tensor for input gate. [num_directions, 8*hidden_size]
-                    // P - The weight tensor forr peepholes. [num_directions, 3*hidde_size]
+                    // sequence_lens - The lengths of the sequences in a batch. [batch_size]
+                    // initial_h - The initial value of the hidden.
+                    //             [num_directions, batch_size, hidden_size]
+                    // initial_c - The initial value of the cell.
+                    //             [num_directions, batch_size, hidden_size]
+                    // P - The weight tensor for peepholes. [num_directions, 3*hidden_size]
+                    const auto& X = ng_inputs.at(0);
+                    const auto& W = ng_inputs.at(1);
+                    const auto& R = ng_inputs.at(2);
+                    const std::size_t seq_length = X->get_shape().at(0);
+                    const std::size_t batch_size = X->get_shape().at(1);
+                    const std::size_t input_size = X->get_shape().at(2);
+                    ASSERT_VALID_ARGUMENT(node,
+                                          W->get_shape().at(0) == num_directions &&
+                                              R->get_shape().at(0) == num_directions)
+                        << "Inputs: { W, R } first axis has size different from the number of "
+                           "directions.";
+                    auto input = [&](std::size_t index) -> std::shared_ptr<ngraph::Node> {
+                        return index < ng_inputs.size() ? ng_inputs.at(index) : nullptr;
+                    };
+
+                    std::shared_ptr<ngraph::Node> B =
+                        input(3) ? input(3)
+                                 : common::make_constant_node<float>(
+                                       element::f32,
+                                       {num_directions, 2 * gates_count * hidden_size},
+                                       {0.f});
+                    // Sequences that all have the full length need no masking
+                    std::shared_ptr<ngraph::Node> sequence_lens = input(4);
+                    if (sequence_lens &&
+                        common::has_full_sequence_lengths(sequence_lens, seq_length))
+                    {
+                        sequence_lens = nullptr;
+                    }
+                    ASSERT_VALID_ARGUMENT(
+                        node, !sequence_lens || sequence_lens->get_element_type() == element::i32)
+                        << "sequence_lens must be of type int32";
+                    // Peepholes that are all zero are left out, so that the cells can be fused
+                    std::shared_ptr<ngraph::Node> P = input(7);
+                    if (P && is_zero_constant(P))
+                    {
+                        P = nullptr;
+                    }
+
                     // ------ ACRONYMS ------
                     // i - input gate
                     // o - output gate
@@ -266,98 +383,167 @@ namespace ngraph
                     // c - cell gate
                     // t - time step (t-1 means previous time step)
                     // ------ VARIABLE NAMES ------
-                    // W       - W parameter weight matrix for input, output, forget, and
-                    //           cell gates.
-                    // R       - R recurrence weight matrix for input, output, forget, and
-                    //           cell gates.
-                    // Wb      - W bias vectors for input, output, forget, and cell gates.
-                    // Rb      - R bias vectors for input, output, forget, and cell gates.
-                    // b_W_R   - Bias vectors for input, output, forget, and cell gates.
-                    //           Concatenation of `[Wb, Rb]`.
+                    // W_ifco  - W parameter weight matrix for input, forget, cell and output
+                    //           gates, transposed.
+                    // R_ifco  - R recurrence weight matrix for input, forget, cell and output
+                    //           gates, transposed.
+                    // Wb, Rb  - W and R bias vectors for input, forget, cell and output gates.
                     // p_[iof] - P peephole weight vector for respectively: input, output,
                     //           and forget gates.
                     // H_t     - Hidden state vector at current time step.
                     // C_t     - Cell state vector at current time step.
-                    // h_list  - The list of hidden states at all processed time steps.
-                    //
-                    // Xt_W    - Input sequence multiplied by weights tensor at current time
-                    //           step.
-                    // Ht_R    - Hidden state multiplied by weights tensor at current time step.
-
-                    NodeVector p_iof = reshape::split(input_map.at(LSTMInput::LSTM_INPUT_P), 3);
-                    const auto& p_i = p_iof.at(0);
-                    const auto& p_o = p_iof.at(1);
-                    const auto& p_f = p_iof.at(2);
-                    std::shared_ptr<ngraph::Node> H_t{input_map.at(LSTMInput::LSTM_INPUT_INIT_H)};
-                    std::shared_ptr<ngraph::Node> C_t{input_map.at(LSTMInput::LSTM_INPUT_INIT_C)};
-                    NodeVector h_list;
-
-                    NodeVector b_W_R = reshape::split(input_map.at(LSTMInput::LSTM_INPUT_B), 2);
-                    std::shared_ptr<ngraph::Node> bias = b_W_R.at(0) + b_W_R.at(1);
-                    NodeVector in_seqs =
-                        reshape::split(input_map.at(LSTMInput::LSTM_INPUT_X),
-                                       input_map.at(LSTMInput::LSTM_INPUT_X)->get_shape().at(0));
+                    // h_list  - The hidden states of all timesteps, in timestep order.
+                    const Shape state_shape{batch_size, hidden_size};
+                    auto zero_state = [&]() -> std::shared_ptr<ngraph::Node> {
+                        return std::make_shared<ngraph::op::Broadcast>(
+                            common::make_constant_node<float>(element::f32, Shape{}, {0.f}),
+                            state_shape,
+                            AxisSet{0, 1});
+                    };
+
+                    NodeVector in_seqs = reshape::split(X, seq_length);
                     for (auto& in_x : in_seqs)
                     {
                         // remove first empty dim, after above split.
-                        in_x = reshape::squeeze(in_x);
+                        in_x = std::make_shared<ngraph::op::Reshape>(
+                            in_x, AxisVector{0, 1, 2}, Shape{batch_size, input_size});
                     }
 
-                    for (const auto& in_x : in_seqs)
+                    // Y, Y_h and Y_c are all optional outputs
+                    const std::size_t outputs_count = node.get_output_names().size();
+                    std::vector<NodeVector> h_lists;
+                    NodeVector Y_h;
+                    NodeVector Y_c;
+                    for (std::size_t direction = 0; direction < num_directions; ++direction)
                     {
-                        // (.) - Denotes element-wise multiplication.
-                        // *   - Denotes dot product.
-
-                        // Xt*(W^T) -- for [iofc] gates.
-                        auto Xt_W = std::make_shared<ngraph::op::Dot>(
-                            in_x, reshape::transpose(input_map.at(LSTMInput::LSTM_INPUT_W)));
-                        // Ht-1*(R^T)  -- for [iofc] gates.
-                        auto Ht_R = std::make_shared<ngraph::op::Dot>(
-                            H_t, reshape::transpose(input_map.at(LSTMInput::LSTM_INPUT_R)));
-                        // Xt*(W^T) + Ht-1*(R^T) + Wb + Rb  -- for [iofc] gates.
-                        auto gates = add(Xt_W, add(Ht_R, bias));
-
-                        NodeVector split_gates = reshape::split(gates, 4, -1);
-                        auto i = split_gates.at(0);
-                        auto o = split_gates.at(1);
-                        auto f = split_gates.at(2);
-                        auto c = split_gates.at(3);
-
-                        // f(Xt*(Wi^T) + Ht-1*(Ri^T) + Pi (.) Ct-1 + Wbi + Rbi)
-                        i = sigmoid(add(i, mul(p_i, C_t)));
-                        // f(Xt*(Wf^T) + Ht-1*(Rf^T) + Pf (.) Ct-1 + Wbf + Rbf)
-                        f = sigmoid(add(f, mul(p_f, C_t)));
-                        // ft (.) Ct-1 + it (.) ct
-                        auto C = add(mul(f, C_t), mul(i, tanh(c)));
-                        // f(Xt*(Wo^T) + Ht-1*(Ro^T) + Po (.) Ct + Wbo + Rbo)
-                        o = sigmoid(add(o, mul(p_o, C)));
-                        // ot (.) h(Ct)
-                        auto H = mul(o, tanh(C));
-                        h_list.push_back(H);
-                        H_t = H;
-                        C_t = C;
+                        auto W_ifco = reshape::transpose(direction_gates(W, direction, 1, 0));
+                        auto R_ifco = reshape::transpose(direction_gates(R, direction, 1, 0));
+                        auto Wb = direction_gates(B, direction, 2, 0);
+                        auto Rb = direction_gates(B, direction, 2, 1);
+                        std::shared_ptr<ngraph::Node> H_t =
+                            input(5) ? direction_input(input(5), direction) : zero_state();
+                        std::shared_ptr<ngraph::Node> C_t =
+                            input(6) ? direction_input(input(6), direction) : zero_state();
+                        NodeVector p_iof;
+                        if (P)
+                        {
+                            p_iof = reshape::split(direction_input(P, direction), 3);
+                        }
+
+                        const bool reverse = attributes.is_reverse(direction);
+                        NodeVector h_list(seq_length);
+                        NodeVector c_list(seq_length);
+                        for (std::size_t step = 0; step < seq_length; ++step)
+                        {
+                            const std::size_t t = reverse ? seq_length - 1 - step : step;
+                            // (.) - Denotes element-wise multiplication.
+                            // *   - Denotes dot product.
+
+                            // Ht-1*(R^T) + Rb + Xt*(W^T) + Wb -- for [ifco] gates.
+                            auto gates =
+                                add_bias(std::make_shared<ngraph::op::Dot>(H_t, R_ifco), Rb) +
+                                add_bias(std::make_shared<ngraph::op::Dot>(in_seqs.at(t), W_ifco),
+                                         Wb);
+                            auto i = gate(gates, 0, hidden_size);
+                            auto f = gate(gates, 1, hidden_size);
+                            auto c = gate(gates, 2, hidden_size);
+                            auto o = gate(gates, 3, hidden_size);
+                            if (P)
+                            {
+                                // Pi (.) Ct-1 and Pf (.) Ct-1
+                                i = add(i, mul(p_iof.at(0), C_t));
+                                f = add(f, mul(p_iof.at(2), C_t));
+                            }
+
+                            // f(Xt*(Wi^T) + Ht-1*(Ri^T) + Pi (.) Ct-1 + Wbi + Rbi)
+                            i = std::make_shared<ngraph::op::Sigmoid>(i);
+                            // f(Xt*(Wf^T) + Ht-1*(Rf^T) + Pf (.) Ct-1 + Wbf + Rbf)
+                            f = std::make_shared<ngraph::op::Sigmoid>(f);
+                            // ft (.) Ct-1 + it (.) ct
+                            std::shared_ptr<ngraph::Node> C =
+                                f * C_t + i * std::make_shared<ngraph::op::Tanh>(c);
+                            if (P)
+                            {
+                                // Po (.) Ct
+                                o = add(o, mul(p_iof.at(1), C));
+                            }
+                            // f(Xt*(Wo^T) + Ht-1*(Ro^T) + Po (.) Ct + Wbo + Rbo)
+                            o = std::make_shared<ngraph::op::Sigmoid>(o);
+                            // ot (.) h(Ct)
+                            std::shared_ptr<ngraph::Node> H =
+                                o * std::make_shared<ngraph::op::Tanh>(C);
+                            if (sequence_lens && reverse)
+                            {
+                                // Sequences read in reverse start at their own last step, until
+                                // then they keep the initial state
+                                auto started = compare_lengths<ngraph::op::Greater>(
+                                    sequence_lens, t, state_shape);
+                                H = std::make_shared<ngraph::op::Select>(started, H, H_t);
+                                C = std::make_shared<ngraph::op::Select>(started, C, C_t);
+                            }
+                            h_list.at(t) = H;
+                            c_list.at(t) = C;
+                            H_t = H;
+                            C_t = C;
+                        }
+
+                        if (sequence_lens && !reverse)
+                        {
+                            // The final states are those of the last step of each sequence
+                            if (outputs_count > 1)
+                            {
+                                H_t = last_steps(h_list, sequence_lens);
+                            }
+                            if (outputs_count > 2)
+                            {
+                                C_t = last_steps(c_list, sequence_lens);
+                            }
+                        }
+                        if (sequence_lens)
+                        {
+                            // The outputs past the end of a sequence are zero
+                            for (std::size_t t = 0; t < seq_length; ++t)
+                            {
+                                h_list.at(t) =
+                                    h_list.at(t) * lengths_mask<ngraph::op::Greater>(
+                                                       sequence_lens, t, state_shape);
+                            }
+                        }
+                        h_lists.push_back(h_list);
+                        if (outputs_count > 1)
+                        {
+                            Y_h.push_back(reshape::add_empty_axes(H_t));
+                        }
+                        if (outputs_count > 2)
+                        {
+                            Y_c.push_back(reshape::add_empty_axes(C_t));
+                        }
                     }
+
                     // The tensor that concats all the intermediate output values of the hidden.
-                    // It has shape [seq_length, batch_size, hidden_size]
+                    // It has shape [seq_length, num_directions, batch_size, hidden_size]
                     NodeVector exp_h_list;
-                    for (const auto& ht : h_list)
+                    for (std::size_t t = 0; t < seq_length; ++t)
+                    {
+                        // Expand tensors with empty outermost dims, so we can later concatenate
+                        // them.
+                        NodeVector directions;
+                        for (const auto& h_list : h_lists)
+                        {
+                            directions.push_back(reshape::add_empty_axes(h_list.at(t), 2));
+                        }
+                        exp_h_list.push_back(concat(directions, 1));
+                    }
+                    NodeVector outputs{std::make_shared<ngraph::op::Concat>(exp_h_list, 0)};
+                    if (outputs_count > 1)
                     {
-                        // Expand tensors with empty outermost dim, so we can later concatenate them.
-                        exp_h_list.push_back(reshape::add_empty_axes(ht));
+                        outputs.push_back(concat(Y_h, 0));
                     }
-                    std::shared_ptr<ngraph::Node> Y{
-                        std::make_shared<ngraph::op::Concat>(exp_h_list, 0)};
-
-                    // Expand Y so that it has expected shape:
-                    // [seq_length, num_directions, batch_size, hidden_size]
-                    if (attributes.m_direction == LSTMDirection::LSTM_DIRECTION_FORWARD)
+                    if (outputs_count > 2)
                     {
-                        Shape shape{Y->get_shape()};
-                        shape.insert(std::next(std::begin(shape)), 1);
-                        Y = std::make_shared<ngraph::op::Reshape>(
-                            Y, reshape::get_default_axis_vector(Y->get_shape().size()), shape);
+                        outputs.push_back(concat(Y_c, 0));
                     }
-                    return {Y, exp_h_list.back()};
+                    return outputs;
                 }
             } // namespace set_1
 
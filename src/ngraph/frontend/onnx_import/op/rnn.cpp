@@ -0,0 +1,160 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "exceptions.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/type/element_type.hpp"
+#include "rnn.hpp"
+#include "utils/common.hpp"
+#include "utils/reshape.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace op
+        {
+            namespace
+            {
+                std::shared_ptr<ngraph::Node> add_bias(const std::shared_ptr<ngraph::Node>& node,
+                                                       const std::shared_ptr<ngraph::Node>& bias)
+                {
+                    return std::make_shared<ngraph::op::Add>(
+                        node,
+                        std::make_shared<ngraph::op::Broadcast>(
+                            bias, node->get_shape(), AxisSet{0}));
+                }
+
+            } // anonymous namespace
+
+            namespace set_1
+            {
+                NodeVector rnn(const Node& node)
+                {
+                    const NodeVector ng_inputs{node.get_ng_inputs()};
+                    const auto direction =
+                        node.get_attribute_value<std::string>("direction", "forward");
+                    ASSERT_IS_SUPPORTED(node, direction == "forward")
+                        << "only 'forward' direction is supported";
+                    const std::vector<std::string> activations{"Tanh"};
+                    ASSERT_IS_SUPPORTED(node,
+                                        node.get_attribute_value<std::vector<std::string>>(
+                                            "activations", activations) == activations)
+                        << "only the 'Tanh' activation is supported";
+                    ASSERT_IS_SUPPORTED(
+                        node,
+                        node.get_attribute_value<std::vector<float>>("activation_alpha", {})
+                                .empty() &&
+                            node.get_attribute_value<std::vector<float>>("activation_beta", {})
+                                .empty())
+                        << "activation_alpha and activation_beta are not supported";
+                    ASSERT_IS_SUPPORTED(node,
+                                        std::isinf(node.get_attribute_value<float>(
+                                            "clip", std::numeric_limits<float>::infinity())))
+                        << "clip is not supported";
+                    const auto hidden_size = static_cast<std::size_t>(
+                        node.get_attribute_value<std::int64_t>("hidden_size"));
+
+                    // ------ INPUTS ------
+                    // X - The input tensor. [seq_length, batch_size, input_size]
+                    // W - The weight tensor. [num_directions, hidden_size, input_size]
+                    // R - The recurrence weight tensor. [num_directions, hidden_size, hidden_size]
+                    // B - The bias tensor for input gate. [num_directions, 2*hidden_size]
+                    // initial_h - The initial value of the hidden. [num_directions, batch_size,
+                    //             hidden_size]
+                    // sequence_lens - The lengths of the sequences in a batch. [batch_size]
+                    //                 Ragged sequences are not supported.
+                    const auto& X = ng_inputs.at(0);
+                    const std::size_t batch_size = X->get_shape().at(1);
+                    ASSERT_IS_SUPPORTED(node,
+                                        ng_inputs.size() < 5 ||
+                                            common::has_full_sequence_lengths(
+                                                ng_inputs.at(4), X->get_shape().at(0)))
+                        << "sequence_lens is only supported when it is a constant equal to "
+                           "seq_length";
+                    for (std::size_t i = 1; i < ng_inputs.size(); ++i)
+                    {
+                        // Since we have forward RNN we can squeeze `num_directions` axis from
+                        // inputs.
+                        ASSERT_VALID_ARGUMENT(node,
+                                              i == 4 || ng_inputs.at(i)->get_shape().at(0) == 1)
+                            << "Input: { " << i << " } first axis has size different from 1, "
+                                                   "while direction attribute set to 'forward'.";
+                    }
+                    // Keep the transposed weights outside of the loop, so that all the cells
+                    // share them and the CPU backend can fuse the cells into a single RNN kernel.
+                    auto W = reshape::transpose(reshape::squeeze(ng_inputs.at(1)));
+                    auto R = reshape::transpose(reshape::squeeze(ng_inputs.at(2)));
+                    auto B = ng_inputs.size() >= 4
+                                 ? reshape::squeeze(ng_inputs.at(3))
+                                 : common::make_constant_node<float>(
+                                       element::f32, {2 * hidden_size}, {0.f});
+                    std::shared_ptr<ngraph::Node> H_t =
+                        ng_inputs.size() >= 6
+                            ? reshape::squeeze(ng_inputs.at(5))
+                            : common::make_constant_node<float>(
+                                  element::f32, {batch_size, hidden_size}, {0.f});
+                    NodeVector b_W_R = reshape::split(B, 2);
+
+                    NodeVector in_seqs = reshape::split(X, X->get_shape().at(0));
+                    NodeVector h_list;
+                    for (const auto& in_seq : in_seqs)
+                    {
+                        // remove first empty dim, after above split.
+                        auto in_x = reshape::squeeze(in_seq);
+                        // f(Xt*(Wi^T) + Ht-1*(Ri^T) + Wbi + Rbi)
+                        auto Xt_W =
+                            add_bias(std::make_shared<ngraph::op::Dot>(in_x, W), b_W_R.at(0));
+                        auto Ht_R =
+                            add_bias(std::make_shared<ngraph::op::Dot>(H_t, R), b_W_R.at(1));
+                        H_t = std::make_shared<ngraph::op::Tanh>(Xt_W + Ht_R);
+                        h_list.push_back(H_t);
+                    }
+
+                    // The tensor that concats all the intermediate output values of the hidden.
+                    // It has shape [seq_length, num_directions, batch_size, hidden_size]
+                    NodeVector exp_h_list;
+                    for (const auto& ht : h_list)
+                    {
+                        // Expand tensors with empty outermost dims, so we can later concatenate
+                        // them.
+                        exp_h_list.push_back(reshape::add_empty_axes(ht, 2));
+                    }
+                    auto Y = std::make_shared<ngraph::op::Concat>(exp_h_list, 0);
+                    return {Y, reshape::add_empty_axes(h_list.back())};
+                }
+
+            } // namespace set_1
+
+        } //namespace op
+
+    } // namespace onnx_import
+
+} // namespace ngraph
@@ -18,6 +18,7 @@
 
 #include <cmath>       // std::floor, std::min
 #include <cstddef>     // std::size_t
+#include <cstdint>     // std::int32_t, std::int64_t
 #include <iterator>    // std::begin, std::end
 #include <memory>      // std::shared_ptr, std::make_shared
 #include <type_traits> // std::enable_if, std::is_floating_point, std::is_integral
@@ -158,6 +159,33 @@ namespace ngraph
                 }
             }
 
+            /// \brief      Check that a `sequence_lens` input of a recurrent op gives every
+            ///             sequence of the batch the full length, so it can be ignored.
+            ///
+            /// \param[in]  sequence_lens  The sequence_lens input node.
+            /// \param[in]  seq_length     The length of the input sequences.
+            ///
+            /// \return     True if sequence_lens is a Constant equal to seq_length everywhere.
+            ///
+            inline bool
+                has_full_sequence_lengths(const std::shared_ptr<ngraph::Node>& sequence_lens,
+                                          std::size_t seq_length)
+            {
+                auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(sequence_lens);
+                if (!constant || constant->get_element_type() != ngraph::element::i32)
+                {
+                    return false;
+                }
+                for (std::int32_t length : constant->get_vector<std::int32_t>())
+                {
+                    if (static_cast<std::size_t>(length) != seq_length)
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
         } // namespace  common
     }     // namespace onnx_import
 } // namespace ngraph
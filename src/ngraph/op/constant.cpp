@@ -54,7 +54,7 @@ string to_cpp_string(T value)
 
 op::Constant::~Constant()
 {
-    if (m_data)
+    if (m_data && !m_data_source)
     {
         aligned_free(m_data);
     }
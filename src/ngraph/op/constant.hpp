@@ -105,6 +105,21 @@ namespace ngraph
                 constructor_validate_and_infer_types();
             }
 
+            /// \brief Constructs a tensor constant that reads the data of another constant
+            ///        instead of copying it. The data of `source` must not be modified while
+            ///        this constant is alive; `source` is kept alive by this constant.
+            ///
+            /// \param source The constant holding the data.
+            explicit Constant(const std::shared_ptr<Constant>& source)
+                : Node("Constant", {})
+                , m_element_type(source->get_element_type())
+                , m_shape(source->get_shape())
+                , m_data(const_cast<void*>(source->get_data_ptr()))
+                , m_data_source(source)
+            {
+                constructor_validate_and_infer_types();
+            }
+
             virtual ~Constant() override;
 
             void validate_and_infer_types() override
@@ -264,6 +279,8 @@ namespace ngraph
             element::Type m_element_type;
             Shape m_shape{};
             void* m_data{nullptr};
+            // Set when m_data is owned by another constant
+            std::shared_ptr<Constant> m_data_source;
             Constant(const Constant&) = delete;
             Constant operator=(const Constant&) = delete;
         };
@@ -0,0 +1,136 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/experimental/quantized_dot.hpp"
+#include "ngraph/shape_util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Checks the data/weights/scale arguments shared by QuantizedDot and QuantizedDotBias and sets
+// the output type
+static void validate_quantized_dot(Node* node,
+                                   size_t scale_index,
+                                   bool requantize,
+                                   bool with_relu)
+{
+    NODE_VALIDATION_ASSERT(node, node->get_input_element_type(0) == element::u8)
+        << "Data element type (" << node->get_input_element_type(0) << ") must be u8";
+
+    NODE_VALIDATION_ASSERT(node, node->get_input_element_type(1) == element::i8)
+        << "Weights element type (" << node->get_input_element_type(1) << ") must be i8";
+
+    NODE_VALIDATION_ASSERT(node, node->get_input_element_type(scale_index) == element::f32)
+        << "Scale element type (" << node->get_input_element_type(scale_index)
+        << ") must be f32";
+
+    auto output_et = requantize ? (with_relu ? element::u8 : element::i8) : element::i32;
+
+    if (node->get_input_partial_shape(0).is_dynamic() ||
+        node->get_input_partial_shape(1).is_dynamic() ||
+        node->get_input_partial_shape(scale_index).is_dynamic())
+    {
+        node->set_output_type(0, output_et, PartialShape::dynamic());
+        return;
+    }
+
+    auto& data_shape = node->get_input_shape(0);
+    auto& weights_shape = node->get_input_shape(1);
+
+    NODE_VALIDATION_ASSERT(node, data_shape.size() >= 1)
+        << "Data must have rank at least 1 (data shape: " << data_shape << ")";
+
+    NODE_VALIDATION_ASSERT(node, weights_shape.size() == 2)
+        << "Weights must have rank 2 (weights shape: " << weights_shape << ")";
+
+    NODE_VALIDATION_ASSERT(node, data_shape.back() == weights_shape[0])
+        << "Reduction axis of data (" << data_shape << ") does not match weights ("
+        << weights_shape << ")";
+
+    NODE_VALIDATION_ASSERT(node, shape_size(node->get_input_shape(scale_index)) == 1)
+        << "Scale must have a single element (scale shape: "
+        << node->get_input_shape(scale_index) << ")";
+
+    Shape result_shape(data_shape.begin(), data_shape.end() - 1);
+    result_shape.push_back(weights_shape[1]);
+    node->set_output_type(0, output_et, result_shape);
+}
+
+op::QuantizedDot::QuantizedDot(const shared_ptr<Node>& data,
+                               const shared_ptr<Node>& weights,
+                               const shared_ptr<Node>& scale,
+                               const bool requantize,
+                               const bool with_relu)
+    : Op("QuantizedDot", check_single_output_args({data, weights, scale}))
+    , m_requantize(requantize)
+    , m_with_relu(with_relu)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::QuantizedDot::validate_and_infer_types()
+{
+    validate_quantized_dot(this, 2, m_requantize, m_with_relu);
+}
+
+shared_ptr<Node> op::QuantizedDot::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<QuantizedDot>(
+        new_args.at(0), new_args.at(1), new_args.at(2), m_requantize, m_with_relu);
+}
+
+op::QuantizedDotBias::QuantizedDotBias(const shared_ptr<Node>& data,
+                                       const shared_ptr<Node>& weights,
+                                       const shared_ptr<Node>& bias,
+                                       const shared_ptr<Node>& scale,
+                                       const bool requantize,
+                                       const bool with_relu)
+    : Op("QuantizedDotBias", check_single_output_args({data, weights, bias, scale}))
+    , m_requantize(requantize)
+    , m_with_relu(with_relu)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::QuantizedDotBias::validate_and_infer_types()
+{
+    NODE_VALIDATION_ASSERT(this, get_input_element_type(2) == element::i32)
+        << "Bias element type (" << get_input_element_type(2) << ") must be i32";
+
+    if (get_input_partial_shape(1).is_static() && get_input_partial_shape(2).is_static())
+    {
+        auto& weights_shape = get_input_shape(1);
+        NODE_VALIDATION_ASSERT(this,
+                               weights_shape.size() == 2 &&
+                                   get_input_shape(2) == Shape{weights_shape[1]})
+            << "Bias shape (" << get_input_shape(2) << ") must match the output dimension of "
+            << "the weights (" << weights_shape << ")";
+    }
+
+    validate_quantized_dot(this, 3, m_requantize, m_with_relu);
+}
+
+shared_ptr<Node> op::QuantizedDotBias::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<QuantizedDotBias>(new_args.at(0),
+                                         new_args.at(1),
+                                         new_args.at(2),
+                                         new_args.at(3),
+                                         m_requantize,
+                                         m_with_relu);
+}
@@ -0,0 +1,76 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Matrix product of u8 data and i8 weights accumulated in i32.
+        ///
+        ///        The input data has shape [..., K] and the weights have shape [K, M]. When
+        ///        `requantize` is set the i32 accumulators are multiplied by `scale`, rounded to
+        ///        nearest even and saturated to u8 (with relu) or i8 (without relu); otherwise the
+        ///        i32 accumulators are returned.
+        class QuantizedDot : public Op
+        {
+        public:
+            QuantizedDot(const std::shared_ptr<Node>& data,
+                         const std::shared_ptr<Node>& weights,
+                         const std::shared_ptr<Node>& scale,
+                         const bool requantize = true,
+                         const bool with_relu = false);
+
+            void validate_and_infer_types() override;
+
+            bool get_requantize() const { return m_requantize; }
+            bool with_relu() const { return m_with_relu; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        protected:
+            bool m_requantize;
+            bool m_with_relu;
+        };
+
+        /// \brief QuantizedDot with an i32 bias of shape [M] added to the accumulators before
+        ///        requantization.
+        class QuantizedDotBias : public Op
+        {
+        public:
+            QuantizedDotBias(const std::shared_ptr<Node>& data,
+                             const std::shared_ptr<Node>& weights,
+                             const std::shared_ptr<Node>& bias,
+                             const std::shared_ptr<Node>& scale,
+                             const bool requantize = true,
+                             const bool with_relu = false);
+
+            void validate_and_infer_types() override;
+
+            bool get_requantize() const { return m_requantize; }
+            bool with_relu() const { return m_with_relu; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        protected:
+            bool m_requantize;
+            bool m_with_relu;
+        };
+    }
+}
@@ -104,6 +104,8 @@ NGRAPH_OP(Parameter, ngraph::op)
 NGRAPH_OP(Power, ngraph::op)
 NGRAPH_OP(Product, ngraph::op)
 NGRAPH_OP(Quantize, ngraph::op)
+NGRAPH_OP(QuantizedDot, ngraph::op)
+NGRAPH_OP(QuantizedDotBias, ngraph::op)
 NGRAPH_OP(Reduce, ngraph::op)
 NGRAPH_OP(ReduceWindow, ngraph::op)
 NGRAPH_OP(Relu, ngraph::op)
@@ -0,0 +1,157 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "constant_deduplication.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static size_t payload_size(const op::Constant& constant)
+{
+    return shape_size(constant.get_shape()) * constant.get_element_type().size();
+}
+
+shared_ptr<op::Constant> pass::ConstantStore::intern(const shared_ptr<op::Constant>& constant,
+                                                     size_t hash)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto range = m_constants.equal_range(hash);
+    for (auto it = range.first; it != range.second;)
+    {
+        shared_ptr<op::Constant> registered = it->second.lock();
+        if (!registered)
+        {
+            it = m_constants.erase(it);
+            continue;
+        }
+        if (registered == constant ||
+            ConstantDeduplication::same_payload(*registered, *constant))
+        {
+            return registered;
+        }
+        ++it;
+    }
+    m_constants.emplace(hash, constant);
+    return constant;
+}
+
+void pass::ConstantStore::add_bytes_saved(size_t bytes)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_bytes_saved += bytes;
+}
+
+size_t pass::ConstantStore::get_bytes_saved() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_bytes_saved;
+}
+
+size_t pass::ConstantDeduplication::hash_constant(const op::Constant& constant)
+{
+    vector<size_t> values{constant.get_element_type().hash()};
+    const Shape& shape = constant.get_shape();
+    values.insert(values.end(), shape.begin(), shape.end());
+
+    // Mix the data a word at a time, then the trailing bytes
+    size_t size = payload_size(constant);
+    auto data = static_cast<const char*>(constant.get_data_ptr());
+    size_t seed = hash_combine(values);
+    size_t i = 0;
+    for (; i + sizeof(size_t) <= size; i += sizeof(size_t))
+    {
+        size_t word;
+        memcpy(&word, data + i, sizeof(size_t));
+        seed ^= word + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    for (; i < size; i++)
+    {
+        seed ^= static_cast<unsigned char>(data[i]) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+}
+
+bool pass::ConstantDeduplication::same_payload(const op::Constant& a, const op::Constant& b)
+{
+    return a.get_element_type() == b.get_element_type() && a.get_shape() == b.get_shape() &&
+           memcmp(a.get_data_ptr(), b.get_data_ptr(), payload_size(a)) == 0;
+}
+
+bool pass::ConstantDeduplication::run_on_function(shared_ptr<Function> f)
+{
+    m_bytes_saved = 0;
+    unordered_multimap<size_t, shared_ptr<op::Constant>> seen;
+    for (auto& node : f->get_ordered_ops())
+    {
+        // Only plain constants, ScalarConstantLike still depends on its argument
+        if (node->description() != "Constant" || node->get_input_size() != 0)
+        {
+            continue;
+        }
+        auto constant = static_pointer_cast<op::Constant>(node);
+        size_t size = payload_size(*constant);
+        if (size == 0)
+        {
+            continue;
+        }
+
+        size_t hash = hash_constant(*constant);
+        shared_ptr<op::Constant> replacement;
+        auto range = seen.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (same_payload(*it->second, *constant))
+            {
+                replacement = it->second;
+                break;
+            }
+        }
+        if (!replacement && m_store)
+        {
+            shared_ptr<op::Constant> registered = m_store->intern(constant, hash);
+            if (registered != constant)
+            {
+                replacement = make_shared<op::Constant>(registered);
+                seen.emplace(hash, replacement);
+            }
+        }
+
+        if (replacement)
+        {
+            NGRAPH_DEBUG << "Replacing " << constant->get_name() << " with "
+                         << replacement->get_name();
+            replace_node(constant, replacement);
+            m_bytes_saved += size;
+        }
+        else
+        {
+            seen.emplace(hash, constant);
+        }
+    }
+
+    if (m_store)
+    {
+        m_store->add_bytes_saved(m_bytes_saved);
+    }
+    NGRAPH_DEBUG << "ConstantDeduplication saved " << m_bytes_saved << " bytes in "
+                 << f->get_name();
+    return m_bytes_saved != 0;
+}
@@ -0,0 +1,79 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "ngraph/op/constant.hpp"
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief Process-wide index of Constant payloads, so Functions compiled separately can
+        ///        share the data of identical Constants. Entries are held weakly and disappear
+        ///        with the last Function using them.
+        class ConstantStore
+        {
+        public:
+            /// \brief Returns a registered Constant with the same element type, shape and data
+            ///        as `constant`, or registers `constant` and returns it.
+            /// \param constant The constant to look up
+            /// \param hash The payload hash of `constant`
+            std::shared_ptr<op::Constant> intern(const std::shared_ptr<op::Constant>& constant,
+                                                 size_t hash);
+
+            void add_bytes_saved(size_t bytes);
+            /// \brief Total bytes of constant data removed by deduplication using this store
+            size_t get_bytes_saved() const;
+
+        private:
+            mutable std::mutex m_mutex;
+            std::unordered_multimap<size_t, std::weak_ptr<op::Constant>> m_constants;
+            size_t m_bytes_saved = 0;
+        };
+
+        /// \brief Merges Constants with the same element type, shape and data.
+        ///
+        ///        Duplicates within a Function are replaced by the first of them. When a store
+        ///        is given, a Constant whose data is already held by a Constant of another
+        ///        Function is replaced by one reading that data, so the copy is freed.
+        class ConstantDeduplication : public FunctionPass
+        {
+        public:
+            ConstantDeduplication(const std::shared_ptr<ConstantStore>& store = nullptr)
+                : FunctionPass()
+                , m_store(store)
+            {
+            }
+
+            bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+            /// \brief Bytes of constant data removed by the last run
+            size_t get_bytes_saved() const { return m_bytes_saved; }
+            static size_t hash_constant(const op::Constant& constant);
+            static bool same_payload(const op::Constant& a, const op::Constant& b);
+
+        private:
+            std::shared_ptr<ConstantStore> m_store;
+            size_t m_bytes_saved = 0;
+        };
+    }
+}
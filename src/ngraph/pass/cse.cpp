@@ -266,7 +266,7 @@ bool ngraph::pass::CommonSubexpressionElimination::run_on_function(
 
     for (auto n : f->get_ordered_ops())
     {
-        if (n->is_output() || n->is_parameter())
+        if (n->is_output() || n->is_parameter() || (!m_merge_constants && n->is_constant()))
         {
             continue;
         }
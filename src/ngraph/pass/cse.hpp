@@ -34,18 +34,24 @@ public:
     {
     }
 
+    /// \param backend_cse_handlers Equality checks of backend specific ops
+    /// \param merge_constants false to keep Constants with the same data apart, so that each
+    ///     can still be told apart from the others after the pass
     CommonSubexpressionElimination(
         const std::unordered_map<std::type_index,
                                  std::function<bool(std::shared_ptr<Node>, std::shared_ptr<Node>)>>&
-            backend_cse_handlers)
+            backend_cse_handlers,
+        bool merge_constants = true)
         : FunctionPass()
         , m_backend_cse_handlers(backend_cse_handlers)
+        , m_merge_constants(merge_constants)
     {
     }
 
     std::unordered_map<std::type_index,
                        std::function<bool(std::shared_ptr<Node>, std::shared_ptr<Node>)>>
         m_backend_cse_handlers;
+    bool m_merge_constants = true;
 
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
 };
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <regex>
 #include <unordered_set>
@@ -56,8 +57,42 @@
 // c) there's no linear order of fusions which will give
 //    the correct final fusion. i.e. the same fusion needs to occur before and after some other fusion
 
+// Tries `matcher` on `node` and applies it on a match. When `profiles` is set, the time spent
+// and the outcome are accumulated in its entry for `name`.
+template <typename M>
+static bool apply_matcher(M& matcher,
+                          const std::shared_ptr<ngraph::Node>& node,
+                          const std::string& name,
+                          std::map<std::string, ngraph::pass::MatcherProfile>* profiles)
+{
+    if (!profiles)
+    {
+        return matcher.match(node) && matcher.process_match();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    bool matched = matcher.match(node);
+    bool rewritten = matched && matcher.process_match();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ngraph::pass::MatcherProfile& profile = (*profiles)[name];
+    profile.name = name;
+    profile.microseconds +=
+        std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+    profile.attempts++;
+    profile.matches += matched ? 1 : 0;
+    profile.rewrites += rewritten ? 1 : 0;
+    return rewritten;
+}
+
 bool ngraph::pass::GraphRewrite::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
+    std::map<std::string, MatcherProfile>* profiles = nullptr;
+    if (has_state() && get_state().is_matcher_profiling_enabled())
+    {
+        profiles = &get_state().get_matcher_profiles();
+    }
+
     bool rewritten = false;
     const size_t NUM_TRIES = 10;
     size_t tries = NUM_TRIES;
@@ -73,15 +108,12 @@ bool ngraph::pass::GraphRewrite::run_on_function(std::shared_ptr<ngraph::Functio
             {
                 NGRAPH_DEBUG << "Running matcher " << matcher->get_name() << "("
                              << matcher->get_pattern()->get_name() << ") on " << node->get_name();
-                if (matcher->match(node))
+                if (apply_matcher(*matcher, node, matcher->get_name(), profiles))
                 {
-                    NGRAPH_DEBUG << "Matcher " << matcher << matcher->get_name() << " matched "
+                    NGRAPH_DEBUG << "Matcher " << matcher << matcher->get_name() << " rewrote "
                                  << node->get_name();
-                    if (matcher->process_match())
-                    {
-                        rewritten = true;
-                        break;
-                    }
+                    rewritten = true;
+                    break;
                 }
             }
         }
@@ -136,23 +168,33 @@ void ngraph::pass::GraphRewrite::add_matcher(std::shared_ptr<pattern::Matcher> m
 
 bool ngraph::pass::RecurrentGraphRewrite::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
+    std::map<std::string, MatcherProfile>* profiles = nullptr;
+    std::vector<std::string> names;
+    if (has_state() && get_state().is_matcher_profiling_enabled())
+    {
+        profiles = &get_state().get_matcher_profiles();
+        // Recurrent matchers are not named, so they are reported by registration order
+        for (size_t i = 0; i < m_matchers.size(); i++)
+        {
+            names.push_back("RecurrentMatcher" + std::to_string(i));
+        }
+    }
+
     bool changed = false;
     size_t i = 0;
     do
     {
         for (auto node : f->get_ops())
         {
-            for (auto matcher : m_matchers)
+            for (size_t m = 0; m < m_matchers.size(); m++)
             {
+                auto matcher = m_matchers[m];
                 NGRAPH_DEBUG << "Running matcher " << matcher << " on " << node->get_name();
-                if (matcher->match(node))
+                if (apply_matcher(*matcher, node, profiles ? names[m] : "", profiles))
                 {
-                    NGRAPH_DEBUG << "Matcher " << matcher << " matched " << node->get_name();
-                    if (matcher->process_match())
-                    {
-                        changed = true;
-                        goto next_fusion;
-                    }
+                    NGRAPH_DEBUG << "Matcher " << matcher << " rewrote " << node->get_name();
+                    changed = true;
+                    goto next_fusion;
                 }
             }
         }
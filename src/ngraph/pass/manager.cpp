@@ -59,9 +59,41 @@ void ngraph::pass::Manager::initialize_default_passes()
 {
 }
 
-void ngraph::pass::Manager::run_passes(shared_ptr<Function> func, bool transitive)
+static string get_pass_name(pass::PassBase* pass)
+{
+    string name = typeid(*pass).name();
+#ifndef _WIN32
+    int status;
+    char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (demangled)
+    {
+        name = demangled;
+        free(demangled);
+    }
+#endif
+    return name;
+}
+
+static size_t count_ops(const vector<shared_ptr<Function>>& fs)
+{
+    size_t count = 0;
+    for (auto f : fs)
+    {
+        count += f->get_ops().size();
+    }
+    return count;
+}
+
+vector<pass::PassProfile> ngraph::pass::Manager::run_passes(shared_ptr<Function> func,
+                                                             bool transitive)
 {
     bool profile_enabled = getenv("NGRAPH_PROFILE_PASS_ENABLE") != nullptr;
+    if (profile_enabled)
+    {
+        get_state().set_matcher_profiling(true);
+        get_state().set_pass_profiling(true);
+    }
+    bool count_pass_ops = get_state().is_pass_profiling_enabled();
 
     vector<shared_ptr<Function>> fs;
     if (transitive)
@@ -76,12 +108,15 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func, bool transitiv
     set<shared_ptr<Function>> tfs(begin(fs), end(fs));
     get_state().set_functions(tfs);
 
+    vector<PassProfile> profiles;
+    size_t ops = count_pass_ops ? count_ops(fs) : 0;
     size_t index = 0;
     stopwatch pass_timer;
     stopwatch overall_timer;
     overall_timer.start();
     for (shared_ptr<PassBase> pass : m_pass_list)
     {
+        get_state().get_matcher_profiles().clear();
         pass_timer.start();
         pass->set_state(get_state());
         auto module_pass = dynamic_pointer_cast<ModulePass>(pass);
@@ -152,21 +187,38 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func, bool transitiv
         }
         index++;
         pass_timer.stop();
+
+        PassProfile profile;
+        profile.name = get_pass_name(pass.get());
+        profile.microseconds = pass_timer.get_microseconds();
+        if (count_pass_ops)
+        {
+            profile.ops_before = ops;
+            profile.ops_after = ops = count_ops(fs);
+        }
+        for (auto& matcher : get_state().get_matcher_profiles())
+        {
+            profile.matchers.push_back(matcher.second);
+        }
         if (profile_enabled)
         {
-            PassBase* p = pass.get();
-            string name = typeid(*p).name();
-#ifndef _WIN32
-            int status;
-            name = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
-#endif
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << name << "\n";
+            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << profile.name << " ("
+                 << profile.ops_before << " -> " << profile.ops_after << " ops)\n";
+            for (const MatcherProfile& matcher : profile.matchers)
+            {
+                cout << setw(12) << matcher.microseconds << "us   " << matcher.name << " "
+                     << matcher.rewrites << "/" << matcher.matches << "/" << matcher.attempts
+                     << " rewrites/matches/attempts\n";
+            }
         }
+        profiles.push_back(profile);
     }
+    get_state().get_matcher_profiles().clear();
     if (profile_enabled)
     {
         cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
     }
+    return profiles;
 }
 
 ngraph::pass::ManagerState& ngraph::pass::Manager::get_state()
@@ -18,6 +18,7 @@
 
 #include <list>
 #include <memory>
+#include <string>
 #include <typeinfo>
 #include <vector>
 
@@ -31,6 +32,20 @@ namespace ngraph
     {
         class Manager;
         class ManagerState;
+
+        /// \brief Compile-time cost of one pass of a Manager run
+        struct PassProfile
+        {
+            std::string name;
+            size_t microseconds = 0;
+            /// Ops in all the functions of the run before and after the pass. Only counted when
+            /// pass profiling is enabled.
+            size_t ops_before = 0;
+            size_t ops_after = 0;
+            /// Per-matcher timings of a graph rewrite. Only filled in when matcher profiling is
+            /// enabled.
+            std::vector<MatcherProfile> matchers;
+        };
     }
 }
 
@@ -55,13 +70,18 @@ public:
         }
     }
 
-    void run_passes(std::shared_ptr<Function>, bool transitive = true);
+    /// \brief Runs the registered passes in order
+    /// \return The time each pass took, and how it changed the op count when pass profiling
+    ///     is enabled
+    std::vector<PassProfile> run_passes(std::shared_ptr<Function>, bool transitive = true);
 
     ManagerState& get_state();
     PassConfig& get_pass_config() { return m_pass_config; }
     void set_pass_config(const PassConfig& pass_config) { m_pass_config = pass_config; }
     void set_pass_visualization(bool new_state) { m_visualize = new_state; }
     void set_pass_serialization(bool new_state) { m_serialize = new_state; }
+    void set_matcher_profiling(bool new_state) { m_state.set_matcher_profiling(new_state); }
+    void set_pass_profiling(bool new_state) { m_state.set_pass_profiling(new_state); }
 private:
     std::vector<std::string> m_pass_names;
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
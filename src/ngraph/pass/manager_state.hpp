@@ -18,7 +18,9 @@
 
 #include <functional>
 #include <initializer_list>
+#include <map>
 #include <memory>
+#include <string>
 #include <typeindex>
 #include <typeinfo>
 #include <utility>
@@ -35,6 +37,19 @@ namespace ngraph
     namespace pass
     {
         class ManagerState;
+
+        /// \brief Time spent trying one matcher of a GraphRewrite, and how often it applied
+        struct MatcherProfile
+        {
+            std::string name;
+            size_t microseconds = 0;
+            /// Nodes the matcher was tried on
+            size_t attempts = 0;
+            /// Nodes the pattern matched
+            size_t matches = 0;
+            /// Matches whose callback changed the graph
+            size_t rewrites = 0;
+        };
     }
 }
 
@@ -60,7 +75,20 @@ public:
         return m_visualize_tree_ops_map;
     }
 
+    /// \brief When enabled, graph rewrites time every matcher they try and accumulate the
+    ///     results, by matcher name, in get_matcher_profiles(). Off by default, as it adds a
+    ///     clock read around every match attempt.
+    void set_matcher_profiling(bool enable) { m_matcher_profiling = enable; }
+    bool is_matcher_profiling_enabled() const { return m_matcher_profiling; }
+    std::map<std::string, MatcherProfile>& get_matcher_profiles() { return m_matcher_profiles; }
+    /// \brief When enabled, the pass profiles of a run also hold the op counts before and after
+    ///     each pass. Off by default, as counting walks every function after every pass.
+    void set_pass_profiling(bool enable) { m_pass_profiling = enable; }
+    bool is_pass_profiling_enabled() const { return m_pass_profiling; }
 private:
     std::vector<std::shared_ptr<Function>> m_function_list;
     visualize_tree_ops_map_t m_visualize_tree_ops_map;
+    bool m_matcher_profiling = false;
+    bool m_pass_profiling = false;
+    std::map<std::string, MatcherProfile> m_matcher_profiles;
 };
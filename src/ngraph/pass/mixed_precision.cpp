@@ -0,0 +1,171 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <map>
+#include <unordered_map>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "mixed_precision.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+set<string> ngraph::pass::MixedPrecision::get_default_low_precision_ops()
+{
+    return {"Add",
+            "Convolution",
+            "Divide",
+            "Dot",
+            "Maximum",
+            "Minimum",
+            "Multiply",
+            "Negative",
+            "Relu",
+            "Sqrt",
+            "Subtract",
+            "Sum"};
+}
+
+set<string> ngraph::pass::MixedPrecision::get_default_passthrough_ops()
+{
+    return {"Broadcast", "Concat", "Reshape", "Slice"};
+}
+
+bool ngraph::pass::MixedPrecision::run_on_function(shared_ptr<Function> f)
+{
+    // original node -> node computing the same value in the rewritten graph
+    unordered_map<Node*, shared_ptr<Node>> replacements;
+    // (rewritten node, converted to bf16) -> conversion, so each value is converted once
+    map<pair<Node*, bool>, shared_ptr<Node>> conversions;
+
+    auto cast = [&](const shared_ptr<Node>& node, const element::Type& type) -> shared_ptr<Node> {
+        if (node->get_output_size() != 1 || node->get_element_type() == type)
+        {
+            return node;
+        }
+        auto key = make_pair(node.get(), type == element::bf16);
+        auto it = conversions.find(key);
+        if (it != conversions.end())
+        {
+            return it->second;
+        }
+
+        shared_ptr<Node> converted;
+        auto constant = dynamic_pointer_cast<op::Constant>(node);
+        if (constant && type == element::bf16)
+        {
+            vector<bfloat16> values;
+            for (float value : constant->get_vector<float>())
+            {
+                values.push_back(bfloat16(value, true));
+            }
+            converted =
+                make_shared<op::Constant>(element::bf16, constant->get_shape(), values.data());
+        }
+        else
+        {
+            converted = make_shared<op::Convert>(node, type);
+        }
+        conversions[key] = converted;
+        return converted;
+    };
+
+    bool modified = false;
+    for (shared_ptr<Node> node : f->get_ordered_ops())
+    {
+        if (node->get_arguments().empty())
+        {
+            replacements[node.get()] = node;
+            continue;
+        }
+
+        bool to_bf16 = false;
+        if (node->get_output_size() == 1 && node->get_element_type() == element::f32 &&
+            !node->is_output())
+        {
+            const string& name = node->description();
+            if (m_low_precision_ops.count(name) != 0)
+            {
+                to_bf16 = true;
+            }
+            else if (m_passthrough_ops.count(name) != 0)
+            {
+                for (const shared_ptr<Node>& arg : node->get_arguments())
+                {
+                    auto replacement = replacements.at(arg.get());
+                    if (replacement->get_output_size() == 1 &&
+                        replacement->get_element_type() == element::bf16)
+                    {
+                        to_bf16 = true;
+                    }
+                }
+            }
+        }
+
+        NodeVector new_args;
+        bool changed = false;
+        for (size_t i = 0; i < node->get_input_size(); i++)
+        {
+            auto arg = node->get_argument(i);
+            auto new_arg = replacements.at(arg.get());
+            if (node->get_input_element_type(i) == element::f32)
+            {
+                new_arg = cast(new_arg, to_bf16 ? element::bf16 : element::f32);
+            }
+            changed = changed || new_arg != arg;
+            new_args.push_back(new_arg);
+        }
+
+        // Control dependencies on rewritten nodes move to their replacements
+        vector<pair<shared_ptr<Node>, shared_ptr<Node>>> control_deps;
+        for (const shared_ptr<Node>& dep : node->get_control_dependencies())
+        {
+            auto it = replacements.find(dep.get());
+            auto new_dep = it != replacements.end() ? it->second : dep;
+            changed = changed || new_dep != dep;
+            control_deps.emplace_back(dep, new_dep);
+        }
+
+        if (!changed)
+        {
+            replacements[node.get()] = node;
+        }
+        else if (node->is_output())
+        {
+            node->get_inputs().at(0).replace_output(new_args.at(0)->get_outputs().at(0));
+            for (auto& control_dep : control_deps)
+            {
+                node->remove_control_dependency(control_dep.first);
+                node->add_control_dependency(control_dep.second);
+            }
+            modified = true;
+        }
+        else
+        {
+            auto new_node = node->copy_with_new_args(new_args);
+            for (auto& control_dep : control_deps)
+            {
+                new_node->add_control_dependency(control_dep.second);
+            }
+            replacements[node.get()] = new_node;
+            modified = true;
+        }
+    }
+    return modified;
+}
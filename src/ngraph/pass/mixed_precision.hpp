@@ -0,0 +1,63 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <set>
+#include <string>
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class MixedPrecision;
+    }
+}
+
+/// \brief Moves an f32 Function to bf16 wherever rounding to bf16 is numerically benign.
+///
+///        Ops named in `low_precision_ops` are given bf16 inputs, and so produce bf16 outputs.
+///        Data movement ops named in `passthrough_ops` stay in bf16 when any of their inputs
+///        already is, so values are not widened just to be copied. Every other op, including
+///        numerically sensitive ones such as Exp, Log, Softmax and BatchNorm, keeps seeing f32.
+///        The default sets only hold ops the CPU backend has bf16 kernels for: Dot and
+///        Convolution, which dominate the memory traffic, and the cheap elementwise ops and
+///        data movement between them.
+///        Converts are inserted where the precision changes and f32 Constants feeding bf16 ops
+///        are converted in place. Parameters and Results are untouched, so the Function keeps
+///        its f32 interface.
+class ngraph::pass::MixedPrecision : public FunctionPass
+{
+public:
+    MixedPrecision(const std::set<std::string>& low_precision_ops = get_default_low_precision_ops(),
+                   const std::set<std::string>& passthrough_ops = get_default_passthrough_ops())
+        : FunctionPass()
+        , m_low_precision_ops(low_precision_ops)
+        , m_passthrough_ops(passthrough_ops)
+    {
+    }
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
+
+    static std::set<std::string> get_default_low_precision_ops();
+    static std::set<std::string> get_default_passthrough_ops();
+
+private:
+    std::set<std::string> m_low_precision_ops;
+    std::set<std::string> m_passthrough_ops;
+};
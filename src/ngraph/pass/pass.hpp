@@ -46,9 +46,10 @@ public:
 protected:
     ManagerState& get_state();
     void set_state(ManagerState&);
-
+    /// \brief False when the pass is run directly instead of by a Manager
+    bool has_state() const { return m_state != nullptr; }
 private:
-    ManagerState* m_state;
+    ManagerState* m_state = nullptr;
 };
 
 class ngraph::pass::ModulePass : public PassBase
@@ -0,0 +1,140 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "reduce_lowering.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/max.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/min.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/product.hpp"
+#include "ngraph/op/reduce.hpp"
+#include "ngraph/op/reduce_window.hpp"
+#include "ngraph/op/sum.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Combines a lowered reduction with the initial value of the Reduce/ReduceWindow it replaces
+template <typename T>
+static shared_ptr<Node> combine_init(const shared_ptr<Node>& reduced, const shared_ptr<Node>& init)
+{
+    auto& shape = reduced->get_shape();
+    AxisSet axes;
+    for (size_t i = 0; i < shape.size(); i++)
+    {
+        axes.insert(i);
+    }
+    return make_shared<T>(reduced, make_shared<op::Broadcast>(init, shape, axes));
+}
+
+shared_ptr<Node> pass::ReduceLowering::get_reduction_op(const shared_ptr<Function>& f)
+{
+    auto& params = f->get_parameters();
+    if (params.size() != 2 || f->get_output_size() != 1 || params[0]->get_shape() != Shape{} ||
+        params[1]->get_shape() != Shape{})
+    {
+        return nullptr;
+    }
+
+    auto op = f->get_output_op(0)->get_argument(0);
+    if (op->get_input_size() != 2 || op->get_output_size() != 1)
+    {
+        return nullptr;
+    }
+    auto arg0 = op->get_argument(0);
+    auto arg1 = op->get_argument(1);
+    if ((arg0 == params[0] && arg1 == params[1]) || (arg0 == params[1] && arg1 == params[0]))
+    {
+        return op;
+    }
+    return nullptr;
+}
+
+bool pass::ReduceLowering::run_on_node(shared_ptr<Node> node)
+{
+    if (auto reduce = dynamic_pointer_cast<op::Reduce>(node))
+    {
+        auto op = get_reduction_op(reduce->get_functions()[0]);
+        if (!op)
+        {
+            return false;
+        }
+
+        auto arg = reduce->get_argument(0);
+        auto init = reduce->get_argument(1);
+        auto& axes = reduce->get_reduction_axes();
+        shared_ptr<Node> replacement;
+        if (dynamic_pointer_cast<op::Add>(op))
+        {
+            replacement = make_shared<op::Sum>(arg, axes);
+            if (!is_zero(init))
+            {
+                replacement = combine_init<op::Add>(replacement, init);
+            }
+        }
+        else if (dynamic_pointer_cast<op::Multiply>(op))
+        {
+            replacement = make_shared<op::Product>(arg, axes);
+            if (!is_one(init))
+            {
+                replacement = combine_init<op::Multiply>(replacement, init);
+            }
+        }
+        else if (dynamic_pointer_cast<op::Maximum>(op))
+        {
+            replacement = combine_init<op::Maximum>(make_shared<op::Max>(arg, axes), init);
+        }
+        else if (dynamic_pointer_cast<op::Minimum>(op))
+        {
+            replacement = combine_init<op::Minimum>(make_shared<op::Min>(arg, axes), init);
+        }
+        else
+        {
+            return false;
+        }
+        replace_node(reduce, replacement);
+        return true;
+    }
+
+    if (auto reduce_window = dynamic_pointer_cast<op::ReduceWindow>(node))
+    {
+        auto op = get_reduction_op(reduce_window->get_functions()[0]);
+        auto& window_shape = reduce_window->get_window_shape();
+        auto& strides = reduce_window->get_window_movement_strides();
+        // MaxPool slides its window over the spatial axes only
+        if (!dynamic_pointer_cast<op::Maximum>(op) || window_shape.size() < 3 ||
+            window_shape[0] != 1 || window_shape[1] != 1 || strides[0] != 1 || strides[1] != 1)
+        {
+            return false;
+        }
+
+        Shape pool_window(window_shape.begin() + 2, window_shape.end());
+        Strides pool_strides(strides.begin() + 2, strides.end());
+        auto max_pool = make_shared<op::MaxPool>(
+            reduce_window->get_argument(0), pool_window, pool_strides);
+        replace_node(reduce_window,
+                     combine_init<op::Maximum>(max_pool, reduce_window->get_argument(1)));
+        return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,43 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief Replaces Reduce and ReduceWindow nodes whose reduction function is a single
+        ///        commutative arithmetic op with the equivalent built-in op, so backends can run
+        ///        their native kernels instead of calling the function once per element.
+        ///
+        ///        Reduce with Add/Multiply/Maximum/Minimum becomes Sum/Product/Max/Min, and
+        ///        ReduceWindow with Maximum over unit batch and channel windows becomes MaxPool.
+        ///        The initial value is folded in with one more elementwise op unless it is a
+        ///        constant identity of the reduction.
+        class ReduceLowering : public NodePass
+        {
+        public:
+            bool run_on_node(std::shared_ptr<ngraph::Node> node) override;
+
+            /// \brief Returns the node computing the result of `f` if `f` takes two scalar
+            ///        parameters and applies a single binary op to them, otherwise nullptr.
+            static std::shared_ptr<Node> get_reduction_op(const std::shared_ptr<Function>& f);
+        };
+    }
+}
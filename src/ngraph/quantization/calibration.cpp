@@ -0,0 +1,396 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <set>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dequantize.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/experimental/quantized_conv.hpp"
+#include "ngraph/op/experimental/quantized_conv_relu.hpp"
+#include "ngraph/op/experimental/quantized_dot.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/quantization/calibration.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+quantization::TensorStatistics::TensorStatistics(size_t bin_count)
+    : m_min(numeric_limits<float>::max())
+    , m_max(numeric_limits<float>::lowest())
+    , m_range(0)
+    , m_count(0)
+    , m_histogram(bin_count, 0)
+{
+    if (bin_count < 2 || bin_count % 2 != 0)
+    {
+        throw ngraph_error("TensorStatistics bin count must be a positive even number");
+    }
+}
+
+void quantization::TensorStatistics::update(const float* data, size_t count)
+{
+    const size_t bins = m_histogram.size();
+    for (size_t i = 0; i < count; i++)
+    {
+        float value = data[i];
+        if (!std::isfinite(value))
+        {
+            continue;
+        }
+        m_min = std::min(m_min, value);
+        m_max = std::max(m_max, value);
+        m_count++;
+
+        float magnitude = std::fabs(value);
+        if (magnitude == 0)
+        {
+            m_histogram[0]++;
+            continue;
+        }
+        if (m_range == 0)
+        {
+            m_range = magnitude;
+        }
+        while (magnitude >= m_range)
+        {
+            // Double the range, folding each pair of bins into one
+            for (size_t bin = 0; bin < bins / 2; bin++)
+            {
+                m_histogram[bin] = m_histogram[2 * bin] + m_histogram[2 * bin + 1];
+            }
+            std::fill(m_histogram.begin() + bins / 2, m_histogram.end(), 0);
+            m_range *= 2;
+        }
+        size_t bin = static_cast<size_t>(magnitude / m_range * bins);
+        m_histogram[std::min(bin, bins - 1)]++;
+    }
+}
+
+void quantization::TensorStatistics::update_channels(const float* data,
+                                                     const Shape& shape,
+                                                     size_t axis)
+{
+    if (axis >= shape.size())
+    {
+        throw ngraph_error("TensorStatistics channel axis out of range");
+    }
+
+    size_t channels = shape[axis];
+    size_t outer = 1;
+    size_t inner = 1;
+    for (size_t i = 0; i < axis; i++)
+    {
+        outer *= shape[i];
+    }
+    for (size_t i = axis + 1; i < shape.size(); i++)
+    {
+        inner *= shape[i];
+    }
+
+    if (m_channel_min.empty())
+    {
+        m_channel_min.assign(channels, numeric_limits<float>::max());
+        m_channel_max.assign(channels, numeric_limits<float>::lowest());
+    }
+    else if (m_channel_min.size() != channels)
+    {
+        throw ngraph_error("TensorStatistics channel count changed between updates");
+    }
+
+    for (size_t o = 0; o < outer; o++)
+    {
+        for (size_t c = 0; c < channels; c++)
+        {
+            const float* p = data + (o * channels + c) * inner;
+            for (size_t i = 0; i < inner; i++)
+            {
+                m_channel_min[c] = std::min(m_channel_min[c], p[i]);
+                m_channel_max[c] = std::max(m_channel_max[c], p[i]);
+            }
+        }
+    }
+    update(data, shape_size(shape));
+}
+
+float quantization::TensorStatistics::get_percentile_abs(float percentile) const
+{
+    if (m_count == 0)
+    {
+        return 0;
+    }
+
+    float abs_max = std::max(std::fabs(m_min), std::fabs(m_max));
+    size_t target = static_cast<size_t>(std::ceil(m_count * percentile / 100.0));
+    size_t seen = 0;
+    for (size_t bin = 0; bin < m_histogram.size(); bin++)
+    {
+        seen += m_histogram[bin];
+        if (seen >= target)
+        {
+            float upper = (bin + 1) * m_range / m_histogram.size();
+            return std::min(upper, abs_max);
+        }
+    }
+    return abs_max;
+}
+
+quantization::Calibrator::Calibrator(const shared_ptr<Function>& func,
+                                     const string& backend_name,
+                                     CalibrationMode mode,
+                                     float percentile)
+    : m_function(func)
+    , m_backend(runtime::Backend::create(backend_name))
+    , m_mode(mode)
+    , m_percentile(percentile)
+    , m_sample_count(0)
+{
+    if (percentile <= 0 || percentile > 100)
+    {
+        throw ngraph_error("Calibration percentile must be in (0, 100]");
+    }
+
+    set<shared_ptr<Node>> observed;
+    auto observe = [&](const shared_ptr<Node>& node) {
+        if (observed.insert(node).second)
+        {
+            m_observed.push_back(node);
+        }
+    };
+
+    for (const shared_ptr<Node>& node : m_function->get_ordered_ops())
+    {
+        size_t channel_axis;
+        if (auto conv = dynamic_pointer_cast<op::Convolution>(node))
+        {
+            // The MKLDNN int8 convolution handles 2D spatial convolutions without data dilation
+            if (conv->get_shape().size() != 4 ||
+                conv->get_data_dilation_strides() != Strides(2, 1))
+            {
+                continue;
+            }
+            channel_axis = 0;
+        }
+        else if (auto dot = dynamic_pointer_cast<op::Dot>(node))
+        {
+            if (dot->get_reduction_axes_count() != 1 ||
+                dot->get_argument(1)->get_shape().size() != 2)
+            {
+                continue;
+            }
+            channel_axis = 1;
+        }
+        else
+        {
+            continue;
+        }
+
+        auto data = node->get_argument(0);
+        auto weights = dynamic_pointer_cast<op::Constant>(node->get_argument(1));
+        if (!weights || data->get_element_type() != element::f32 ||
+            weights->get_element_type() != element::f32 || data->get_outputs().size() != 1)
+        {
+            continue;
+        }
+
+        Candidate candidate{node, nullptr};
+        auto users = node->get_users();
+        if (users.size() == 1 && dynamic_pointer_cast<op::Relu>(users[0]))
+        {
+            candidate.relu = users[0];
+        }
+        m_candidates.push_back(candidate);
+
+        // Weights are constant so their statistics are exact without running anything
+        if (m_statistics.find(weights->get_name()) == m_statistics.end())
+        {
+            m_statistics[weights->get_name()].update_channels(
+                weights->get_data_ptr<float>(), weights->get_shape(), channel_axis);
+        }
+
+        observe(data);
+        observe(candidate.relu ? candidate.relu : node);
+    }
+
+    if (m_observed.empty())
+    {
+        return;
+    }
+
+    NodeMap node_map;
+    auto clone = clone_function(*m_function, node_map);
+    ResultVector results = clone->get_results();
+    for (const shared_ptr<Node>& node : m_observed)
+    {
+        results.push_back(make_shared<op::Result>(node_map.get(node)));
+    }
+    m_observer = make_shared<Function>(results, clone->get_parameters());
+    for (const shared_ptr<op::Result>& result : results)
+    {
+        m_observer_outputs.push_back(
+            m_backend->create_tensor(result->get_element_type(), result->get_shape()));
+    }
+}
+
+void quantization::Calibrator::add_sample(const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    if (inputs.size() != m_function->get_parameters().size())
+    {
+        throw ngraph_error("Calibration sample must provide one tensor per parameter");
+    }
+    m_sample_count++;
+    if (!m_observer)
+    {
+        return;
+    }
+
+    m_backend->call_with_validate(m_observer, m_observer_outputs, inputs);
+
+    size_t first = m_observer_outputs.size() - m_observed.size();
+    vector<float> values;
+    for (size_t i = 0; i < m_observed.size(); i++)
+    {
+        const shared_ptr<runtime::Tensor>& tensor = m_observer_outputs[first + i];
+        values.resize(tensor->get_element_count());
+        tensor->read(values.data(), 0, values.size() * sizeof(float));
+        m_statistics[m_observed[i]->get_name()].update(values.data(), values.size());
+    }
+}
+
+float quantization::Calibrator::get_abs_max(const TensorStatistics& stats) const
+{
+    if (m_mode == CalibrationMode::PERCENTILE)
+    {
+        return stats.get_percentile_abs(m_percentile);
+    }
+    return std::max(std::fabs(stats.get_min()), std::fabs(stats.get_max()));
+}
+
+shared_ptr<Function> quantization::Calibrator::quantize() const
+{
+    if (m_sample_count == 0)
+    {
+        throw ngraph_error("Calibrator needs at least one sample before quantizing");
+    }
+
+    NodeMap node_map;
+    auto clone = clone_function(*m_function, node_map);
+
+    for (const Candidate& candidate : m_candidates)
+    {
+        const TensorStatistics& data_stats =
+            m_statistics.at(candidate.op->get_argument(0)->get_name());
+        auto output = candidate.relu ? candidate.relu : candidate.op;
+        const TensorStatistics& output_stats = m_statistics.at(output->get_name());
+        auto weights = static_pointer_cast<op::Constant>(candidate.op->get_argument(1));
+        const TensorStatistics& weights_stats = m_statistics.at(weights->get_name());
+
+        // The int8 kernels take unsigned activations; inputs that go negative stay in f32
+        if (data_stats.get_min() < 0)
+        {
+            continue;
+        }
+
+        // The int8 kernels apply a single output scale, so the per-channel weight ranges are
+        // folded into one symmetric per-tensor range.
+        float weights_max = 0;
+        for (size_t c = 0; c < weights_stats.get_channel_min().size(); c++)
+        {
+            weights_max = std::max(weights_max, std::fabs(weights_stats.get_channel_min()[c]));
+            weights_max = std::max(weights_max, std::fabs(weights_stats.get_channel_max()[c]));
+        }
+
+        bool with_relu = candidate.relu != nullptr;
+        element::Type output_type = with_relu ? element::u8 : element::i8;
+        float input_scale = get_abs_max(data_stats) / 255.0f;
+        float weights_scale = weights_max / 127.0f;
+        float output_scale = get_abs_max(output_stats) / (with_relu ? 255.0f : 127.0f);
+        if (input_scale == 0 || weights_scale == 0 || output_scale == 0)
+        {
+            continue;
+        }
+
+        auto weights_data = weights->get_vector<float>();
+        vector<int8_t> quantized_weights(weights_data.size());
+        for (size_t i = 0; i < weights_data.size(); i++)
+        {
+            float q = std::nearbyint(weights_data[i] / weights_scale);
+            quantized_weights[i] = static_cast<int8_t>(std::max(-127.0f, std::min(127.0f, q)));
+        }
+
+        auto op = node_map.get(candidate.op);
+        auto q_data = make_shared<op::Quantize>(
+            op->get_argument(0),
+            op::Constant::create(element::f32, Shape{}, {input_scale}),
+            op::Constant::create(element::u8, Shape{}, {0}),
+            element::u8,
+            AxisSet{},
+            op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN);
+        auto q_weights =
+            make_shared<op::Constant>(element::i8, weights->get_shape(), quantized_weights);
+        auto requantization_scale = op::Constant::create(
+            element::f32, Shape{1}, {input_scale * weights_scale / output_scale});
+
+        shared_ptr<Node> q_op;
+        if (auto conv = dynamic_pointer_cast<op::Convolution>(op))
+        {
+            if (with_relu)
+            {
+                q_op = make_shared<op::QuantizedConvolutionRelu>(
+                    q_data,
+                    q_weights,
+                    conv->get_window_movement_strides(),
+                    conv->get_window_dilation_strides(),
+                    conv->get_padding_below(),
+                    conv->get_padding_above(),
+                    conv->get_data_dilation_strides(),
+                    requantization_scale);
+            }
+            else
+            {
+                q_op = make_shared<op::QuantizedConvolution>(q_data,
+                                                             q_weights,
+                                                             conv->get_window_movement_strides(),
+                                                             conv->get_window_dilation_strides(),
+                                                             conv->get_padding_below(),
+                                                             conv->get_padding_above(),
+                                                             conv->get_data_dilation_strides(),
+                                                             requantization_scale);
+            }
+        }
+        else
+        {
+            q_op = make_shared<op::QuantizedDot>(
+                q_data, q_weights, requantization_scale, true, with_relu);
+        }
+
+        auto dq = make_shared<op::Dequantize>(
+            q_op,
+            op::Constant::create(element::f32, Shape{}, {output_scale}),
+            op::Constant::create(output_type, Shape{}, {0}),
+            element::f32,
+            AxisSet{});
+        replace_node(node_map.get(output), dq);
+    }
+    return clone;
+}
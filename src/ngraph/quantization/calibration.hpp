@@ -0,0 +1,129 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace quantization
+    {
+        enum class CalibrationMode
+        {
+            // use the absolute min/max observed over the whole dataset
+            MIN_MAX,
+
+            // clip the range at a percentile of the observed magnitudes
+            PERCENTILE
+        };
+
+        /// \brief Running statistics for a single f32 tensor.
+        ///
+        ///        Magnitudes are accumulated into a fixed number of bins covering [0, range).
+        ///        Whenever a value falls outside the current range, the range is doubled and
+        ///        adjacent bins are merged, so the histogram can be built in one pass without
+        ///        knowing the final range up front.
+        class TensorStatistics
+        {
+        public:
+            TensorStatistics(size_t bin_count = 2048);
+
+            void update(const float* data, size_t count);
+
+            /// \brief Per-channel min/max along `axis`, used for constant weights
+            void update_channels(const float* data, const Shape& shape, size_t axis);
+
+            float get_min() const { return m_min; }
+            float get_max() const { return m_max; }
+            const std::vector<float>& get_channel_min() const { return m_channel_min; }
+            const std::vector<float>& get_channel_max() const { return m_channel_max; }
+            /// \brief Smallest magnitude below which `percentile` percent of the values fell
+            float get_percentile_abs(float percentile) const;
+
+        private:
+            float m_min;
+            float m_max;
+            float m_range;
+            size_t m_count;
+            std::vector<size_t> m_histogram;
+            std::vector<float> m_channel_min;
+            std::vector<float> m_channel_max;
+        };
+
+        /// \brief Post-training calibration of an f32 Function.
+        ///
+        ///        Convolution and Dot nodes with constant f32 weights are quantization
+        ///        candidates. For each candidate the calibrator records statistics for its
+        ///        data input and its output (the output of the following Relu, if the Relu is
+        ///        its only user) by running the Function over a sample dataset with those
+        ///        tensors exposed as extra results. quantize() then replaces every candidate
+        ///        whose data input was observed to be non-negative with
+        ///        Quantize -> QuantizedConvolution[Relu]/QuantizedDot -> Dequantize, using
+        ///        scales derived from the recorded ranges.
+        class Calibrator
+        {
+        public:
+            Calibrator(const std::shared_ptr<Function>& func,
+                       const std::string& backend_name = "CPU",
+                       CalibrationMode mode = CalibrationMode::MIN_MAX,
+                       float percentile = 99.99f);
+
+            /// \brief Run one sample through the Function and accumulate statistics.
+            /// \param inputs One tensor per Function parameter, created on any backend.
+            void add_sample(const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+            /// \brief Build a quantized clone of the Function from the statistics gathered
+            ///        so far. The original Function is left untouched.
+            std::shared_ptr<Function> quantize() const;
+
+            /// \brief Statistics keyed by the name of the observed node in the source Function
+            const std::map<std::string, TensorStatistics>& get_statistics() const
+            {
+                return m_statistics;
+            }
+
+            size_t get_sample_count() const { return m_sample_count; }
+        private:
+            struct Candidate
+            {
+                std::shared_ptr<Node> op;
+                std::shared_ptr<Node> relu;
+            };
+
+            float get_abs_max(const TensorStatistics& stats) const;
+
+            std::shared_ptr<Function> m_function;
+            std::shared_ptr<runtime::Backend> m_backend;
+            CalibrationMode m_mode;
+            float m_percentile;
+            std::vector<Candidate> m_candidates;
+            // nodes whose outputs are exposed as extra results, in result order
+            NodeVector m_observed;
+            std::shared_ptr<Function> m_observer;
+            std::vector<std::shared_ptr<runtime::Tensor>> m_observer_outputs;
+            std::map<std::string, TensorStatistics> m_statistics;
+            size_t m_sample_count;
+        };
+    }
+}
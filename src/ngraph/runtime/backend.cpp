@@ -19,6 +19,7 @@
 #include "ngraph/file_util.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
+#include "ngraph/runtime/executable.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/util.hpp"
 
@@ -39,6 +40,12 @@ vector<string> runtime::Backend::get_registered_devices()
     return BackendManager::get_registered_backends();
 }
 
+shared_ptr<runtime::Executable> runtime::Backend::create_executable(shared_ptr<Function> func)
+{
+    compile(func);
+    return make_shared<Executable>(this, func);
+}
+
 void runtime::Backend::remove_compiled_function(shared_ptr<Function> func)
 {
 }
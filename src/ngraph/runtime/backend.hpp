@@ -27,6 +27,7 @@ namespace ngraph
 {
     namespace runtime
     {
+        class Executable;
         class ExternalFunction;
         class Tensor;
         class Backend;
@@ -103,6 +104,12 @@ public:
         return call(func, outputs, inputs);
     }
 
+    /// \brief Compiles a Function and returns an Executable for it, to bind its input and
+    ///     output tensors to once and then run repeatedly.
+    /// \param func The function to compile
+    /// \returns Executable running func on this backend
+    virtual std::shared_ptr<Executable> create_executable(std::shared_ptr<Function> func);
+
     /// \brief Compiled functions may be cached. This function removes a compiled function
     ///     from the cache.
     /// \param func The function to execute
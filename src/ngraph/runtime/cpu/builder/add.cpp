@@ -19,6 +19,7 @@
 #include "ngraph/op/add.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/kernel/add.hpp"
+#include "ngraph/runtime/cpu/kernel/bf16.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 
@@ -69,7 +70,8 @@ namespace ngraph
                 }
                 else
                 {
-                    BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::add);
+                    BUILD_BINARY_ELEMWISE_FUNCTOR_BF16(runtime::cpu::kernel::add,
+                                                       Eigen::internal::scalar_sum_op<float>);
                 }
             }
 
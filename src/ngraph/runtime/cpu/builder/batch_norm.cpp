@@ -199,7 +199,8 @@ namespace ngraph
                                    out0_tensor,
                                    out1_tensor,
                                    out2_tensor,
-                                   arg2_shape);
+                                   arg2_shape,
+                                   ectx->arena);
                         };
                         functors.emplace_back(functor);
                     }
@@ -233,7 +234,8 @@ namespace ngraph
                                    arg3_tensor,
                                    arg4_tensor,
                                    out0_tensor,
-                                   arg2_shape);
+                                   arg2_shape,
+                                   ectx->arena);
                         };
                         functors.emplace_back(functor);
                     }
@@ -281,7 +283,8 @@ namespace ngraph
                                arg3_tensor,
                                arg4_tensor,
                                out0_tensor,
-                               arg2_shape);
+                               arg2_shape,
+                               ectx->arena);
                     };
                     functors.emplace_back(functor);
                 }
@@ -16,6 +16,7 @@
 
 #include "ngraph/op/convert.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/bf16.hpp"
 #include "ngraph/runtime/cpu/kernel/convert.hpp"
 
 using namespace std;
@@ -39,7 +40,22 @@ namespace ngraph
 
                 std::function<decltype(runtime::cpu::kernel::convert<float, int>)> kernel;
 
-                if (out[0].get_element_type() == element::boolean)
+                if (args[0].get_element_type() == element::bf16 &&
+                    out[0].get_element_type() == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::convert_bf16_to_f32;
+                }
+                else if (args[0].get_element_type() == element::f32 &&
+                         out[0].get_element_type() == element::bf16)
+                {
+                    kernel = runtime::cpu::kernel::convert_f32_to_bf16;
+                }
+                else if (args[0].get_element_type() == element::bf16 ||
+                         out[0].get_element_type() == element::bf16)
+                {
+                    throw ngraph_error("bf16 can only be converted to and from f32");
+                }
+                else if (out[0].get_element_type() == element::boolean)
                 {
                     SELECT_KERNEL(
                         kernel, args[0].get_element_type(), runtime::cpu::kernel::convert_to_i8);
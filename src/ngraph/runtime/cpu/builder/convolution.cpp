@@ -52,16 +52,12 @@ namespace ngraph
                 if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
                 {
                     auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
-                    auto conv_index =
-                        mkldnn_emitter->build_convolution<ngraph::op::Convolution>(node, args, out);
-                    auto& deps = mkldnn_emitter->get_primitive_deps(conv_index);
+                    auto pool =
+                        mkldnn_emitter->build_convolution_pool<ngraph::op::Convolution>(
+                            node, args, out);
 
-                    auto functor = [&, conv_index](CPURuntimeContext* ctx,
-                                                   CPUExecutionContext* ectx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], arg1_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], out_tensor);
-                        cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, conv_index);
+                    auto functor = [&, pool](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        pool->execute({arg0_tensor, arg1_tensor, out_tensor});
                     };
                     functors.emplace_back(functor);
                 }
@@ -69,8 +65,15 @@ namespace ngraph
                 {
                     std::function<decltype(runtime::cpu::kernel::convolution<float>)> kernel;
 
-                    SELECT_KERNEL(
-                        kernel, out[0].get_element_type(), runtime::cpu::kernel::convolution);
+                    if (out[0].get_element_type() == element::bf16)
+                    {
+                        kernel = runtime::cpu::kernel::convolution<bfloat16>;
+                    }
+                    else
+                    {
+                        SELECT_KERNEL(
+                            kernel, out[0].get_element_type(), runtime::cpu::kernel::convolution);
+                    }
 
                     auto window_movement_strides = convolution->get_window_movement_strides();
                     auto window_dilation_strides = convolution->get_window_dilation_strides();
@@ -78,8 +81,10 @@ namespace ngraph
                     auto padding_above = convolution->get_padding_above();
                     auto data_dilation_strides = convolution->get_data_dilation_strides();
 
+                    auto scratch = std::make_shared<runtime::cpu::kernel::ConvolutionScratch>();
                     auto functor = [&,
                                     kernel,
+                                    scratch,
                                     arg0_shape,
                                     arg1_shape,
                                     result_shape,
@@ -106,7 +111,9 @@ namespace ngraph
                                0,
                                0,
                                1,
-                               false);
+                               false,
+                               *scratch,
+                               ectx->arena);
                     };
                     functors.emplace_back(functor);
                 }
@@ -124,17 +131,12 @@ namespace ngraph
                 if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
                 {
                     auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
-                    auto conv_index =
-                        mkldnn_emitter->build_convolution<ngraph::op::ConvolutionRelu>(
+                    auto pool =
+                        mkldnn_emitter->build_convolution_pool<ngraph::op::ConvolutionRelu>(
                             node, args, out);
-                    auto& deps = mkldnn_emitter->get_primitive_deps(conv_index);
 
-                    auto functor = [&, conv_index](CPURuntimeContext* ctx,
-                                                   CPUExecutionContext* ectx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], arg1_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], out_tensor);
-                        cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, conv_index);
+                    auto functor = [&, pool](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        pool->execute({arg0_tensor, arg1_tensor, out_tensor});
                     };
                     functors.emplace_back(functor);
                 }
@@ -157,18 +159,12 @@ namespace ngraph
                 if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
                 {
                     auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
-                    auto conv_index =
-                        mkldnn_emitter->build_convolution<ngraph::op::ConvolutionBias>(
+                    auto pool =
+                        mkldnn_emitter->build_convolution_pool<ngraph::op::ConvolutionBias>(
                             node, args, out);
-                    auto& deps = mkldnn_emitter->get_primitive_deps(conv_index);
 
-                    auto functor = [&, conv_index](CPURuntimeContext* ctx,
-                                                   CPUExecutionContext* ectx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], arg1_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], arg2_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[3], out_tensor);
-                        cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, conv_index);
+                    auto functor = [&, pool](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        pool->execute({arg0_tensor, arg1_tensor, arg2_tensor, out_tensor});
                     };
                     functors.emplace_back(functor);
                 }
@@ -191,18 +187,12 @@ namespace ngraph
                 if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
                 {
                     auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
-                    auto conv_index =
-                        mkldnn_emitter->build_convolution<ngraph::op::ConvolutionBiasAdd>(
+                    auto pool =
+                        mkldnn_emitter->build_convolution_pool<ngraph::op::ConvolutionBiasAdd>(
                             node, args, out);
-                    auto& deps = mkldnn_emitter->get_primitive_deps(conv_index);
 
-                    auto functor = [&, conv_index](CPURuntimeContext* ctx,
-                                                   CPUExecutionContext* ectx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], arg1_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], arg2_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[3], out_tensor);
-                        cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, conv_index);
+                    auto functor = [&, pool](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        pool->execute({arg0_tensor, arg1_tensor, arg2_tensor, out_tensor});
                     };
                     functors.emplace_back(functor);
                 }
@@ -224,16 +214,12 @@ namespace ngraph
                 if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
                 {
                     auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
-                    auto conv_index = mkldnn_emitter->build_convolution<ngraph::op::ConvolutionAdd>(
-                        node, args, out);
-                    auto& deps = mkldnn_emitter->get_primitive_deps(conv_index);
+                    auto pool =
+                        mkldnn_emitter->build_convolution_pool<ngraph::op::ConvolutionAdd>(
+                            node, args, out);
 
-                    auto functor = [&, conv_index](CPURuntimeContext* ctx,
-                                                   CPUExecutionContext* ectx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], arg1_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], out_tensor);
-                        cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, conv_index);
+                    auto functor = [&, pool](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        pool->execute({arg0_tensor, arg1_tensor, out_tensor});
                     };
                     functors.emplace_back(functor);
                 }
@@ -280,8 +266,15 @@ namespace ngraph
                 {
                     std::function<decltype(runtime::cpu::kernel::convolution<float>)> kernel;
 
-                    SELECT_KERNEL(
-                        kernel, out[0].get_element_type(), runtime::cpu::kernel::convolution);
+                    if (out[0].get_element_type() == element::bf16)
+                    {
+                        kernel = runtime::cpu::kernel::convolution<bfloat16>;
+                    }
+                    else
+                    {
+                        SELECT_KERNEL(
+                            kernel, out[0].get_element_type(), runtime::cpu::kernel::convolution);
+                    }
 
                     auto window_movement_strides =
                         convolution->get_window_movement_strides_backward();
@@ -291,8 +284,10 @@ namespace ngraph
                     auto padding_above = convolution->get_padding_above_backward();
                     auto data_dilation_strides = convolution->get_data_dilation_strides_backward();
 
+                    auto scratch = std::make_shared<runtime::cpu::kernel::ConvolutionScratch>();
                     auto functor = [&,
                                     kernel,
+                                    scratch,
                                     arg0_shape,
                                     arg1_shape,
                                     result_shape,
@@ -319,7 +314,9 @@ namespace ngraph
                                1,
                                0,
                                1,
-                               true);
+                               true,
+                               *scratch,
+                               ectx->arena);
                     };
                     functors.emplace_back(functor);
                 }
@@ -362,8 +359,15 @@ namespace ngraph
                 {
                     std::function<decltype(runtime::cpu::kernel::convolution<float>)> kernel;
 
-                    SELECT_KERNEL(
-                        kernel, out[0].get_element_type(), runtime::cpu::kernel::convolution);
+                    if (out[0].get_element_type() == element::bf16)
+                    {
+                        kernel = runtime::cpu::kernel::convolution<bfloat16>;
+                    }
+                    else
+                    {
+                        SELECT_KERNEL(
+                            kernel, out[0].get_element_type(), runtime::cpu::kernel::convolution);
+                    }
 
                     auto window_movement_strides =
                         convolution->get_window_movement_strides_backward();
@@ -373,8 +377,10 @@ namespace ngraph
                     auto padding_above = convolution->get_padding_above_backward();
                     auto data_dilation_strides = convolution->get_data_dilation_strides_backward();
 
+                    auto scratch = std::make_shared<runtime::cpu::kernel::ConvolutionScratch>();
                     auto functor = [&,
                                     kernel,
+                                    scratch,
                                     arg0_shape,
                                     arg1_shape,
                                     result_shape,
@@ -401,7 +407,9 @@ namespace ngraph
                                1,
                                1,
                                0,
-                               false);
+                               false,
+                               *scratch,
+                               ectx->arena);
                     };
                     functors.emplace_back(functor);
                 }
@@ -20,7 +20,9 @@
 #include "ngraph/op/dot.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/kernel/bf16.hpp"
 #include "ngraph/runtime/cpu/kernel/dot.hpp"
+#include "ngraph/runtime/cpu/kernel/packed_gemm.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -65,6 +67,28 @@ namespace ngraph
                     return;
                 }
 
+                if (out[0].get_element_type() == element::bf16)
+                {
+                    // The reduced axes are trailing in arg0 and leading in arg1, so in row-major
+                    // order every Dot, scalar ones included, is an [m, k] x [k, n] product
+                    size_t k = 1;
+                    for (size_t i = 0; i < reduction_axes_count; i++)
+                    {
+                        k *= arg1_shape[i];
+                    }
+                    size_t m = shape_size(arg0_shape) / k;
+                    size_t n = shape_size(arg1_shape) / k;
+
+                    auto scratch = make_shared<runtime::cpu::kernel::bf16::MatmulScratch>();
+                    auto functor = [&, m, k, n, scratch](CPURuntimeContext* ctx,
+                                                         CPUExecutionContext* ectx) {
+                        runtime::cpu::kernel::bf16_matmul(
+                            arg0_tensor, arg1_tensor, out_tensor, m, k, n, *scratch, ectx->arena);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
                 if (arg0_shape.empty() || arg1_shape.empty())
                 {
                     auto first = (arg0_shape.empty() ? args[0] : args[1]);
@@ -164,6 +188,34 @@ namespace ngraph
                     auto lda = arg0_shape[1];
                     auto ldb = arg1_shape[1];
                     const float beta = 0.0f;
+
+                    if (node->get_argument(1)->is_constant())
+                    {
+                        // Pack constant weights once instead of on every sgemm call
+                        auto packed_weights = make_shared<kernel::PackedSgemmWeights>(
+                            transpose_B,
+                            m,
+                            n,
+                            k,
+                            static_cast<const float*>(arg1_tensor),
+                            max(1UL, ldb));
+                        external_function->add_constant_repack(
+                            args[1].get_name(), [packed_weights](const void* weights) {
+                                packed_weights->pack(static_cast<const float*>(weights));
+                            });
+                        auto functor = [&, packed_weights, transpose_A, lda, beta, result_shape](
+                            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            packed_weights->compute(transpose_A,
+                                                    static_cast<float*>(arg0_tensor),
+                                                    max(1UL, lda),
+                                                    beta,
+                                                    static_cast<float*>(out_tensor),
+                                                    max(1UL, result_shape[1]));
+                        };
+                        functors.emplace_back(functor);
+                        return;
+                    }
+
                     auto functor =
                         [&, transpose_A, transpose_B, m, n, k, lda, ldb, beta, result_shape](
                             CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
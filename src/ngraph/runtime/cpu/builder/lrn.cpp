@@ -16,9 +16,9 @@
 
 #include "ngraph/op/lrn.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/lrn.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
-#include "ngraph/runtime/reference/lrn.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -66,41 +66,35 @@ namespace ngraph
                     double alpha = lrn->get_alpha();
                     double beta = lrn->get_beta();
                     double bias = lrn->get_bias();
-                    double nsize = lrn->get_nsize();
+                    size_t nsize = lrn->get_nsize();
                     Shape arg_shape = args[0].get_shape();
 
+                    std::function<decltype(runtime::cpu::kernel::lrn<float>)> kernel;
                     auto element_type = lrn->get_element_type();
                     if (element_type == element::f32)
                     {
-                        functor = [&, alpha, beta, bias, arg_shape, nsize](
-                            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::lrn<float>(static_cast<float*>(arg_tensor),
-                                                                   static_cast<float*>(out_tensor),
-                                                                   arg_shape,
-                                                                   alpha,
-                                                                   beta,
-                                                                   bias,
-                                                                   nsize);
-                        };
+                        kernel = runtime::cpu::kernel::lrn<float>;
                     }
                     else if (element_type == element::f64)
                     {
-                        functor = [&, alpha, beta, bias, arg_shape, nsize](
-                            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::lrn<double>(
-                                static_cast<double*>(arg_tensor),
-                                static_cast<double*>(out_tensor),
-                                arg_shape,
-                                alpha,
-                                beta,
-                                bias,
-                                nsize);
-                        };
+                        kernel = runtime::cpu::kernel::lrn<double>;
                     }
                     else
                     {
                         throw ngraph_error("Unsupported type in CPU Builder for LRN");
                     }
+
+                    functor = [&, kernel, alpha, beta, bias, arg_shape, nsize](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel(arg_tensor,
+                               out_tensor,
+                               arg_shape,
+                               alpha,
+                               beta,
+                               bias,
+                               nsize,
+                               ectx->arena);
+                    };
                 }
 
                 functors.emplace_back(functor);
@@ -17,6 +17,7 @@
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/kernel/packed_gemm.hpp"
 #include "ngraph/runtime/cpu/op/batch_dot.hpp"
 
 using namespace std;
@@ -66,8 +67,34 @@ namespace ngraph
 
                 const float beta = 0.0f;
 
-                auto mm_functor =
-                    [&, transpose_A, transpose_B, m, n, k, lda, ldb, beta, arg2_shape](
+                CPUKernelFunctor mm_functor;
+                if (node->get_argument(1)->is_constant())
+                {
+                    // Constant weights are packed once here instead of on every sgemm call
+                    auto packed_weights = make_shared<kernel::PackedSgemmWeights>(
+                        transpose_B,
+                        m,
+                        n,
+                        k,
+                        static_cast<const float*>(arg1_tensor),
+                        max(1UL, ldb));
+                    external_function->add_constant_repack(
+                        args[1].get_name(), [packed_weights](const void* weights) {
+                            packed_weights->pack(static_cast<const float*>(weights));
+                        });
+                    mm_functor = [&, packed_weights, transpose_A, lda, beta, arg2_shape](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        packed_weights->compute(transpose_A,
+                                                static_cast<float*>(arg0_tensor),
+                                                max(1UL, lda),
+                                                beta,
+                                                static_cast<float*>(out0_tensor),
+                                                max(1UL, arg2_shape[1]));
+                    };
+                }
+                else
+                {
+                    mm_functor = [&, transpose_A, transpose_B, m, n, k, lda, ldb, beta, arg2_shape](
                         CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
                         cblas::cblas_sgemm(
                             cblas::Layout::RowMajor,
@@ -85,6 +112,7 @@ namespace ngraph
                             static_cast<float*>(out0_tensor),
                             max(1UL, arg2_shape[1]));
                     };
+                }
 
                 CPUKernelFunctor bias_functor = [](CPURuntimeContext* ctx,
                                                    CPUExecutionContext* ectx) {};
@@ -0,0 +1,122 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/experimental/quantized_dot.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/quantized_dot.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <typename OP>
+            static void build_quantized_dot(CPU_ExternalFunction* external_function,
+                                            const ngraph::Node* node,
+                                            const vector<TensorViewWrapper>& args,
+                                            const vector<TensorViewWrapper>& out,
+                                            bool has_bias)
+            {
+                auto qdot = static_cast<const OP*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
+                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
+                auto& bias_tensor = external_function->get_tensor_data(args[2].get_name());
+                auto& scale_tensor =
+                    external_function->get_tensor_data(args[has_bias ? 3 : 2].get_name());
+                auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());
+
+                auto& weights_shape = args[1].get_shape();
+                size_t k = weights_shape[0];
+                size_t m = weights_shape[1];
+                size_t rows = shape_size(out[0].get_shape()) / m;
+                bool requantize = qdot->get_requantize();
+                bool with_relu = qdot->with_relu();
+                auto out_type = out[0].get_element_type();
+
+                if (rows * m == 0)
+                {
+                    functors.emplace_back([](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {});
+                    return;
+                }
+
+                // i32 accumulators for the requantizing variants; the unrequantized product is
+                // accumulated straight into the output
+                auto acc = make_shared<vector<int32_t>>(requantize ? rows * m : 0);
+
+                std::function<decltype(runtime::cpu::kernel::quantized_dot<int8_t>)> kernel;
+                if (out_type == element::u8)
+                {
+                    kernel = runtime::cpu::kernel::quantized_dot<uint8_t>;
+                }
+                else if (out_type == element::i8)
+                {
+                    kernel = runtime::cpu::kernel::quantized_dot<int8_t>;
+                }
+                else if (out_type == element::i32)
+                {
+                    kernel = runtime::cpu::kernel::quantized_dot<int32_t>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported output element type for " +
+                                       node->description());
+                }
+
+                auto functor = [&, kernel, acc, has_bias, rows, k, m, requantize, with_relu](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    int32_t* acc_ptr =
+                        requantize ? acc->data() : static_cast<int32_t*>(out0_tensor);
+                    kernel(arg0_tensor,
+                           arg1_tensor,
+                           has_bias ? bias_tensor : nullptr,
+                           static_cast<float*>(scale_tensor)[0],
+                           out0_tensor,
+                           acc_ptr,
+                           rows,
+                           k,
+                           m,
+                           requantize,
+                           with_relu,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::QuantizedDot)
+            {
+                build_quantized_dot<ngraph::op::QuantizedDot>(
+                    external_function, node, args, out, false);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::QuantizedDotBias)
+            {
+                build_quantized_dot<ngraph::op::QuantizedDotBias>(
+                    external_function, node, args, out, true);
+            }
+
+            REGISTER_OP_BUILDER(QuantizedDot);
+            REGISTER_OP_BUILDER(QuantizedDotBias);
+        }
+    }
+}
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include "ngraph/runtime/cpu/kernel/reduce_function.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/op/reduce.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
@@ -37,13 +38,6 @@ namespace ngraph
                 auto function = reduce->get_functions()[0];
 
                 auto& functors = external_function->get_functors();
-                auto& callees = external_function->get_callees();
-
-                if (!callees.count(function->get_name()))
-                {
-                    callees[function->get_name()] = make_shared<CPU_ExternalFunction>(function);
-                }
-                auto& reducer_external_function = callees[function->get_name()];
 
                 auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
                 auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
@@ -53,70 +47,25 @@ namespace ngraph
                 auto out_shape = out[0].get_shape();
 
                 auto reduction_axes = reduce->get_reduction_axes();
-
-                if (reduction_axes.empty())
+                auto reduction_op = runtime::cpu::kernel::get_reduction_op(function);
+                // Only functions without an inline equivalent are called, through a call frame
+                // that is set up here once rather than on every execution. The tensor slots the
+                // frame is pinned to belong to the compiled function, so every op compiles its
+                // own copy rather than sharing a callee with other ops.
+                shared_ptr<runtime::cpu::kernel::FunctionReducer> reducer;
+                if (reduction_op == runtime::cpu::kernel::ReductionOp::Function)
                 {
-                    size_t size = args[0].get_size() * args[0].get_element_type().size();
-                    auto functor = [&, size](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        memcpy(out_tensor, arg0_tensor, size);
-                    };
-                    functors.emplace_back(functor);
-                }
-                else if (reduction_axes.size() == 1)
-                {
-                    std::function<decltype(runtime::cpu::kernel::reduce_function_1rd<float, 1>)>
-                        kernel;
-
-                    SELECT_KERNEL_BY_RANK(kernel,
-                                          args[0].get_element_type(),
-                                          arg0_shape.size(),
-                                          runtime::cpu::kernel::reduce_function_1rd);
-
-                    auto functor = [&, kernel, arg0_shape, out_shape, reduction_axes](
-                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        kernel(arg0_tensor,
-                               arg1_tensor,
-                               out_tensor,
-                               arg0_shape,
-                               out_shape,
-                               reduction_axes,
-                               ectx->arena,
-                               reducer_external_function);
-                    };
-                    functors.emplace_back(functor);
+                    reducer = make_shared<runtime::cpu::kernel::FunctionReducer>(
+                        make_shared<CPU_ExternalFunction>(clone_function(*function)));
                 }
-                else if (arg0_shape.size() == 2 && reduction_axes.size() == 2)
-                {
-                    std::function<decltype(runtime::cpu::kernel::reduce_function_2d_2rd<float>)>
-                        kernel;
 
-                    SELECT_KERNEL(kernel,
-                                  args[0].get_element_type(),
-                                  runtime::cpu::kernel::reduce_function_2d_2rd);
-
-                    auto functor = [&, kernel, arg0_shape, out_shape, reduction_axes](
-                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        kernel(arg0_tensor,
-                               arg1_tensor,
-                               out_tensor,
-                               arg0_shape,
-                               out_shape,
-                               reduction_axes,
-                               ectx->arena,
-                               reducer_external_function);
-                    };
-                    functors.emplace_back(functor);
-                }
-                else if (arg0_shape.size() == 3 && reduction_axes.size() == 2)
-                {
-                    std::function<decltype(runtime::cpu::kernel::reduce_function_3d_2rd<float>)>
-                        kernel;
+                std::function<decltype(runtime::cpu::kernel::reduce_function<float>)> kernel;
 
-                    SELECT_KERNEL(kernel,
-                                  args[0].get_element_type(),
-                                  runtime::cpu::kernel::reduce_function_3d_2rd);
+                SELECT_KERNEL(
+                    kernel, args[0].get_element_type(), runtime::cpu::kernel::reduce_function);
 
-                    auto functor = [&, kernel, arg0_shape, out_shape, reduction_axes](
+                auto functor =
+                    [&, kernel, arg0_shape, out_shape, reduction_axes, reduction_op, reducer](
                         CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
                         kernel(arg0_tensor,
                                arg1_tensor,
@@ -124,15 +73,11 @@ namespace ngraph
                                arg0_shape,
                                out_shape,
                                reduction_axes,
-                               ectx->arena,
-                               reducer_external_function);
+                               reduction_op,
+                               reducer.get(),
+                               ectx->arena);
                     };
-                    functors.emplace_back(functor);
-                }
-                else
-                {
-                    throw ngraph_error("Unsupported Reduce");
-                }
+                functors.emplace_back(functor);
             }
 
             REGISTER_OP_BUILDER(Reduce);
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include "ngraph/runtime/cpu/kernel/reduce_function_window.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/op/reduce_window.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
@@ -36,13 +37,6 @@ namespace ngraph
                 auto function = reduce_window->get_functions()[0];
 
                 auto& functors = external_function->get_functors();
-                auto& callees = external_function->get_callees();
-
-                if (!callees.count(function->get_name()))
-                {
-                    callees[function->get_name()] = make_shared<CPU_ExternalFunction>(function);
-                }
-                auto& reducer_external_function = callees[function->get_name()];
 
                 auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
                 auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
@@ -53,6 +47,17 @@ namespace ngraph
 
                 auto window_shape = reduce_window->get_window_shape();
                 auto window_movement_strides = reduce_window->get_window_movement_strides();
+                auto reduction_op = runtime::cpu::kernel::get_reduction_op(function);
+                // Only functions without an inline equivalent are called, through a call frame
+                // that is set up here once rather than on every execution. The tensor slots the
+                // frame is pinned to belong to the compiled function, so every op compiles its
+                // own copy rather than sharing a callee with other ops.
+                shared_ptr<runtime::cpu::kernel::FunctionReducer> reducer;
+                if (reduction_op == runtime::cpu::kernel::ReductionOp::Function)
+                {
+                    reducer = make_shared<runtime::cpu::kernel::FunctionReducer>(
+                        make_shared<CPU_ExternalFunction>(clone_function(*function)));
+                }
 
                 std::function<decltype(runtime::cpu::kernel::reduce_function_window<float>)> kernel;
 
@@ -60,18 +65,24 @@ namespace ngraph
                               args[0].get_element_type(),
                               runtime::cpu::kernel::reduce_function_window);
 
-                auto functor =
-                    [&, kernel, arg0_shape, out_shape, window_shape, window_movement_strides](
-                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        kernel(arg0_tensor,
-                               arg1_tensor,
-                               out_tensor,
-                               arg0_shape,
-                               out_shape,
-                               window_shape,
-                               window_movement_strides,
-                               reducer_external_function);
-                    };
+                auto functor = [&,
+                                kernel,
+                                arg0_shape,
+                                out_shape,
+                                window_shape,
+                                window_movement_strides,
+                                reduction_op,
+                                reducer](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    kernel(arg0_tensor,
+                           arg1_tensor,
+                           out_tensor,
+                           arg0_shape,
+                           out_shape,
+                           window_shape,
+                           window_movement_strides,
+                           reduction_op,
+                           reducer.get());
+                };
                 functors.emplace_back(functor);
             }
 
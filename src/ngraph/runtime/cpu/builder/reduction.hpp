@@ -14,6 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 
+#pragma once
+
+#include "ngraph/runtime/cpu/kernel/reduction.hpp"
+
 #define BUILD_REDUCTION_FUNCTOR(OP, K)                                                             \
     auto& functors = external_function->get_functors();                                            \
                                                                                                    \
@@ -22,13 +26,23 @@
                                                                                                    \
     auto op = static_cast<const ngraph::op::OP*>(node);                                            \
                                                                                                    \
-    auto arg_shape = args[0].get_shape();                                                          \
-    auto arg_rank = arg_shape.size();                                                              \
-                                                                                                   \
-    auto result_shape = out[0].get_shape();                                                        \
     auto& result_element_type = out[0].get_element_type();                                         \
                                                                                                    \
+    /* Unit axes are dropped and adjacent axes that are all reduced or all kept are merged, so     \
+       most reductions, whatever their rank, map onto one of the Eigen kernels below. */           \
+    auto arg_shape = args[0].get_shape();                                                          \
     auto reduction_axes = op->get_reduction_axes();                                                \
+    runtime::cpu::kernel::coalesce_reduction_axes(arg_shape, reduction_axes);                      \
+    auto arg_rank = arg_shape.size();                                                              \
+                                                                                                   \
+    Shape result_shape;                                                                            \
+    for (size_t i = 0; i < arg_rank; i++)                                                          \
+    {                                                                                              \
+        if (reduction_axes.count(i) == 0)                                                          \
+        {                                                                                          \
+            result_shape.push_back(arg_shape[i]);                                                  \
+        }                                                                                          \
+    }                                                                                              \
                                                                                                    \
     if (reduction_axes.empty())                                                                    \
     {                                                                                              \
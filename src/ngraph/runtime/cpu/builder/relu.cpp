@@ -17,6 +17,7 @@
 #include "ngraph/runtime/cpu/kernel/relu.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/bf16.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 
@@ -57,7 +58,8 @@ namespace ngraph
                 }
                 else
                 {
-                    BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::relu);
+                    BUILD_UNARY_ELEMWISE_FUNCTOR_BF16(runtime::cpu::kernel::relu,
+                                                      runtime::cpu::kernel::bf16::relu);
                 }
             }
 
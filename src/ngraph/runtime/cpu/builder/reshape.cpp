@@ -68,11 +68,9 @@ namespace ngraph
                 }
 
                 auto arg_shape = args[0].get_shape();
-                auto arg_rank = arg_shape.size();
 
                 auto result_shape = out[0].get_shape();
-                auto result_rank = result_shape.size();
-                auto& result_element_type = out[0].get_element_type();
+                auto& result_element_type = get_movement_element_type(out[0].get_element_type());
 
                 auto input_order = reshape->get_input_order();
 
@@ -90,26 +88,43 @@ namespace ngraph
                     return;
                 }
 
-                std::function<decltype(runtime::cpu::kernel::reshape_1d<float, 2>)> kernel;
-                if (arg_rank == 1)
+                // Dropping unit axes and merging axes that stay adjacent usually brings the
+                // permutation down to a rank the Eigen kernels are instantiated for
+                Shape in_shape = arg_shape;
+                AxisVector in_order = input_order;
+                runtime::cpu::kernel::coalesce_transpose(in_shape, in_order);
+                auto rank = in_shape.size();
+                if (rank <= 1)
                 {
-                    SELECT_KERNEL_BY_RANK(
-                        kernel, result_element_type, result_rank, runtime::cpu::kernel::reshape_1d);
+                    size_t size = out[0].get_size() * out[0].get_element_type().size();
+                    auto functor = [&, size](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        memcpy(out_tensor, arg_tensor, size);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
+                Shape out_shape;
+                for (auto axis : in_order)
+                {
+                    out_shape.push_back(in_shape[axis]);
                 }
-                else if (arg_rank == 2)
+
+                std::function<decltype(runtime::cpu::kernel::reshape_1d<float, 2>)> kernel;
+                if (rank == 2)
                 {
                     SELECT_KERNEL_BY_RANK(
-                        kernel, result_element_type, result_rank, runtime::cpu::kernel::reshape_2d);
+                        kernel, result_element_type, rank, runtime::cpu::kernel::reshape_2d);
                 }
-                else if (arg_rank == 3)
+                else if (rank == 3)
                 {
                     SELECT_KERNEL_BY_RANK(
-                        kernel, result_element_type, result_rank, runtime::cpu::kernel::reshape_3d);
+                        kernel, result_element_type, rank, runtime::cpu::kernel::reshape_3d);
                 }
-                else if (arg_rank == 4)
+                else if (rank == 4)
                 {
                     SELECT_KERNEL_BY_RANK(
-                        kernel, result_element_type, result_rank, runtime::cpu::kernel::reshape_4d);
+                        kernel, result_element_type, rank, runtime::cpu::kernel::reshape_4d);
                 }
                 else
                 {
@@ -117,23 +132,18 @@ namespace ngraph
 
                     SELECT_KERNEL(ref_kernel, result_element_type, runtime::cpu::kernel::reshape);
 
-                    auto functor = [&, ref_kernel, arg_shape, input_order, result_shape](
+                    auto functor = [&, ref_kernel, in_shape, in_order, out_shape](
                         CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        ref_kernel(arg_tensor,
-                                   out_tensor,
-                                   arg_shape,
-                                   input_order,
-                                   result_shape,
-                                   ectx->arena);
+                        ref_kernel(
+                            arg_tensor, out_tensor, in_shape, in_order, out_shape, ectx->arena);
                     };
                     functors.emplace_back(functor);
                     return;
                 }
 
-                auto functor = [&, kernel, arg_shape, input_order, result_shape](
+                auto functor = [&, kernel, in_shape, in_order, out_shape](
                     CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                    kernel(
-                        arg_tensor, out_tensor, arg_shape, input_order, result_shape, ectx->arena);
+                    kernel(arg_tensor, out_tensor, in_shape, in_order, out_shape, ectx->arena);
                 };
                 functors.emplace_back(functor);
             }
@@ -17,6 +17,7 @@
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
+#include "ngraph/runtime/cpu/mkldnn_packed_rnn.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 
 using namespace std;
@@ -48,6 +49,27 @@ namespace ngraph
                 auto& dst_layer_tensor = external_function->get_tensor_data(out[0].get_name());
                 auto& dst_iter_tensor = external_function->get_tensor_data(out[1].get_name());
 
+                auto rnn = static_cast<const ngraph::op::Rnn*>(node);
+                if (rnn->has_sequence_lengths())
+                {
+                    auto& sequence_lengths_tensor =
+                        external_function->get_tensor_data(args[5].get_name());
+                    auto packed_rnn = std::make_shared<MKLDNNPackedRnn>(rnn);
+                    auto functor = [&, packed_rnn](CPURuntimeContext* ctx,
+                                                   CPUExecutionContext* ectx) {
+                        packed_rnn->execute(static_cast<float*>(src_layer_tensor),
+                                            static_cast<float*>(src_iter_tensor),
+                                            static_cast<float*>(weights_layer_tensor),
+                                            static_cast<float*>(weights_iter_tensor),
+                                            static_cast<float*>(bias_tensor),
+                                            static_cast<int32_t*>(sequence_lengths_tensor),
+                                            static_cast<float*>(dst_layer_tensor),
+                                            static_cast<float*>(dst_iter_tensor));
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
                 auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
                 auto rnn_index = mkldnn_emitter->build_rnn<ngraph::op::Rnn>(node, args, out);
                 auto& deps = mkldnn_emitter->get_primitive_deps(rnn_index);
@@ -43,6 +43,7 @@ namespace ngraph
 
                 auto arg_shape = args[0].get_shape();
                 auto out_shape = out[0].get_shape();
+                auto& element_type = get_movement_element_type(args[0].get_element_type());
 
                 auto strides = slice->get_strides();
                 auto lower_bounds = slice->get_lower_bounds();
@@ -106,7 +107,7 @@ namespace ngraph
                             kernel;
 
                         SELECT_KERNEL_BY_RANK(kernel,
-                                              args[0].get_element_type(),
+                                              element_type,
                                               arg_shape.size(),
                                               runtime::cpu::kernel::strided_slice);
 
@@ -129,7 +130,7 @@ namespace ngraph
                         std::function<decltype(runtime::cpu::kernel::slice<float, 2>)> kernel;
 
                         SELECT_KERNEL_BY_RANK(kernel,
-                                              args[0].get_element_type(),
+                                              element_type,
                                               arg_shape.size(),
                                               runtime::cpu::kernel::slice);
 
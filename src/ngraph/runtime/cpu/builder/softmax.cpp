@@ -19,7 +19,6 @@
 #include "ngraph/runtime/cpu/kernel/softmax.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
-#include "ngraph/runtime/reference/softmax.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -151,16 +150,23 @@ namespace ngraph
                         };
                         functors.emplace_back(functor);
                     }
-                    else if (softmax->get_element_type() == element::f32)
+                    else if (softmax->get_element_type() == element::f32 ||
+                             softmax->get_element_type() == element::f64)
                     {
-                        NGRAPH_WARN << "Falling back to refernce kernel for softmax " << arg_shape
-                                    << " over " << axes;
-                        auto functor = [&, arg_shape, axes](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* ectx) {
-                            runtime::reference::softmax<float>(static_cast<float*>(arg_tensor),
-                                                               static_cast<float*>(out_tensor),
-                                                               arg_shape,
-                                                               axes);
+                        std::function<decltype(runtime::cpu::kernel::softmax_any_axes<float>)>
+                            kernel;
+                        if (softmax->get_element_type() == element::f32)
+                        {
+                            kernel = runtime::cpu::kernel::softmax_any_axes<float>;
+                        }
+                        else
+                        {
+                            kernel = runtime::cpu::kernel::softmax_any_axes<double>;
+                        }
+
+                        auto functor = [&, kernel, arg_shape, axes](CPURuntimeContext* ctx,
+                                                                    CPUExecutionContext* ectx) {
+                            kernel(arg_tensor, out_tensor, arg_shape, axes, ectx->arena);
                         };
                         functors.emplace_back(functor);
                     }
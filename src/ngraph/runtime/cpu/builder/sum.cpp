@@ -18,6 +18,7 @@
 
 #include "ngraph/op/sum.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/bf16.hpp"
 #include "ngraph/runtime/cpu/kernel/reduce_sum.hpp"
 
 #include "reduction.hpp"
@@ -34,6 +35,48 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Sum)
             {
+                if (args[0].get_element_type() == element::bf16)
+                {
+                    auto& functors = external_function->get_functors();
+                    auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
+                    auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+
+                    // bf16 sums are only taken over trailing axes, ignoring axes of length
+                    // one; CPUBF16Fallback sends the rest through f32
+                    auto reduction_axes = static_cast<const ngraph::op::Sum*>(node)
+                                              ->get_reduction_axes();
+                    auto arg_shape = args[0].get_shape();
+                    size_t outer = 1;
+                    size_t inner = 1;
+                    for (size_t i = 0; i < arg_shape.size(); i++)
+                    {
+                        if (arg_shape[i] == 1)
+                        {
+                            continue;
+                        }
+                        if (reduction_axes.count(i) != 0)
+                        {
+                            inner *= arg_shape[i];
+                        }
+                        else if (inner == 1)
+                        {
+                            outer *= arg_shape[i];
+                        }
+                        else
+                        {
+                            throw ngraph_error("bf16 Sum only reduces trailing axes");
+                        }
+                    }
+
+                    auto functor = [&, outer, inner](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                        runtime::cpu::kernel::bf16_reduce_sum_innermost(
+                            arg_tensor, out_tensor, outer, inner, ectx->arena);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
                 BUILD_REDUCTION_FUNCTOR(Sum, sum);
             }
 
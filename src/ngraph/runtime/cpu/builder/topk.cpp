@@ -18,7 +18,7 @@
 
 #include "ngraph/op/topk.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/topk.hpp"
+#include "ngraph/runtime/cpu/kernel/topk.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -47,7 +47,6 @@ namespace ngraph
                 bool is_int64 = out[0].get_element_type() == element::i64;
                 auto axis = topk->get_top_k_axis();
                 auto in_shape = args[0].get_shape();
-                auto out_shape = out[0].get_shape();
                 auto k = topk->get_k();
                 auto compute_max = topk->get_compute_max();
 
@@ -56,32 +55,32 @@ namespace ngraph
                 {
                     if (is_int64)
                     {
-                        functor = [&, in_shape, out_shape, axis, k, compute_max](
+                        functor = [&, in_shape, axis, k, compute_max](
                             CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::topk<float, int64_t>(
+                            runtime::cpu::kernel::topk<float, int64_t>(
                                 static_cast<float*>(arg_tensor),
                                 static_cast<int64_t*>(out_indices_tensor),
                                 static_cast<float*>(out_values_tensor),
                                 in_shape,
-                                out_shape,
                                 axis,
                                 k,
-                                compute_max);
+                                compute_max,
+                                ectx->arena);
                         };
                     }
                     else
                     {
-                        functor = [&, in_shape, out_shape, axis, k, compute_max](
+                        functor = [&, in_shape, axis, k, compute_max](
                             CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::topk<float, int32_t>(
+                            runtime::cpu::kernel::topk<float, int32_t>(
                                 static_cast<float*>(arg_tensor),
                                 static_cast<int32_t*>(out_indices_tensor),
                                 static_cast<float*>(out_values_tensor),
                                 in_shape,
-                                out_shape,
                                 axis,
                                 k,
-                                compute_max);
+                                compute_max,
+                                ectx->arena);
                         };
                     }
                 }
@@ -89,32 +88,32 @@ namespace ngraph
                 {
                     if (is_int64)
                     {
-                        functor = [&, in_shape, out_shape, axis, k, compute_max](
+                        functor = [&, in_shape, axis, k, compute_max](
                             CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::topk<double, int64_t>(
+                            runtime::cpu::kernel::topk<double, int64_t>(
                                 static_cast<double*>(arg_tensor),
                                 static_cast<int64_t*>(out_indices_tensor),
                                 static_cast<double*>(out_values_tensor),
                                 in_shape,
-                                out_shape,
                                 axis,
                                 k,
-                                compute_max);
+                                compute_max,
+                                ectx->arena);
                         };
                     }
                     else
                     {
-                        functor = [&, in_shape, out_shape, axis, k, compute_max](
+                        functor = [&, in_shape, axis, k, compute_max](
                             CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::topk<double, int32_t>(
+                            runtime::cpu::kernel::topk<double, int32_t>(
                                 static_cast<double*>(arg_tensor),
                                 static_cast<int32_t*>(out_indices_tensor),
                                 static_cast<double*>(out_values_tensor),
                                 in_shape,
-                                out_shape,
                                 axis,
                                 k,
-                                compute_max);
+                                compute_max,
+                                ectx->arena);
                         };
                     }
                 }
@@ -20,6 +20,7 @@
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_executable.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/util.hpp"
@@ -74,6 +75,16 @@ runtime::Handle runtime::cpu::CPU_Backend::compile(shared_ptr<Function> func)
     {
         instance.m_external_function = make_shared<CPU_ExternalFunction>(func);
         instance.m_external_function->m_emit_timing = instance.m_performance_counters_enabled;
+        instance.m_external_function->m_inter_op_parallelism = instance.m_inter_op_parallelism;
+        instance.m_external_function->m_frozen = instance.m_frozen;
+        instance.m_external_function->m_constant_updates = instance.m_constant_updates;
+        instance.m_external_function->m_layout_cost_model = instance.m_layout_cost_model;
+        if (instance.m_optimization_level >= 0)
+        {
+            instance.m_external_function->m_optimization_level =
+                static_cast<size_t>(instance.m_optimization_level);
+        }
+        instance.m_external_function->m_constant_store = m_constant_store;
         auto cf = instance.m_external_function->make_call_frame();
         instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
     }
@@ -96,6 +107,15 @@ std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame>
     return instance.m_call_frame;
 }
 
+shared_ptr<runtime::Executable>
+    runtime::cpu::CPU_Backend::create_executable(shared_ptr<Function> func)
+{
+    compile(func);
+    FunctionInstance& instance = m_function_map[func];
+    return make_shared<CPU_Executable>(
+        this, func, instance.m_external_function, instance.m_call_frame);
+}
+
 bool runtime::cpu::CPU_Backend::call(shared_ptr<Function> func,
                                      const vector<shared_ptr<runtime::Tensor>>& outputs,
                                      const vector<shared_ptr<runtime::Tensor>>& inputs)
@@ -128,6 +148,119 @@ void runtime::cpu::CPU_Backend::enable_performance_data(shared_ptr<Function> fun
     instance.m_performance_counters_enabled = enable;
 }
 
+void runtime::cpu::CPU_Backend::set_inter_op_parallelism(shared_ptr<Function> func,
+                                                         size_t parallelism)
+{
+    if (parallelism < 1)
+    {
+        throw ngraph_error("Inter-op parallelism must be at least 1");
+    }
+    FunctionInstance& instance = m_function_map[func];
+    if (instance.m_external_function != nullptr)
+    {
+        throw runtime_error("Inter-op parallelism must be set prior to compiling.");
+    }
+    instance.m_inter_op_parallelism = parallelism;
+}
+
+void runtime::cpu::CPU_Backend::set_frozen_execution(shared_ptr<Function> func, bool frozen)
+{
+    FunctionInstance& instance = m_function_map[func];
+    if (instance.m_external_function != nullptr)
+    {
+        throw runtime_error("Frozen execution must be set prior to compiling.");
+    }
+    instance.m_frozen = frozen;
+}
+
+void runtime::cpu::CPU_Backend::set_optimization_level(shared_ptr<Function> func, size_t level)
+{
+    if (level > 2)
+    {
+        throw ngraph_error("Optimization level must be 0, 1 or 2");
+    }
+    FunctionInstance& instance = m_function_map[func];
+    if (instance.m_external_function != nullptr)
+    {
+        throw runtime_error("Optimization level must be set prior to compiling.");
+    }
+    instance.m_optimization_level = static_cast<int>(level);
+}
+
+void runtime::cpu::CPU_Backend::enable_constant_updates(shared_ptr<Function> func, bool enable)
+{
+    FunctionInstance& instance = m_function_map[func];
+    if (instance.m_external_function != nullptr)
+    {
+        throw runtime_error("Constant updates must be enabled prior to compiling.");
+    }
+    instance.m_constant_updates = enable;
+}
+
+void runtime::cpu::CPU_Backend::set_layout_cost_model(shared_ptr<Function> func, bool enable)
+{
+    FunctionInstance& instance = m_function_map[func];
+    if (instance.m_external_function != nullptr)
+    {
+        throw runtime_error("Layout cost model must be selected prior to compiling.");
+    }
+    instance.m_layout_cost_model = enable ? 1 : 0;
+}
+
+size_t runtime::cpu::CPU_Backend::update_constants(shared_ptr<Function> func,
+                                                   const shared_ptr<Function>& updated)
+{
+    auto it = m_function_map.find(func);
+    if (it == m_function_map.end() || it->second.m_external_function == nullptr)
+    {
+        throw runtime_error("compile() must be called before update_constants().");
+    }
+    FunctionInstance& instance = it->second;
+    size_t changed = instance.m_external_function->update_constants(updated);
+    if (changed > 0)
+    {
+        instance.m_call_frame->reset_runtime_context();
+    }
+    return changed;
+}
+
+vector<pass::PassProfile>
+    runtime::cpu::CPU_Backend::get_pass_profiles(shared_ptr<Function> func) const
+{
+    auto it = m_function_map.find(func);
+    if (it != m_function_map.end() && it->second.m_external_function != nullptr)
+    {
+        return it->second.m_external_function->get_pass_profiles();
+    }
+    return {};
+}
+
+runtime::cpu::LayoutConversionStats
+    runtime::cpu::CPU_Backend::get_layout_conversions(shared_ptr<Function> func) const
+{
+    auto it = m_function_map.find(func);
+    if (it != m_function_map.end() && it->second.m_external_function != nullptr)
+    {
+        return it->second.m_external_function->get_layout_conversions();
+    }
+    return {};
+}
+
+size_t runtime::cpu::CPU_Backend::get_max_concurrent_ops(shared_ptr<Function> func) const
+{
+    auto it = m_function_map.find(func);
+    if (it != m_function_map.end() && it->second.m_external_function != nullptr)
+    {
+        return it->second.m_external_function->get_max_concurrent_ops();
+    }
+    return 0;
+}
+
+size_t runtime::cpu::CPU_Backend::get_constant_bytes_saved() const
+{
+    return m_constant_store->get_bytes_saved();
+}
+
 vector<runtime::PerformanceCounter>
     runtime::cpu::CPU_Backend::get_performance_data(shared_ptr<Function> func) const
 {
@@ -18,7 +18,10 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 
+#include "ngraph/pass/constant_deduplication.hpp"
+#include "ngraph/pass/manager.hpp"
 #include "ngraph/runtime/backend.hpp"
 
 namespace ngraph
@@ -30,6 +33,17 @@ namespace ngraph
             class CPU_ExternalFunction;
             class CPU_CallFrame;
 
+            /// \brief Layout conversions (ConvertLayout ops) of a compiled Function
+            struct LayoutConversionStats
+            {
+                /// Number of conversions left once all passes have run
+                size_t count = 0;
+                /// Bytes they write on every call
+                size_t bytes = 0;
+                /// Whether the layouts of elementwise ops were chosen by the layout cost model
+                bool cost_model = false;
+            };
+
             class CPU_Backend : public runtime::Backend
             {
             public:
@@ -47,6 +61,9 @@ namespace ngraph
 
                 Handle compile(std::shared_ptr<Function> func) override;
 
+                std::shared_ptr<runtime::Executable>
+                    create_executable(std::shared_ptr<Function> func) override;
+
                 bool call(std::shared_ptr<Function> func,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
@@ -58,6 +75,81 @@ namespace ngraph
                 std::vector<PerformanceCounter>
                     get_performance_data(std::shared_ptr<Function> func) const override;
 
+                /// \brief Set the number of ops of a Function that may execute concurrently.
+                ///     Independent branches are scheduled on a work-stealing pool and the
+                ///     intra-op threads are split between the ops running at the same time.
+                ///     Must be called before the Function is compiled.
+                /// \param func The function to configure
+                /// \param parallelism Maximum number of concurrently running ops, 1 to disable
+                void set_inter_op_parallelism(std::shared_ptr<Function> func, size_t parallelism);
+
+                /// \brief Replay a fixed sequence of kernels on every call after the first.
+                ///     The ops that have to run when all inputs change are recorded on the first
+                ///     call, and later calls run just those without checking which inputs were
+                ///     modified. Ops computing only from constants are not rerun. Must be called
+                ///     before the Function is compiled.
+                /// \param func The function to configure
+                /// \param frozen true to record and replay
+                void set_frozen_execution(std::shared_ptr<Function> func, bool frozen);
+
+                /// \brief Select the optimization passes run when compiling a Function, trading
+                ///     execution speed for compile time. Level 0 runs only the passes needed to
+                ///     execute, level 1 adds algebraic simplification, CSE and the local fusions,
+                ///     and level 2, the default, adds the RNN, batch and horizontal fusions and
+                ///     picks layouts that need fewer conversions. The NGRAPH_CPU_OPT_LEVEL
+                ///     environment variable sets the default level, and passes named in
+                ///     NGRAPH_PASS_ENABLES run or not whatever the level. Must be called before
+                ///     the Function is compiled.
+                /// \param func The function to configure
+                /// \param level 0, 1 or 2
+                void set_optimization_level(std::shared_ptr<Function> func, size_t level);
+
+                /// \brief Allow update_constants() on a Function. Constants with the same data
+                ///     are then kept apart rather than merged when compiling. Must be called
+                ///     before the Function is compiled.
+                /// \param func The function to configure
+                /// \param enable true to allow constant updates
+                void enable_constant_updates(std::shared_ptr<Function> func, bool enable);
+
+                /// \brief Choose the layout of elementwise ops whose inputs arrive in different
+                ///     layouts by the bytes of conversions needed, rather than always taking the
+                ///     first input's. On by default at optimization level 2. Comparing
+                ///     get_layout_conversions() with and without it shows the conversions it
+                ///     saves. Must be called before the Function is compiled.
+                /// \param func The function to configure
+                /// \param enable true to use the cost model
+                void set_layout_cost_model(std::shared_ptr<Function> func, bool enable);
+
+                /// \brief Replace the Constant data of a compiled Function without compiling it
+                ///     again. `updated` is a Function built the same way as func was, before it
+                ///     was compiled, with different Constant values; Constants are matched in
+                ///     topological order. Values computed from constants only, such as weights
+                ///     converted to MKLDNN layouts, are recomputed on the next call. Constants
+                ///     folded into other ops or used as quantization parameters can't change.
+                ///     Must not be called while func is executing.
+                /// \param func The compiled function, with constant updates enabled
+                /// \param updated The function holding the new Constant values
+                /// \return The number of Constants whose data changed
+                size_t update_constants(std::shared_ptr<Function> func,
+                                        const std::shared_ptr<Function>& updated);
+
+                /// \brief Time of each pass run when compiling func, and its op count change
+                ///     when NGRAPH_PROFILE_PASS_ENABLE is set. Empty if func has not been compiled.
+                std::vector<ngraph::pass::PassProfile>
+                    get_pass_profiles(std::shared_ptr<Function> func) const;
+
+                /// \brief Number and size of the layout conversions in func. Zero if func has
+                ///     not been compiled.
+                LayoutConversionStats get_layout_conversions(std::shared_ptr<Function> func) const;
+
+                /// \brief Most ops of func that ran at the same time so far, with inter-op
+                ///     parallelism. Zero if func has not run on the inter-op scheduler.
+                size_t get_max_concurrent_ops(std::shared_ptr<Function> func) const;
+
+                /// \brief Bytes of constant data shared between, or merged within, the Functions
+                ///     compiled by this backend instead of being held once per Constant.
+                size_t get_constant_bytes_saved() const;
+
             private:
                 class FunctionInstance
                 {
@@ -65,9 +157,18 @@ namespace ngraph
                     std::shared_ptr<CPU_ExternalFunction> m_external_function;
                     std::shared_ptr<CPU_CallFrame> m_call_frame;
                     bool m_performance_counters_enabled = false;
+                    size_t m_inter_op_parallelism = 1;
+                    bool m_frozen = false;
+                    // -1 to keep the default level of the external function
+                    int m_optimization_level = -1;
+                    bool m_constant_updates = false;
+                    // -1 to use the layout cost model at optimization level 2
+                    int m_layout_cost_model = -1;
                 };
 
                 std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
+                std::shared_ptr<ngraph::pass::ConstantStore> m_constant_store =
+                    std::make_shared<ngraph::pass::ConstantStore>();
             };
         }
     }
@@ -68,6 +68,7 @@
 #include "ngraph/runtime/cpu/kernel/and.hpp"
 #include "ngraph/runtime/cpu/kernel/asin.hpp"
 #include "ngraph/runtime/cpu/kernel/atan.hpp"
+#include "ngraph/runtime/cpu/kernel/bf16.hpp"
 #include "ngraph/runtime/cpu/kernel/broadcast.hpp"
 #include "ngraph/runtime/cpu/kernel/ceil.hpp"
 #include "ngraph/runtime/cpu/kernel/cos.hpp"
@@ -89,7 +90,6 @@
 #include "ngraph/runtime/cpu/kernel/not.hpp"
 #include "ngraph/runtime/cpu/kernel/not_equal.hpp"
 #include "ngraph/runtime/cpu/kernel/or.hpp"
-#include "ngraph/runtime/cpu/kernel/result.hpp"
 #include "ngraph/runtime/cpu/kernel/sign.hpp"
 #include "ngraph/runtime/cpu/kernel/sin.hpp"
 #include "ngraph/runtime/cpu/kernel/sinh.hpp"
@@ -115,19 +115,22 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Subtract)
             {
-                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::subtract);
+                BUILD_BINARY_ELEMWISE_FUNCTOR_BF16(runtime::cpu::kernel::subtract,
+                                                   Eigen::internal::scalar_difference_op<float>);
             }
 
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Multiply)
             {
-                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::multiply);
+                BUILD_BINARY_ELEMWISE_FUNCTOR_BF16(runtime::cpu::kernel::multiply,
+                                                   Eigen::internal::scalar_product_op<float>);
             }
 
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Divide)
             {
-                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::divide);
+                BUILD_BINARY_ELEMWISE_FUNCTOR_BF16(runtime::cpu::kernel::divide,
+                                                   Eigen::internal::scalar_quotient_op<float>);
             }
 
             template <>
@@ -205,12 +208,14 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Maximum)
             {
-                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::maximum);
+                BUILD_BINARY_ELEMWISE_FUNCTOR_BF16(runtime::cpu::kernel::maximum,
+                                                   Eigen::internal::scalar_max_op<float>);
             }
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Minimum)
             {
-                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::minimum);
+                BUILD_BINARY_ELEMWISE_FUNCTOR_BF16(runtime::cpu::kernel::minimum,
+                                                   Eigen::internal::scalar_min_op<float>);
             }
 
             template <>
@@ -270,19 +275,34 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Negative)
             {
-                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::negative);
+                BUILD_UNARY_ELEMWISE_FUNCTOR_BF16(runtime::cpu::kernel::negative,
+                                                  Eigen::internal::scalar_opposite_op<float>);
             }
 
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Sqrt)
             {
-                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::sqrt);
+                BUILD_UNARY_ELEMWISE_FUNCTOR_BF16(runtime::cpu::kernel::sqrt,
+                                                  Eigen::internal::scalar_sqrt_op<float>);
             }
 
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Result)
             {
-                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::result);
+                auto& functors = external_function->get_functors();
+                auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
+                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                size_t size = out[0].get_size() * out[0].get_element_type().size();
+
+                // Nothing to do when the producer already wrote into the output buffer
+                auto functor = [&, size](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    if (arg_tensor != out_tensor)
+                    {
+                        memcpy(out_tensor, arg_tensor, size);
+                        ctx->output_bytes_copied += size;
+                    }
+                };
+                functors.emplace_back(functor);
             }
 
             template <>
@@ -201,37 +201,65 @@
         throw ngraph_error("Unsupported element type " + ET.c_type_string() + " for kernel " #K);  \
     }
 
-#define BUILD_UNARY_ELEMWISE_FUNCTOR(OP)                                                           \
+#define BUILD_UNARY_ELEMWISE_KERNEL_FUNCTOR(KERNEL)                                                \
     auto& functors = external_function->get_functors();                                            \
-    std::function<void(void*, void*, size_t, int)> kernel;                                         \
-                                                                                                   \
-    SELECT_KERNEL(kernel, args[0].get_element_type(), OP);                                         \
-                                                                                                   \
     auto element_count = out[0].get_size();                                                        \
     auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());                    \
     auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());                     \
                                                                                                    \
-    auto functor = [&, kernel, element_count](CPURuntimeContext* ctx, CPUExecutionContext* ectx) { \
-        kernel(arg0_tensor, out0_tensor, element_count, ectx->arena);                              \
+    auto functor = [&, KERNEL, element_count](CPURuntimeContext* ctx, CPUExecutionContext* ectx) { \
+        KERNEL(arg0_tensor, out0_tensor, element_count, ectx->arena);                              \
     };                                                                                             \
     functors.emplace_back(functor);
 
-#define BUILD_BINARY_ELEMWISE_FUNCTOR(OP)                                                          \
+#define BUILD_BINARY_ELEMWISE_KERNEL_FUNCTOR(KERNEL)                                               \
     auto& functors = external_function->get_functors();                                            \
-    std::function<void(void*, void*, void*, size_t, int)> kernel;                                  \
-                                                                                                   \
-    SELECT_KERNEL(kernel, args[0].get_element_type(), OP);                                         \
-                                                                                                   \
     auto element_count = out[0].get_size();                                                        \
     auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());                    \
     auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());                    \
     auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());                     \
                                                                                                    \
-    auto functor = [&, kernel, element_count](CPURuntimeContext* ctx, CPUExecutionContext* ectx) { \
-        kernel(arg0_tensor, arg1_tensor, out0_tensor, element_count, ectx->arena);                 \
+    auto functor = [&, KERNEL, element_count](CPURuntimeContext* ctx, CPUExecutionContext* ectx) { \
+        KERNEL(arg0_tensor, arg1_tensor, out0_tensor, element_count, ectx->arena);                 \
     };                                                                                             \
     functors.emplace_back(functor);
 
+#define BUILD_UNARY_ELEMWISE_FUNCTOR(OP)                                                           \
+    std::function<void(void*, void*, size_t, int)> kernel;                                         \
+    SELECT_KERNEL(kernel, args[0].get_element_type(), OP);                                         \
+    BUILD_UNARY_ELEMWISE_KERNEL_FUNCTOR(kernel)
+
+#define BUILD_BINARY_ELEMWISE_FUNCTOR(OP)                                                          \
+    std::function<void(void*, void*, void*, size_t, int)> kernel;                                  \
+    SELECT_KERNEL(kernel, args[0].get_element_type(), OP);                                         \
+    BUILD_BINARY_ELEMWISE_KERNEL_FUNCTOR(kernel)
+
+// Elementwise ops that also run on bf16 tensors. BF16_OP is an f32 functor applied by
+// runtime::cpu::kernel::bf16_unary/bf16_binary between widening and narrowing each element.
+#define BUILD_UNARY_ELEMWISE_FUNCTOR_BF16(OP, BF16_OP)                                             \
+    std::function<void(void*, void*, size_t, int)> kernel;                                         \
+    if (args[0].get_element_type() == element::bf16)                                               \
+    {                                                                                              \
+        kernel = runtime::cpu::kernel::bf16_unary<BF16_OP>;                                        \
+    }                                                                                              \
+    else                                                                                           \
+    {                                                                                              \
+        SELECT_KERNEL(kernel, args[0].get_element_type(), OP);                                     \
+    }                                                                                              \
+    BUILD_UNARY_ELEMWISE_KERNEL_FUNCTOR(kernel)
+
+#define BUILD_BINARY_ELEMWISE_FUNCTOR_BF16(OP, BF16_OP)                                            \
+    std::function<void(void*, void*, void*, size_t, int)> kernel;                                  \
+    if (args[0].get_element_type() == element::bf16)                                               \
+    {                                                                                              \
+        kernel = runtime::cpu::kernel::bf16_binary<BF16_OP>;                                       \
+    }                                                                                              \
+    else                                                                                           \
+    {                                                                                              \
+        SELECT_KERNEL(kernel, args[0].get_element_type(), OP);                                     \
+    }                                                                                              \
+    BUILD_BINARY_ELEMWISE_KERNEL_FUNCTOR(kernel)
+
 #define REGISTER_OP_BUILDER(OP)                                                                    \
     static struct __register_##OP##_builder                                                        \
     {                                                                                              \
@@ -258,6 +286,13 @@ namespace ngraph
 
             BuildOpMap& GetGlobalBuildDispatcher();
 
+            /// \brief Element type to select kernels that only move data with. Such kernels
+            ///        carry bf16 values as raw 16-bit words.
+            inline const element::Type& get_movement_element_type(const element::Type& type)
+            {
+                return type == element::bf16 ? element::i16 : type;
+            }
+
             class Builder
             {
             public:
@@ -33,6 +33,7 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
                                            EntryPoint compiled_function)
     : m_external_function(external_function)
     , m_compiled_function(compiled_function)
+    , m_pins_bound(false)
 {
     setup_runtime_context();
 }
@@ -46,27 +47,33 @@ void runtime::cpu::CPU_CallFrame::inner_call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
 {
-    vector<void*> inputs;
-    vector<void*> outputs;
+    m_pins_bound = false;
+    m_inputs.resize(input_tvs.size());
+    m_outputs.resize(output_tvs.size());
 
     for (size_t i = 0; i < input_tvs.size(); i++)
     {
-        shared_ptr<runtime::cpu::CPUTensorView> tv =
-            static_pointer_cast<runtime::cpu::CPUTensorView>(input_tvs[i]);
+        auto tv = static_cast<runtime::cpu::CPUTensorView*>(input_tvs[i].get());
         ctx->p_en[i] = tv->get_stale();
-        inputs.push_back(tv->get_data_ptr());
+        m_inputs[i] = tv->get_data_ptr();
     }
     for (size_t i = 0; i < output_tvs.size(); i++)
     {
-        shared_ptr<runtime::cpu::CPUTensorView> tv =
-            static_pointer_cast<runtime::cpu::CPUTensorView>(output_tvs[i]);
-        outputs.push_back(tv->get_data_ptr());
+        auto tv = static_cast<runtime::cpu::CPUTensorView*>(output_tvs[i].get());
+        m_outputs[i] = tv->get_data_ptr();
     }
 
+    inner_call(m_outputs.data(), m_inputs.data());
+}
+
+void runtime::cpu::CPU_CallFrame::inner_call(void** outputs, void** inputs)
+{
+    ctx->output_bytes_copied = 0;
+
     // Invoke compiled computation
     if (!m_external_function->is_direct_execution())
     {
-        m_compiled_function(inputs.data(), outputs.data(), ctx);
+        m_compiled_function(inputs, outputs, ctx);
     }
     else
     {
@@ -90,6 +97,44 @@ void runtime::cpu::CPU_CallFrame::call(
     inner_call(output_tvs, input_tvs);
 }
 
+void runtime::cpu::CPU_CallFrame::call(void** outputs, void** inputs)
+{
+    ctx->pc = 0;
+    m_pins_bound = false;
+    size_t input_count = m_external_function->get_parameter_layout_descriptors().size();
+    std::fill(ctx->p_en, ctx->p_en + input_count, true);
+    inner_call(outputs, inputs);
+}
+
+void runtime::cpu::CPU_CallFrame::pin(void** outputs, void** inputs)
+{
+    size_t input_count = m_external_function->get_parameter_layout_descriptors().size();
+    size_t output_count = m_external_function->get_result_layout_descriptors().size();
+    if (m_pinned_inputs.size() == input_count && m_pinned_outputs.size() == output_count &&
+        std::equal(m_pinned_inputs.begin(), m_pinned_inputs.end(), inputs) &&
+        std::equal(m_pinned_outputs.begin(), m_pinned_outputs.end(), outputs))
+    {
+        return;
+    }
+    m_pinned_inputs.assign(inputs, inputs + input_count);
+    m_pinned_outputs.assign(outputs, outputs + output_count);
+    m_pins_bound = false;
+}
+
+void runtime::cpu::CPU_CallFrame::call_pinned()
+{
+    ctx->pc = 0;
+    if (m_pins_bound && m_external_function->is_direct_execution())
+    {
+        inner_call(nullptr, nullptr);
+        return;
+    }
+    size_t input_count = m_external_function->get_parameter_layout_descriptors().size();
+    std::fill(ctx->p_en, ctx->p_en + input_count, true);
+    inner_call(m_pinned_outputs.data(), m_pinned_inputs.data());
+    m_pins_bound = true;
+}
+
 void runtime::cpu::CPU_CallFrame::propagate_layouts(
     const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
     const LayoutDescriptorPtrs& layouts) const
@@ -115,6 +160,7 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
     ctx = new CPURuntimeContext;
 
     ctx->pc = 0;
+    ctx->output_bytes_copied = 0;
     ctx->op_durations = nullptr;
     if (runtime::cpu::IsTracingEnabled())
     {
@@ -151,6 +197,13 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
 #endif
 }
 
+void runtime::cpu::CPU_CallFrame::reset_runtime_context()
+{
+    cleanup_runtime_context();
+    setup_runtime_context();
+    m_pins_bound = false;
+}
+
 void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
 {
     delete[] ctx->op_durations;
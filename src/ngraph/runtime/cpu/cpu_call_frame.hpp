@@ -56,11 +56,39 @@ namespace ngraph
                 void call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 
+                /// \brief Invoke the function on raw buffers, one per result and parameter in
+                ///        signature order.
+                ///
+                /// Skips the tensor bookkeeping of the overload above, for latency bound callers
+                /// that keep reusing the same buffers. Buffers must be in the default row-major
+                /// layout and every input is treated as modified since the previous call.
+                void call(void** outputs, void** inputs);
+
+                /// \brief Keep the given buffers, one per result and parameter in signature
+                ///        order, for the following calls to call_pinned(). Pinning the buffers
+                ///        that are already pinned is cheap and keeps the slots bound.
+                void pin(void** outputs, void** inputs);
+
+                /// \brief Invoke the function on the buffers passed to pin(). In DEX mode the
+                ///        tensor slots are only bound on the first such call, so later ones
+                ///        start executing kernels straight away. Every input is treated as
+                ///        modified since the previous call.
+                void call_pinned();
+
                 void propagate_layouts(const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
                                        const LayoutDescriptorPtrs& layouts) const;
 
+                /// \brief Number of bytes the last call copied into its outputs. Results whose
+                ///        producers write straight into the output buffers contribute nothing,
+                ///        so this is zero unless a result needs a copy, e.g. of a parameter or
+                ///        of a value also returned by another result. Counted in DEX mode only.
+                size_t get_output_bytes_copied() const { return ctx->output_bytes_copied; }
+
                 void setup_runtime_context();
                 void cleanup_runtime_context();
+                /// \brief Set up a fresh runtime context, so the next call runs every kernel
+                ///        again, including those computing only from constants
+                void reset_runtime_context();
 
             protected:
                 CPU_CallFrame(const CPU_CallFrame&) = delete;
@@ -69,10 +97,19 @@ namespace ngraph
 
                 void inner_call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                                 const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+                void inner_call(void** outputs, void** inputs);
 
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
                 EntryPoint m_compiled_function;
                 CPURuntimeContext* ctx;
+                // Reused by every call to hand the tensors' buffers to the compiled function
+                std::vector<void*> m_inputs;
+                std::vector<void*> m_outputs;
+                // Buffers kept by pin(), and whether the function's tensor slots still point
+                // at them
+                std::vector<void*> m_pinned_inputs;
+                std::vector<void*> m_pinned_outputs;
+                bool m_pins_bound;
             };
         }
     }
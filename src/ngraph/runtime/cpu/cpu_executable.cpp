@@ -0,0 +1,67 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_executable.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::cpu::CPU_Executable::CPU_Executable(
+    Backend* backend,
+    const shared_ptr<Function>& function,
+    const shared_ptr<CPU_ExternalFunction>& external_function,
+    const shared_ptr<CPU_CallFrame>& call_frame)
+    : Executable(backend, function)
+    , m_external_function(external_function)
+    , m_call_frame(call_frame)
+{
+}
+
+void runtime::cpu::CPU_Executable::prepare()
+{
+    auto buffer = [](const shared_ptr<runtime::Tensor>& tensor) {
+        auto tv = dynamic_pointer_cast<CPUTensorView>(tensor);
+        if (tv == nullptr)
+        {
+            throw ngraph_error("CPU executables can only be bound to CPU tensors");
+        }
+        return tv->get_data_ptr();
+    };
+
+    m_call_frame->propagate_layouts(m_outputs,
+                                    m_external_function->get_result_layout_descriptors());
+    m_input_buffers.clear();
+    m_output_buffers.clear();
+    for (const shared_ptr<runtime::Tensor>& tensor : m_inputs)
+    {
+        m_input_buffers.push_back(buffer(tensor));
+    }
+    for (const shared_ptr<runtime::Tensor>& tensor : m_outputs)
+    {
+        m_output_buffers.push_back(buffer(tensor));
+    }
+}
+
+void runtime::cpu::CPU_Executable::execute()
+{
+    // Another executable or a regular call may have used the call frame since the last run
+    m_call_frame->pin(m_output_buffers.data(), m_input_buffers.data());
+    m_call_frame->call_pinned();
+}
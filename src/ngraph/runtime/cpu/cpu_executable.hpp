@@ -0,0 +1,56 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ngraph/runtime/executable.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            class CPU_CallFrame;
+            class CPU_ExternalFunction;
+
+            /// \brief Runs a compiled Function on pinned buffers. Result layouts are propagated
+            ///        and the tensors' buffers collected once per set of bindings, and every run
+            ///        hands the same raw pointers to the call frame.
+            class CPU_Executable : public runtime::Executable
+            {
+            public:
+                CPU_Executable(Backend* backend,
+                               const std::shared_ptr<Function>& function,
+                               const std::shared_ptr<CPU_ExternalFunction>& external_function,
+                               const std::shared_ptr<CPU_CallFrame>& call_frame);
+
+            protected:
+                void prepare() override;
+                void execute() override;
+
+            private:
+                std::shared_ptr<CPU_ExternalFunction> m_external_function;
+                std::shared_ptr<CPU_CallFrame> m_call_frame;
+                std::vector<void*> m_input_buffers;
+                std::vector<void*> m_output_buffers;
+            };
+        }
+    }
+}
@@ -14,9 +14,19 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "cpu_executor.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/log.hpp"
 
 static int GetNumCores()
 {
@@ -52,6 +62,35 @@ static int GetNumThreadPools()
     return count < 1 ? 1 : count;
 }
 
+static size_t GetParallelThreshold(const char* value)
+{
+    char* end = nullptr;
+    errno = 0;
+    long long threshold = std::strtoll(value, &end, 10);
+    if (end == value || *end != '\0' || errno == ERANGE || threshold < 0)
+    {
+        throw ngraph::ngraph_error(
+            std::string("NGRAPH_CPU_PARALLEL_THRESHOLD must be a non-negative integer, got '") +
+            value + "'");
+    }
+    return static_cast<size_t>(threshold);
+}
+
+// Cost of a float add over `count` elements, the unit in which parallel thresholds are given
+static double FloatAddCost(size_t count)
+{
+    if (count == std::numeric_limits<size_t>::max())
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+    using Vector = Eigen::TensorMap<Eigen::Tensor<float, 1, Eigen::RowMajor>>;
+    float value = 0;
+    Eigen::array<Eigen::Index, 1> dims{{1}};
+    Vector out(&value, dims);
+    Vector in(&value, dims);
+    return ngraph::runtime::cpu::executor::elementwise_cost(out, in + in, count);
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -63,20 +102,122 @@ namespace ngraph
                 CPUExecutor::CPUExecutor(int num_thread_pools)
                     : m_num_thread_pools(num_thread_pools)
                 {
+                    m_thread_pools.reserve(s_max_thread_pools);
+                    m_thread_pool_devices.reserve(s_max_thread_pools);
+                    m_tbb_arenas.reserve(s_max_thread_pools);
                     for (int i = 0; i < num_thread_pools; i++)
                     {
-                        int num_threads_per_pool;
+                        add_thread_pool(GetNumCores());
+                    }
+
+                    const auto env_threshold = std::getenv("NGRAPH_CPU_PARALLEL_THRESHOLD");
+                    size_t threshold = env_threshold ? GetParallelThreshold(env_threshold)
+                                                     : tune_parallel_threshold();
+                    m_parallel_cost_threshold = FloatAddCost(threshold);
+                    NGRAPH_DEBUG << "CPU elementwise parallel threshold: " << threshold
+                                 << " float adds, " << m_parallel_cost_threshold << " cycles";
+                }
+
+                // Times a float add serially and on the first thread pool for growing sizes and
+                // returns the smallest size from which the pool is clearly faster. Each size is
+                // timed a few times and the fastest run kept, and the pool has to win by a margin
+                // at two consecutive sizes, so timing noise near the crossover is ignored.
+                size_t CPUExecutor::tune_parallel_threshold()
+                {
+                    const size_t min_size = 1 << 10;
+                    const size_t max_size = 1 << 20;
+                    if (m_thread_pool_devices[0]->numThreads() <= 1)
+                    {
+                        return std::numeric_limits<size_t>::max();
+                    }
+
+                    using Vector = Eigen::TensorMap<Eigen::Tensor<float, 1, Eigen::RowMajor>>;
+                    std::vector<float> a(max_size, 1.0f);
+                    std::vector<float> b(max_size, 2.0f);
+                    std::vector<float> c(max_size);
+                    auto elapsed = [](std::function<void()> f) {
+                        auto start = std::chrono::steady_clock::now();
+                        f();
+                        return std::chrono::steady_clock::now() - start;
+                    };
+
+                    size_t crossover = 0;
+                    for (size_t size = min_size; size <= max_size; size *= 2)
+                    {
+                        Eigen::array<Eigen::Index, 1> dims{{static_cast<Eigen::Index>(size)}};
+                        Vector out(c.data(), dims);
+                        Vector in0(a.data(), dims);
+                        Vector in1(b.data(), dims);
+                        // Alternate the two so neither is always the one running on cold caches
+                        auto serial = std::chrono::steady_clock::duration::max();
+                        auto parallel = serial;
+                        for (int i = 0; i < 5; i++)
+                        {
+                            serial = std::min(serial, elapsed([&]() {
+                                out.device(Eigen::DefaultDevice()) = in0 + in1;
+                            }));
+                            parallel = std::min(parallel, elapsed([&]() {
+                                out.device(get_device(0)) = in0 + in1;
+                            }));
+                        }
+                        if (parallel * 4 > serial * 3)
+                        {
+                            crossover = 0;
+                        }
+                        else if (crossover == 0)
+                        {
+                            crossover = size;
+                        }
+                        else
+                        {
+                            return crossover;
+                        }
+                    }
+                    return crossover != 0 ? crossover : max_size;
+                }
+
+                void CPUExecutor::add_thread_pool(int num_threads)
+                {
+                    if (m_thread_pools.size() >= s_max_thread_pools)
+                    {
+                        throw ngraph_error(
+                            "CPU Backend: exceeded the maximum number of thread pools");
+                    }
+                    int num_threads_per_pool;
 #if defined(EIGEN_OPENMP)
-                        num_threads_per_pool = 1;
+                    num_threads_per_pool = 1;
 #else
-                        num_threads_per_pool = GetNumCores();
+                    num_threads_per_pool = num_threads;
 #endif
-                        m_thread_pools.push_back(std::unique_ptr<Eigen::ThreadPool>(
-                            new Eigen::ThreadPool(num_threads_per_pool)));
-                        m_thread_pool_devices.push_back(std::unique_ptr<Eigen::ThreadPoolDevice>(
-                            new Eigen::ThreadPoolDevice(m_thread_pools[i].get(), GetNumCores())));
-                        m_tbb_arenas.emplace_back(1);
+                    m_thread_pools.push_back(std::unique_ptr<Eigen::ThreadPool>(
+                        new Eigen::ThreadPool(num_threads_per_pool)));
+                    m_thread_pool_devices.push_back(std::unique_ptr<Eigen::ThreadPoolDevice>(
+                        new Eigen::ThreadPoolDevice(m_thread_pools.back().get(), num_threads)));
+                    m_tbb_arenas.emplace_back(1);
+                }
+
+                int CPUExecutor::get_partitioned_thread_pools(int count)
+                {
+                    if (count <= 1)
+                    {
+                        return 0;
+                    }
+
+                    std::lock_guard<std::mutex> lock(m_partition_mutex);
+                    auto it = m_partitioned_thread_pools.find(count);
+                    if (it != m_partitioned_thread_pools.end())
+                    {
+                        return it->second;
+                    }
+
+                    int base = static_cast<int>(m_thread_pools.size());
+                    int num_threads = std::max(1, GetNumCores() / count);
+                    for (int i = 0; i < count; i++)
+                    {
+                        add_thread_pool(num_threads);
                     }
+                    m_partitioned_thread_pools[count] = base;
+                    return base;
                 }
 
                 void CPUExecutor::execute(CPUKernelFunctor& f,
@@ -17,6 +17,8 @@
 #pragma once
 
 #include <functional>
+#include <map>
+#include <mutex>
 #include <thread>
 
 #include <mkldnn.hpp>
@@ -54,14 +56,72 @@ namespace ngraph
                                  CPUExecutionContext* ectx,
                                  bool use_tbb = false);
                     int get_num_thread_pools() { return m_num_thread_pools; }
+                    // Returns the id of the first of `count` consecutive thread pools that
+                    // split the intra-op threads evenly between ops running concurrently.
+                    // The pools are created on first request and shared by every function
+                    // asking for the same partitioning.
+                    int get_partitioned_thread_pools(int count);
+
+                    // Elementwise kernels whose estimated cost is below this run inline on the
+                    // calling thread. The cost is that of a float add over the number of
+                    // elements given by NGRAPH_CPU_PARALLEL_THRESHOLD, or measured once when the
+                    // executor is created, so more expensive ops go parallel at smaller sizes.
+                    double get_parallel_cost_threshold() const { return m_parallel_cost_threshold; }
+
                 private:
+                    void add_thread_pool(int num_threads);
+                    size_t tune_parallel_threshold();
+
+                    // Upper bound on the number of pools so that devices handed out to
+                    // running kernels are never relocated when new partitions are created
+                    static constexpr int s_max_thread_pools = 256;
+
                     std::vector<std::unique_ptr<Eigen::ThreadPool>> m_thread_pools;
                     std::vector<std::unique_ptr<Eigen::ThreadPoolDevice>> m_thread_pool_devices;
                     std::vector<tbb::task_arena> m_tbb_arenas;
                     int m_num_thread_pools;
+                    std::map<int, int> m_partitioned_thread_pools;
+                    std::mutex m_partition_mutex;
+                    double m_parallel_cost_threshold;
                 };
 
                 extern CPUExecutor& GetCPUExecutor();
+
+                /// \brief Returns Eigen's estimate, in cycles, of evaluating the elementwise
+                ///        expression `expr` into `out` over `count` elements.
+                template <typename Output, typename Expression>
+                double elementwise_cost(Output& out, const Expression& expr, size_t count)
+                {
+                    using Assign = Eigen::TensorAssignOp<Output, const Expression>;
+                    using Evaluator = Eigen::TensorEvaluator<const Assign, Eigen::DefaultDevice>;
+                    Eigen::DefaultDevice device;
+                    const Assign assign(out, expr);
+                    const Evaluator evaluator(assign, device);
+                    return Eigen::TensorCostModel<Eigen::DefaultDevice>::totalCost(
+                        static_cast<double>(count),
+                        evaluator.costPerCoeff(Evaluator::PacketAccess));
+                }
+
+                /// \brief Evaluates the elementwise expression `expr` over `count` elements into
+                ///        `out`. Cheap expressions are evaluated serially on the calling thread,
+                ///        which is still vectorized but skips the thread pool's cost model and task
+                ///        dispatch. More expensive ones are split across the arena's thread pool.
+                template <typename Output, typename Expression>
+                void assign_elementwise(Output& out,
+                                        const Expression& expr,
+                                        size_t count,
+                                        int arena)
+                {
+                    CPUExecutor& executor = GetCPUExecutor();
+                    if (elementwise_cost(out, expr, count) < executor.get_parallel_cost_threshold())
+                    {
+                        out.device(Eigen::DefaultDevice()) = expr;
+                    }
+                    else
+                    {
+                        out.device(executor.get_device(arena)) = expr;
+                    }
+                }
             }
         }
     }
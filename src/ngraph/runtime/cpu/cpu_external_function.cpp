@@ -15,8 +15,13 @@
 //*****************************************************************************
 
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <iterator>
+#include <limits>
+#include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <tuple>
 #include <typeindex>
@@ -26,6 +31,8 @@
 #define TBB_PREVIEW_FLOW_GRAPH_TRACE 1
 
 #include <tbb/flow_graph.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
 
 #if !defined(NGRAPH_DEX_ONLY)
 #include "ngraph/codegen/code_writer.hpp"
@@ -69,6 +76,7 @@
 #include "ngraph/op/experimental/quantized_conv.hpp"
 #include "ngraph/op/experimental/quantized_conv_bias.hpp"
 #include "ngraph/op/experimental/quantized_conv_relu.hpp"
+#include "ngraph/op/experimental/quantized_dot.hpp"
 #include "ngraph/op/experimental/quantized_max_pool.hpp"
 #include "ngraph/op/floor.hpp"
 #include "ngraph/op/function_call.hpp"
@@ -120,6 +128,7 @@
 #include "ngraph/pass/algebraic_simplification.hpp"
 #include "ngraph/pass/any_all_replacement.hpp"
 #include "ngraph/pass/common_function_collection.hpp"
+#include "ngraph/pass/constant_deduplication.hpp"
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/core_fusion.hpp"
 #include "ngraph/pass/cse.hpp"
@@ -129,8 +138,10 @@
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/mixed_precision.hpp"
 #include "ngraph/pass/nop_elimination.hpp"
 #include "ngraph/pass/propagate_cacheability.hpp"
+#include "ngraph/pass/reduce_lowering.hpp"
 #include "ngraph/pass/reshape_elimination.hpp"
 #include "ngraph/pass/reshape_sinking.hpp"
 #include "ngraph/pass/zero_dim_tensor_elimination.hpp"
@@ -166,6 +177,7 @@
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_assignment.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_bf16_fallback.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_collapse_dims.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
@@ -173,6 +185,7 @@
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_memory_optimization.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_quant_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_workspace_insertion.hpp"
 #include "ngraph/runtime/cpu/pass/halide_subgraph_extraction.hpp"
@@ -212,12 +225,84 @@ using namespace ngraph;
         pass_manager.register_pass<prefix::name>(__VA_ARGS__);                                     \
     }
 
+// Constants without arguments in topological order, leaving out ScalarConstantLike
+static vector<shared_ptr<ngraph::op::Constant>> get_plain_constants(const shared_ptr<Function>& f)
+{
+    vector<shared_ptr<ngraph::op::Constant>> constants;
+    for (auto& node : f->get_ordered_ops())
+    {
+        auto constant = dynamic_pointer_cast<ngraph::op::Constant>(node);
+        if (constant && constant->get_input_size() == 0)
+        {
+            constants.push_back(constant);
+        }
+    }
+    return constants;
+}
+
+// Quantization scales and offsets are baked into the MKLDNN primitives and kernels when they
+// are built, rather than read from the tensor on every call
+static bool is_read_at_build(const Node& constant)
+{
+    for (const descriptor::Input* input : constant.get_outputs().at(0).get_inputs())
+    {
+        const string& op = input->get_node()->description();
+        if (op.find("Quantize") == string::npos)
+        {
+            continue;
+        }
+        // Quantized* ops take the data and the weights first, Quantize and Dequantize the data
+        size_t first_parameter = op.compare(0, 9, "Quantized") == 0 ? 2 : 1;
+        if (input->get_index() >= first_parameter)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::get_default_optimization_level()
+{
+    static const char* env = std::getenv("NGRAPH_CPU_OPT_LEVEL");
+    if (env == nullptr)
+    {
+        return 2;
+    }
+    size_t level = std::strtoul(env, nullptr, 10);
+    if (level > 2)
+    {
+        throw ngraph_error("NGRAPH_CPU_OPT_LEVEL must be 0, 1 or 2");
+    }
+    return level;
+}
+
+void runtime::cpu::CPU_ExternalFunction::count_layout_conversions(const Function& function,
+                                                                  size_t& count,
+                                                                  size_t& bytes)
+{
+    count = 0;
+    bytes = 0;
+    for (const auto& node : function.get_ordered_ops())
+    {
+        if (std::dynamic_pointer_cast<runtime::cpu::op::ConvertLayout>(node))
+        {
+            count++;
+            bytes += shape_size(node->get_shape()) * node->get_element_type().size();
+        }
+    }
+}
+
 runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
     const shared_ptr<ngraph::Function>& function, bool release_function)
     : m_function(function)
     , m_release_function(release_function)
     , m_emit_timing(false)
     , m_use_tbb(std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
+    , m_inter_op_parallelism(1)
+    , m_frozen(false)
+    , m_optimization_level(get_default_optimization_level())
+    , m_constant_updates(false)
+    , m_layout_cost_model(-1)
 #if !defined(NGRAPH_DEX_ONLY)
     , m_is_compiled(false)
     , m_direct_execution(!std::getenv("NGRAPH_CODEGEN"))
@@ -226,6 +311,7 @@ runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
 #endif
     , m_compiled_function(nullptr)
     , m_function_name(function->get_name())
+    , m_intra_op_thread_pool_base(0)
     , m_is_built(false)
 {
 }
@@ -358,6 +444,8 @@ static const runtime::cpu::OpMap dispatcher{
      &runtime::cpu::CPU_Emitter::emit<op::QuantizedConvolution>},
     {TI(ngraph::op::QuantizedConvolutionRelu),
      &runtime::cpu::CPU_Emitter::emit<op::QuantizedConvolutionRelu>},
+    {TI(ngraph::op::QuantizedDot), &runtime::cpu::CPU_Emitter::emit<op::QuantizedDot>},
+    {TI(ngraph::op::QuantizedDotBias), &runtime::cpu::CPU_Emitter::emit<op::QuantizedDotBias>},
     {TI(ngraph::op::ConvolutionBiasAdd), &runtime::cpu::CPU_Emitter::emit<op::ConvolutionBiasAdd>},
     // conv+bias backprop for data share the same implementation as ConvolutionBackpropData
     {TI(ngraph::op::ConvolutionBiasBackpropFiltersBias),
@@ -454,7 +542,8 @@ void runtime::cpu::CPU_ExternalFunction::compile()
     pass_manager.register_pass<ngraph::pass::PropagateCacheability>(
         runtime::cpu::get_annotations_factory());
     pass_manager.register_pass<ngraph::pass::MemoryLayout>(size_t(s_memory_pool_alignment), true);
-    pass_manager.run_passes(m_function);
+    m_pass_profiles = pass_manager.run_passes(m_function);
+    count_layout_conversions(*m_function, m_layout_conversions.count, m_layout_conversions.bytes);
 
     unordered_map<shared_ptr<Function>, list<shared_ptr<Node>>> function_ordered_ops;
     for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
@@ -512,6 +601,7 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 #include "ngraph/runtime/reference/pad.hpp"
 #include "ngraph/runtime/reference/product.hpp"
 #include "ngraph/runtime/reference/quantize.hpp"
+#include "ngraph/runtime/reference/quantized_dot.hpp"
 #include "ngraph/runtime/reference/reduce.hpp"
 #include "ngraph/runtime/reference/reduce_window.hpp"
 #include "ngraph/runtime/reference/relu.hpp"
@@ -1095,35 +1185,62 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(ngraph::pass::Ma
 {
     auto pass_map = pass_manager.get_pass_config().get_enables();
 
+    // Level 0 only runs the passes needed to produce executable code, level 1 adds the
+    // simplifications and local fusions, and level 2 adds the RNN, batch and horizontal
+    // fusions, whose matchers walk large parts of the graph. Passes enabled or disabled
+    // explicitly in the pass config are not affected by the level.
+    const bool o1 = m_optimization_level >= 1;
+    const bool o2 = m_optimization_level >= 2;
+
     REGISTER_KNOBBED_PASS(AnyAllReplacement, true, ngraph::pass);
+    REGISTER_KNOBBED_PASS(ReduceLowering, true, ngraph::pass);
     REGISTER_KNOBBED_PASS(LikeReplacement, true, ngraph::pass);
     REGISTER_KNOBBED_PASS(NopElimination, true, ngraph::pass);
     REGISTER_KNOBBED_PASS(ZeroDimTensorElimination, true, ngraph::pass);
-    REGISTER_KNOBBED_PASS(LSTMFusion, true, runtime::cpu::pass);
-    REGISTER_KNOBBED_PASS(RNNFusion, true, runtime::cpu::pass);
-    REGISTER_KNOBBED_PASS(AlgebraicSimplification, true, ngraph::pass);
-    REGISTER_KNOBBED_PASS(MultiLayerRNNFusion, true, runtime::cpu::pass);
-    REGISTER_KNOBBED_PASS(CPURnnMatFusion, true, runtime::cpu::pass);
-    REGISTER_KNOBBED_PASS(CPUBatchFusion, true, runtime::cpu::pass);
+    REGISTER_KNOBBED_PASS(CPUQuantFusion, o1, runtime::cpu::pass);
+    REGISTER_KNOBBED_PASS(LSTMFusion, o2, runtime::cpu::pass);
+    REGISTER_KNOBBED_PASS(RNNCellFusion, o2, runtime::cpu::pass);
+    REGISTER_KNOBBED_PASS(RNNFusion, o2, runtime::cpu::pass);
+    REGISTER_KNOBBED_PASS(BiDirectionalRNNFusion, o2, runtime::cpu::pass);
+    REGISTER_KNOBBED_PASS(AlgebraicSimplification, o1, ngraph::pass);
+    REGISTER_KNOBBED_PASS(MultiLayerRNNFusion, o2, runtime::cpu::pass);
+    REGISTER_KNOBBED_PASS(RNNSequenceLengthFusion, o2 && m_direct_execution, runtime::cpu::pass);
+    REGISTER_KNOBBED_PASS(CPURnnMatFusion, o2, runtime::cpu::pass);
+    REGISTER_KNOBBED_PASS(CPUBatchFusion, o2, runtime::cpu::pass);
     REGISTER_KNOBBED_PASS(ReshapeSinking, false, ngraph::pass);
     REGISTER_KNOBBED_PASS(ReshapeElimination, false, ngraph::pass);
-    REGISTER_KNOBBED_PASS(CoreFusion, true, ngraph::pass);
-    REGISTER_KNOBBED_PASS(CPUFusion, true, runtime::cpu::pass);
-    REGISTER_KNOBBED_PASS(CPUHorizontalFusion, true, runtime::cpu::pass);
-    REGISTER_KNOBBED_PASS(CPUCollapseDims, true, runtime::cpu::pass);
+    REGISTER_KNOBBED_PASS(CoreFusion, o1, ngraph::pass);
+    REGISTER_KNOBBED_PASS(CPUFusion, o1, runtime::cpu::pass);
+    REGISTER_KNOBBED_PASS(CPUHorizontalFusion, o2, runtime::cpu::pass);
+    REGISTER_KNOBBED_PASS(CPUCollapseDims, o1, runtime::cpu::pass);
 #if defined(NGRAPH_HALIDE)
-    REGISTER_KNOBBED_PASS(HalideSubgraphExtraction, true, ngraph::runtime::cpu::pass);
+    REGISTER_KNOBBED_PASS(HalideSubgraphExtraction, o2, ngraph::runtime::cpu::pass);
 #endif
 
+    REGISTER_KNOBBED_PASS_WITH_ARGS(MixedPrecision,
+                                    false,
+                                    ngraph::pass,
+                                    runtime::cpu::pass::CPUBF16Fallback::get_bf16_compute_ops(),
+                                    runtime::cpu::pass::CPUBF16Fallback::get_bf16_movement_ops());
+    REGISTER_KNOBBED_PASS_WITH_ARGS(CPUBF16Fallback, true, runtime::cpu::pass, m_direct_execution);
+
+    REGISTER_KNOBBED_PASS_WITH_ARGS(
+        ConstantDeduplication, o1 && !m_constant_updates, ngraph::pass, m_constant_store);
+
     NodeVector nv_cwi; // We dont need CPUWorkspaceInsertion to return list of indices
-    REGISTER_KNOBBED_PASS_WITH_ARGS(CPUWorkspaceInsertion, true, runtime::cpu::pass, nv_cwi, false);
+    REGISTER_KNOBBED_PASS_WITH_ARGS(CPUWorkspaceInsertion, o1, runtime::cpu::pass, nv_cwi, false);
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPUAssignment, true, runtime::cpu::pass, this);
     REGISTER_KNOBBED_PASS(ConstantFolding, false, ngraph::pass);
-    REGISTER_KNOBBED_PASS_WITH_ARGS(CPULayout, true, runtime::cpu::pass, this);
+    m_layout_conversions.cost_model = m_layout_cost_model < 0 ? o2 : m_layout_cost_model != 0;
     REGISTER_KNOBBED_PASS_WITH_ARGS(
-        CommonSubexpressionElimination, true, ngraph::pass, runtime::cpu::get_cse_handlers_map());
-    REGISTER_KNOBBED_PASS(CPUPostLayoutOptimizations, true, runtime::cpu::pass);
-    REGISTER_KNOBBED_PASS(CPUMemoryOptimization, true, runtime::cpu::pass);
+        CPULayout, true, runtime::cpu::pass, this, m_layout_conversions.cost_model);
+    REGISTER_KNOBBED_PASS_WITH_ARGS(CommonSubexpressionElimination,
+                                    o1,
+                                    ngraph::pass,
+                                    runtime::cpu::get_cse_handlers_map(),
+                                    !m_constant_updates);
+    REGISTER_KNOBBED_PASS(CPUPostLayoutOptimizations, o1, runtime::cpu::pass);
+    REGISTER_KNOBBED_PASS(CPUMemoryOptimization, o1, runtime::cpu::pass);
     REGISTER_KNOBBED_PASS(GetOutputElementElimination, false, ngraph::pass);
     pass_manager.get_state().set_visualize_tree_ops_map(runtime::cpu::get_visualize_tree_ops_map());
 }
@@ -1247,6 +1364,55 @@ void runtime::cpu::CPU_ExternalFunction::propagate_in_place_output(
     size_t offset = res_src_output->get_tensor().get_pool_offset();
     auto it = res_src_output;
 
+    // A pass-through op skips its copy once its input and output share a buffer. When the
+    // memory planner could not place them together, because the input is still read later,
+    // the input can instead be computed straight into the output buffer. That requires the
+    // input to be an ordinary intermediate: produced into its own buffer rather than in place,
+    // and not overwritten by any destructive in-place consumer.
+    auto can_forward = [&](ngraph::op::Op* op, const ngraph::descriptor::Output& input) {
+        if (!dynamic_cast<ngraph::op::Reshape*>(op))
+        {
+            return false;
+        }
+        auto role = m_tensor_roles.find(input.get_tensor().get_name());
+        if (role != m_tensor_roles.end() && role->second != CPUTensorRole::INTERMEDIATE)
+        {
+            return false;
+        }
+        auto producer = std::dynamic_pointer_cast<ngraph::op::Op>(input.get_node());
+        if (!producer)
+        {
+            return false;
+        }
+        if (auto annotations = producer->get_op_annotations())
+        {
+            for (auto oi_pair : annotations->get_in_place_oi_pairs())
+            {
+                if (oi_pair.output == input.get_index())
+                {
+                    return false;
+                }
+            }
+        }
+        for (const ngraph::descriptor::Input* user : input.get_inputs())
+        {
+            auto user_op = std::dynamic_pointer_cast<ngraph::op::Op>(user->get_node());
+            auto annotations = user_op ? user_op->get_op_annotations() : nullptr;
+            if (!annotations)
+            {
+                continue;
+            }
+            for (auto oi_pair : annotations->get_in_place_oi_pairs())
+            {
+                if (oi_pair.input == user->get_index() && oi_pair.destructive)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+
     bool propagate_further = false;
     do
     {
@@ -1266,10 +1432,13 @@ void runtime::cpu::CPU_ExternalFunction::propagate_in_place_output(
                 if (oi_pair.output == it->get_index())
                 {
                     size_t input_index = oi_pair.input;
+                    auto& input_output = arg->get_inputs().at(input_index).get_output();
                     auto& input_tensor = arg->get_inputs().at(input_index).get_tensor();
-                    auto tmp_node = arg->get_inputs().at(input_index).get_output().get_node();
-                    if (input_tensor.get_pool_offset() == offset && !tmp_node->is_parameter() &&
-                        !tmp_node->is_constant())
+                    auto tmp_node = input_output.get_node();
+                    bool shares_buffer =
+                        input_tensor.get_pool_offset() == offset ||
+                        (!oi_pair.destructive && can_forward(arg.get(), input_output));
+                    if (shares_buffer && !tmp_node->is_parameter() && !tmp_node->is_constant())
                     {
                         NGRAPH_DEBUG << "Reusing " << output_name << " for "
                                      << input_tensor.get_name();
@@ -1285,6 +1454,7 @@ void runtime::cpu::CPU_ExternalFunction::propagate_in_place_output(
                         m_tensor_roles[input_tensor.get_name()] = CPUTensorRole::OUTPUT;
 
                         it = &arg->get_inputs().at(input_index).get_output();
+                        offset = input_tensor.get_pool_offset();
                         propagate_further = true;
                     }
                 }
@@ -1441,7 +1611,7 @@ void runtime::cpu::CPU_ExternalFunction::process_in_place_slice(
                         auto input_index = function_input_name_index[name];
                         auto input_offset = slice->get_element_type().size() * start;
                         intermediate_input_index_offset.emplace_back(
-                            tensor_data[output_tensor->get_name()], input_index, input_offset);
+                            &tensor_data[output_tensor->get_name()], input_index, input_offset);
 
                         // for codegen
                         m_variable_input_index_offset_map[output_tensor->get_name()] =
@@ -1518,7 +1688,7 @@ void runtime::cpu::CPU_ExternalFunction::propagate_in_place_slice(
                             temp_offset += slice->get_element_type().size() * start;
                         }
                         intermediate_input_index_offset.emplace_back(
-                            tensor_data[output_tensor.get_name()], input_index, temp_offset);
+                            &tensor_data[output_tensor.get_name()], input_index, temp_offset);
                         stack.push_back(std::pair<ngraph::descriptor::Output*, size_t>(
                             &c_op->get_outputs().at(output_index), temp_offset));
 
@@ -1552,13 +1722,21 @@ void runtime::cpu::CPU_ExternalFunction::build()
     static const string s_debug_dir = "cpu_codegen";
     static StaticInitializers s_static_initializers(s_debug_dir);
     m_mkldnn_emitter.reset(new MKLDNNEmitter());
+
+    vector<shared_ptr<ngraph::op::Constant>> original_constants;
+    if (m_constant_updates)
+    {
+        original_constants = get_plain_constants(m_function);
+    }
+
     ngraph::pass::Manager pass_manager;
     register_common_passes(pass_manager);
     pass_manager.register_pass<ngraph::pass::Liveness>();
     pass_manager.register_pass<ngraph::pass::PropagateCacheability>(
         runtime::cpu::get_annotations_factory());
     pass_manager.register_pass<ngraph::pass::MemoryLayout>(size_t(s_memory_pool_alignment), true);
-    pass_manager.run_passes(m_function, false);
+    m_pass_profiles = pass_manager.run_passes(m_function, false);
+    count_layout_conversions(*m_function, m_layout_conversions.count, m_layout_conversions.bytes);
 
     // Store layouts assigned for arguments
     for (const auto& parameter : m_function->get_parameters())
@@ -1613,6 +1791,10 @@ void runtime::cpu::CPU_ExternalFunction::build()
             propagate_in_place_constant(&node->get_outputs().at(0), tv->get_name(), true);
         }
     }
+    if (m_constant_updates)
+    {
+        index_original_constants(original_constants);
+    }
 
     // Inputs
     size_t arg_index = 0;
@@ -1623,7 +1805,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
             shared_ptr<descriptor::Tensor> tv = param->get_output_tensor_ptr(i);
             function_input_name_index[tv->get_name()] = arg_index;
             function_input_index.emplace_back(
-                tensor_data[tv->get_name()], arg_index, tensor_stale[tv->get_name()]);
+                &tensor_data[tv->get_name()], arg_index, &tensor_stale[tv->get_name()]);
             m_tensor_roles[tv->get_name()] = CPUTensorRole::INPUT;
             propagate_in_place_input(&param->get_outputs().at(i), tv->get_name(), true);
             arg_index++;
@@ -1644,7 +1826,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
             {
                 if (m_tensor_roles.find(tensor->get_name()) == m_tensor_roles.end())
                 {
-                    intermediates_offsets.emplace_back(tensor_data[tensor->get_name()],
+                    intermediates_offsets.emplace_back(&tensor_data[tensor->get_name()],
                                                        tensor->get_pool_offset());
                     m_tensor_roles[tensor->get_name()] = CPUTensorRole::INTERMEDIATE;
                 }
@@ -1657,7 +1839,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
     {
         shared_ptr<Node> op = m_function->get_output_op(i);
         shared_ptr<descriptor::Tensor> tv = op->get_output_tensor_ptr();
-        function_output_index.emplace_back(tensor_data[tv->get_name()], i);
+        function_output_index.emplace_back(&tensor_data[tv->get_name()], i);
         m_tensor_roles[tv->get_name()] = CPUTensorRole::OUTPUT;
 
         //keep assigning different outputs to a result descriptor
@@ -1669,7 +1851,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
         {
             shared_ptr<descriptor::Tensor> itv =
                 res->get_inputs().at(0).get_output().get_tensor_ptr();
-            function_output_index.emplace_back(tensor_data[itv->get_name()], i);
+            function_output_index.emplace_back(&tensor_data[itv->get_name()], i);
             m_tensor_roles[itv->get_name()] = CPUTensorRole::OUTPUT;
             tensor_alias[itv->get_name()] = tv->get_name();
             propagate_in_place_output(
@@ -1677,6 +1859,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
         }
     }
 
+    vector<Node*> op_nodes;
     for (shared_ptr<Node> node : m_function->get_ordered_ops())
     {
         if (node->is_parameter() || node->is_constant())
@@ -1711,6 +1894,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
 
         m_op_attrs.emplace_back(node->description(), out_names, in_names);
         op_names.push_back(node->get_name());
+        op_nodes.push_back(node.get());
         handler->second(this, node.get(), in, out);
 
         bool disable_caching = computes_result(node.get()) || possibly_overwritten(node.get());
@@ -1832,7 +2016,16 @@ void runtime::cpu::CPU_ExternalFunction::build()
     //This check ensures we have exactly one functor for Op.
     assert(m_op_attrs.size() == functors.size());
 
-    executor = [&](CPURuntimeContext* ctx, vector<void*>& inputs, vector<void*>& outputs) {
+    if (m_inter_op_parallelism > 1 && !m_use_tbb)
+    {
+        build_op_dependencies(op_nodes);
+        m_inter_op_arena.reset(new tbb::task_arena(static_cast<int>(m_inter_op_parallelism)));
+        m_intra_op_thread_pool_base = executor::GetCPUExecutor().get_partitioned_thread_pools(
+            static_cast<int>(m_inter_op_parallelism));
+    }
+
+    executor = [&](CPURuntimeContext* ctx, void** inputs, void** outputs) {
+        static const auto ddebug = std::getenv("NGRAPH_DEX_DEBUG");
         cpu::Timestamp start_ts, end_ts;
         int profiler_count = 0;
 
@@ -1840,26 +2033,33 @@ void runtime::cpu::CPU_ExternalFunction::build()
         {
             for (auto& p : intermediates_offsets)
             {
-                p.first.get() = static_cast<uint8_t*>(ctx->memory_buffers[0]->get_ptr()) + p.second;
+                *p.first = static_cast<uint8_t*>(ctx->memory_buffers[0]->get_ptr()) + p.second;
             }
         }
 
-        for (auto& p : intermediate_input_index_offset)
+        // Null buffers mean the call frame has pinned them, and the slots are still bound
+        if (inputs != nullptr)
         {
-            get<0>(p).get() = static_cast<uint8_t*>(inputs[get<1>(p)]) + get<2>(p);
-        }
+            for (auto& p : intermediate_input_index_offset)
+            {
+                *get<0>(p) = static_cast<uint8_t*>(inputs[get<1>(p)]) + get<2>(p);
+            }
 
-        for (const auto& p : function_input_index)
-        {
-            get<0>(p).get() = inputs[get<1>(p)];
-            get<2>(p).get() = ctx->p_en[get<1>(p)];
-        }
+            for (const auto& p : function_input_index)
+            {
+                *get<0>(p) = inputs[get<1>(p)];
+                *get<2>(p) = ctx->p_en[get<1>(p)];
+            }
 
-        for (const auto& p : function_output_index)
-        {
-            p.first.get() = outputs[p.second];
+            for (const auto& p : function_output_index)
+            {
+                *p.first = outputs[p.second];
+            }
         }
 
+        bool plain = ctx->breakpoints.empty() && !runtime::cpu::IsTracingEnabled() &&
+                     !m_emit_timing && ddebug == nullptr;
+
         auto functor = functors.begin();
         if (m_use_tbb)
         {
@@ -1966,9 +2166,35 @@ void runtime::cpu::CPU_ExternalFunction::build()
                 throw;
             }
         }
+        else if (m_inter_op_arena && ctx->breakpoints.empty())
+        {
+            execute_inter_op_parallel(ctx);
+            ctx->pc = functors.size();
+        }
+        else if (m_frozen && plain && !ctx->first_iteration)
+        {
+            CPUExecutionContext ectx{0};
+            for (CPUKernelFunctor* functor : m_replay_functors)
+            {
+                (*functor)(ctx, &ectx);
+            }
+            ctx->pc = functors.size();
+        }
+        else if (plain)
+        {
+            // Nothing to record per op, so call the functors directly
+            CPUExecutionContext ectx{0};
+            const size_t count = functors.size();
+            for (; ctx->pc < count; ctx->pc++)
+            {
+                if (enables[ctx->pc](ctx) || ctx->first_iteration)
+                {
+                    functors[ctx->pc](ctx, &ectx);
+                }
+            }
+        }
         else
         {
-            static const auto ddebug = std::getenv("NGRAPH_DEX_DEBUG");
             if (ddebug != nullptr)
             {
                 if (ctx->first_iteration)
@@ -2047,6 +2273,10 @@ void runtime::cpu::CPU_ExternalFunction::build()
                 }
             }
         }
+        if (ctx->first_iteration && m_frozen)
+        {
+            record_replay(ctx);
+        }
         ctx->first_iteration = false;
         if (runtime::cpu::IsTracingEnabled())
         {
@@ -2063,6 +2293,330 @@ void runtime::cpu::CPU_ExternalFunction::build()
     }
 }
 
+void runtime::cpu::CPU_ExternalFunction::index_original_constants(
+    const vector<shared_ptr<ngraph::op::Constant>>& constants)
+{
+    unordered_map<const Node*, string> compiled;
+    for (auto& node : get_plain_constants(m_function))
+    {
+        compiled[node.get()] = node->get_output_tensor(0).get_name();
+    }
+
+    m_original_constants.clear();
+    for (auto& constant : constants)
+    {
+        OriginalConstant original;
+        original.element_type = constant->get_element_type();
+        original.shape = constant->get_shape();
+        original.hash = 0;
+        original.read_at_build = false;
+        auto it = compiled.find(constant.get());
+        if (it != compiled.end())
+        {
+            original.tensor_name = it->second;
+            original.read_at_build = is_read_at_build(*constant);
+        }
+        else
+        {
+            original.hash = ngraph::pass::ConstantDeduplication::hash_constant(*constant);
+        }
+        m_original_constants.push_back(original);
+    }
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::update_constants(const shared_ptr<Function>& updated)
+{
+    if (!m_direct_execution)
+    {
+        throw ngraph_error("Constants can only be updated in direct execution mode");
+    }
+    if (!m_constant_updates || !m_is_built)
+    {
+        throw ngraph_error("Constant updates must be enabled before the function is compiled");
+    }
+
+    auto constants = get_plain_constants(updated);
+    if (constants.size() != m_original_constants.size())
+    {
+        throw ngraph_error("Updated function has " + to_string(constants.size()) +
+                           " constants, the compiled function " +
+                           to_string(m_original_constants.size()));
+    }
+
+    // Check every Constant before changing any, so a failed update leaves the function as it was
+    vector<pair<const OriginalConstant*, shared_ptr<ngraph::op::Constant>>> changes;
+    for (size_t i = 0; i < constants.size(); i++)
+    {
+        const OriginalConstant& original = m_original_constants[i];
+        const auto& constant = constants[i];
+        if (constant->get_element_type() != original.element_type ||
+            constant->get_shape() != original.shape)
+        {
+            throw ngraph_error("Constant " + constant->get_name() +
+                               " does not match the element type and shape of constant " +
+                               to_string(i) + " of the compiled function");
+        }
+
+        if (original.tensor_name.empty())
+        {
+            if (ngraph::pass::ConstantDeduplication::hash_constant(*constant) != original.hash)
+            {
+                throw ngraph_error("Constant " + constant->get_name() +
+                                   " was folded into other ops when compiling, changing it "
+                                   "requires compiling again");
+            }
+            continue;
+        }
+
+        size_t size = shape_size(original.shape) * original.element_type.size();
+        if (memcmp(tensor_data.at(original.tensor_name), constant->get_data_ptr(), size) == 0)
+        {
+            continue;
+        }
+        if (original.read_at_build)
+        {
+            throw ngraph_error("Constant " + constant->get_name() +
+                               " is a quantization parameter, changing it requires compiling "
+                               "again");
+        }
+        changes.emplace_back(&original, constant);
+    }
+
+    // The data of the original Constants may be shared with other functions, so the tensors are
+    // pointed at the new data instead of overwriting it
+    for (auto& change : changes)
+    {
+        const string& name = change.first->tensor_name;
+        m_updated_constants[name] = change.second;
+        tensor_data[name] = const_cast<void*>(change.second->get_data_ptr());
+        auto repacks = m_constant_repacks.find(name);
+        if (repacks != m_constant_repacks.end())
+        {
+            for (auto& repack : repacks->second)
+            {
+                repack(change.second->get_data_ptr());
+            }
+        }
+    }
+    return changes.size();
+}
+
+void runtime::cpu::CPU_ExternalFunction::add_constant_repack(
+    const string& tensor_name, function<void(const void*)> repack)
+{
+    m_constant_repacks[tensor_name].push_back(move(repack));
+}
+
+void runtime::cpu::CPU_ExternalFunction::record_replay(CPURuntimeContext* ctx)
+{
+    // The enables only look at the stale flags, so evaluating them in order with every input
+    // marked stale leaves exactly the functors that depend on an input or can't be cached
+    for (const auto& p : function_input_index)
+    {
+        *get<2>(p) = true;
+    }
+    m_replay_functors.clear();
+    for (size_t i = 0; i < functors.size(); i++)
+    {
+        if (enables[i](ctx))
+        {
+            m_replay_functors.push_back(&functors[i]);
+        }
+    }
+}
+
+void runtime::cpu::CPU_ExternalFunction::build_op_dependencies(const vector<Node*>& ops)
+{
+    using PoolRange = pair<size_t, size_t>;
+
+    // Only tensors living in the temporary pool can be recycled by the memory planner
+    // between ops that are otherwise independent
+    auto add_pool_range = [&](const descriptor::Tensor& tensor, vector<PoolRange>& ranges) {
+        auto it = m_tensor_roles.find(tensor.get_name());
+        if (it != m_tensor_roles.end() && it->second == CPUTensorRole::INTERMEDIATE &&
+            tensor.size() > 0)
+        {
+            ranges.emplace_back(tensor.get_pool_offset(), tensor.get_pool_offset() + tensor.size());
+        }
+    };
+
+    // The pool is swept in op order as disjoint segments, each holding the last op that wrote
+    // it and the ops that read it since. An op then only waits for those, the earlier accesses
+    // are ordered before them already.
+    const size_t no_writer = numeric_limits<size_t>::max();
+    struct PoolSegment
+    {
+        size_t writer;
+        vector<size_t> readers;
+    };
+    map<size_t, PoolSegment> segments{{0, PoolSegment{no_writer, {}}}};
+    // Returns the segment starting at offset, splitting the one containing it
+    auto split = [&](size_t offset) {
+        auto it = prev(segments.upper_bound(offset));
+        if (it->first == offset)
+        {
+            return it;
+        }
+        return segments.emplace_hint(next(it), offset, it->second);
+    };
+
+    unordered_map<const Node*, size_t> op_index;
+    m_op_dependency_counts.assign(ops.size(), 0);
+    m_op_successors.assign(ops.size(), vector<size_t>());
+    for (size_t j = 0; j < ops.size(); j++)
+    {
+        op_index[ops[j]] = j;
+        set<size_t> predecessors;
+        for (auto& arg : ops[j]->get_arguments())
+        {
+            auto it = op_index.find(arg.get());
+            if (it != op_index.end())
+            {
+                predecessors.insert(it->second);
+            }
+        }
+        for (auto& dep : ops[j]->get_control_dependencies())
+        {
+            auto it = op_index.find(dep.get());
+            if (it != op_index.end())
+            {
+                predecessors.insert(it->second);
+            }
+        }
+
+        vector<PoolRange> reads;
+        vector<PoolRange> writes;
+        for (const descriptor::Input& input : ops[j]->get_inputs())
+        {
+            add_pool_range(input.get_output().get_tensor(), reads);
+        }
+        for (const descriptor::Output& output : ops[j]->get_outputs())
+        {
+            add_pool_range(output.get_tensor(), writes);
+        }
+        // Reads wait for the last writer, writes also for the readers since
+        for (auto& range : reads)
+        {
+            for (auto it = split(range.first), end = split(range.second); it != end; ++it)
+            {
+                if (it->second.writer != no_writer)
+                {
+                    predecessors.insert(it->second.writer);
+                }
+            }
+        }
+        for (auto& range : writes)
+        {
+            for (auto it = split(range.first), end = split(range.second); it != end; ++it)
+            {
+                if (it->second.writer != no_writer)
+                {
+                    predecessors.insert(it->second.writer);
+                }
+                predecessors.insert(it->second.readers.begin(), it->second.readers.end());
+            }
+        }
+        for (auto& range : reads)
+        {
+            for (auto it = split(range.first), end = split(range.second); it != end; ++it)
+            {
+                it->second.readers.push_back(j);
+            }
+        }
+        for (auto& range : writes)
+        {
+            auto first = split(range.first);
+            auto end = split(range.second);
+            segments.erase(next(first), end);
+            first->second = PoolSegment{j, {}};
+        }
+
+        m_op_dependency_counts[j] = predecessors.size();
+        for (auto i : predecessors)
+        {
+            m_op_successors[i].push_back(j);
+        }
+    }
+    m_op_pending.reset(new atomic<size_t>[ops.size()]);
+}
+
+void runtime::cpu::CPU_ExternalFunction::execute_inter_op_parallel(CPURuntimeContext* ctx)
+{
+    for (size_t i = 0; i < functors.size(); i++)
+    {
+        m_op_pending[i].store(m_op_dependency_counts[i], memory_order_relaxed);
+    }
+
+    bool record_timing = runtime::cpu::IsTracingEnabled() || m_emit_timing;
+    m_inter_op_arena->execute([&]() {
+        tbb::task_group tasks;
+        function<void(size_t)> run_op = [&](size_t index) {
+            if (enables.at(index)(ctx) || ctx->first_iteration)
+            {
+                cpu::Timestamp start_ts, end_ts;
+                if (record_timing)
+                {
+                    start_ts = cpu::Clock::now();
+                }
+                // Concurrently running ops get disjoint intra-op thread pools
+                CPUExecutionContext ectx{m_intra_op_thread_pool_base +
+                                         tbb::this_task_arena::current_thread_index()};
+                size_t running = ++m_running_ops;
+                size_t max_running = m_max_concurrent_ops.load(memory_order_relaxed);
+                while (running > max_running &&
+                       !m_max_concurrent_ops.compare_exchange_weak(max_running, running))
+                {
+                }
+                executor::GetCPUExecutor().execute(functors.at(index), ctx, &ectx);
+                --m_running_ops;
+                if (record_timing)
+                {
+                    end_ts = cpu::Clock::now();
+                    auto duration =
+                        std::chrono::duration_cast<cpu::Timescale>(end_ts - start_ts).count();
+                    if (runtime::cpu::IsTracingEnabled())
+                    {
+                        ctx->op_durations[index] = duration;
+                    }
+                    if (m_emit_timing)
+                    {
+                        m_perf_counters[index].m_total_microseconds += duration;
+                        m_perf_counters[index].m_call_count++;
+                    }
+                }
+            }
+            else
+            {
+                if (runtime::cpu::IsTracingEnabled())
+                {
+                    ctx->op_durations[index] = 0;
+                }
+                if (m_emit_timing)
+                {
+                    m_perf_counters[index].m_call_count++;
+                }
+            }
+
+            for (auto successor : m_op_successors[index])
+            {
+                if (m_op_pending[successor].fetch_sub(1, memory_order_acq_rel) == 1)
+                {
+                    tasks.run([&run_op, successor]() { run_op(successor); });
+                }
+            }
+        };
+
+        for (size_t i = 0; i < functors.size(); i++)
+        {
+            if (m_op_dependency_counts[i] == 0)
+            {
+                tasks.run([&run_op, i]() { run_op(i); });
+            }
+        }
+        tasks.wait();
+    });
+}
+
 void*& runtime::cpu::CPU_ExternalFunction::get_tensor_data(const std::string& name)
 {
     if (tensor_alias.count(name))
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <list>
 #include <map>
@@ -31,6 +32,8 @@
 #include <Halide.h>
 #endif
 
+#include <tbb/task_arena.h>
+
 #if !defined(NGRAPH_DEX_ONLY)
 
 #include "ngraph/codegen/code_writer.hpp"
@@ -41,8 +44,11 @@
 
 #include "ngraph/function.hpp"
 #include "ngraph/op/concat.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/pass/constant_deduplication.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/pass_config.hpp"
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
@@ -133,8 +139,7 @@ namespace ngraph
                 std::vector<CPUKernelFunctor>& get_functors() { return functors; }
                 std::unordered_map<std::string, void*>& get_tensor_data() { return tensor_data; }
                 void*& get_tensor_data(const std::string& name);
-                std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>&
-                    get_executor()
+                std::function<void(CPURuntimeContext*, void**, void**)>& get_executor()
                 {
                     return executor;
                 }
@@ -144,6 +149,41 @@ namespace ngraph
                     return callees;
                 }
                 bool is_direct_execution() const { return m_direct_execution; }
+                size_t get_inter_op_parallelism() const { return m_inter_op_parallelism; }
+                /// \brief Most ops seen running at the same time with inter-op parallelism
+                size_t get_max_concurrent_ops() const { return m_max_concurrent_ops; }
+                bool is_frozen() const { return m_frozen; }
+                size_t get_optimization_level() const { return m_optimization_level; }
+                /// \brief Time of each pass run when compiling, with the op count change when
+                ///     pass profiling is enabled
+                const std::vector<ngraph::pass::PassProfile>& get_pass_profiles() const
+                {
+                    return m_pass_profiles;
+                }
+                /// \brief Layout conversions of the compiled function
+                const LayoutConversionStats& get_layout_conversions() const
+                {
+                    return m_layout_conversions;
+                }
+                /// \brief Counts the ConvertLayout ops of `function` and the bytes they write
+                static void count_layout_conversions(const Function& function,
+                                                     size_t& count,
+                                                     size_t& bytes);
+
+                /// \brief Points the Constants of the compiled function at the data of the
+                ///     matching Constants of `updated`, a copy of the function as it was before
+                ///     compiling with different Constant values. Constants are matched in
+                ///     topological order. Results computed only from constants, such as weights
+                ///     converted to MKLDNN layouts, are recomputed when the call frame's runtime
+                ///     context is next set up. Requires constant updates to have been enabled
+                ///     before building. Nothing is changed if any Constant can't be updated.
+                /// \return The number of Constants whose data changed
+                size_t update_constants(const std::shared_ptr<ngraph::Function>& updated);
+                /// \brief Registers `repack` to be called with the new data when
+                ///     update_constants() changes the constant tensor `tensor_name`. For builders
+                ///     that copy constant data into their own buffers, like packed GEMM weights.
+                void add_constant_repack(const std::string& tensor_name,
+                                         std::function<void(const void*)> repack);
                 void write_to_file(const std::string& code,
                                    const std::string& directory,
                                    const std::string& filename);
@@ -184,6 +224,11 @@ namespace ngraph
             private:
                 // Register passes that are common to codegen and DEX
                 void register_common_passes(ngraph::pass::Manager& pass_manager);
+                // NGRAPH_CPU_OPT_LEVEL, or 2 when it is not set
+                static size_t get_default_optimization_level();
+                // Finds where the Constants the function had before the passes ran ended up
+                void index_original_constants(
+                    const std::vector<std::shared_ptr<ngraph::op::Constant>>& constants);
 
                 // For non-destructive passthrough kernels, propagate function
                 // constant buffers to internal ops
@@ -215,6 +260,19 @@ namespace ngraph
                                               size_t input_index,
                                               size_t input_offset);
 
+                // Record, for every functor, the functors that have to complete before it
+                // may start: producers of its arguments, control dependencies and earlier
+                // functors whose memory pool ranges it reads or overwrites
+                void build_op_dependencies(const std::vector<Node*>& ops);
+
+                // Run the functors on the inter-op arena as soon as their dependencies
+                // are satisfied
+                void execute_inter_op_parallel(CPURuntimeContext* ctx);
+
+                // Record the functors that run when every function input has been modified,
+                // for frozen execution to replay without evaluating the enables
+                void record_replay(CPURuntimeContext* ctx);
+
                 bool computes_result(Node* node);
                 void release_function() { m_function = nullptr; }
 #if !defined(NGRAPH_DEX_ONLY)
@@ -254,6 +312,40 @@ namespace ngraph
                 bool m_emit_timing;
 
                 bool m_use_tbb;
+                // Number of functors that may run concurrently in DEX mode
+                size_t m_inter_op_parallelism;
+                // Replay the functors recorded on the first call instead of walking all of them
+                bool m_frozen;
+                // 0 to 2, selects the optimization passes run by register_common_passes
+                size_t m_optimization_level;
+                std::vector<ngraph::pass::PassProfile> m_pass_profiles;
+                LayoutConversionStats m_layout_conversions;
+                // 1 or 0 to choose elementwise layouts by cost or not, -1 to do so at level 2
+                int m_layout_cost_model;
+                // Shares constant data with other Functions compiled by the same backend
+                std::shared_ptr<ngraph::pass::ConstantStore> m_constant_store;
+                // Keep every Constant in its own tensor, so update_constants() can change it
+                bool m_constant_updates;
+                // A Constant of the function as it was before the passes ran
+                struct OriginalConstant
+                {
+                    element::Type element_type;
+                    Shape shape;
+                    // Tensor holding the data in the compiled function, empty when the passes
+                    // folded the Constant into other ops
+                    std::string tensor_name;
+                    // Payload hash, to check that a folded Constant is left unchanged
+                    size_t hash;
+                    // The kernels read the data when they are built, as for quantization scales
+                    bool read_at_build;
+                };
+                std::vector<OriginalConstant> m_original_constants;
+                // Constants passed to update_constants(), owning the data their tensors use
+                std::unordered_map<std::string, std::shared_ptr<ngraph::op::Constant>>
+                    m_updated_constants;
+                // Called with the new data of a constant tensor when it is updated
+                std::unordered_map<std::string, std::vector<std::function<void(const void*)>>>
+                    m_constant_repacks;
 #if !defined(NGRAPH_DEX_ONLY)
                 bool m_is_compiled;
 #endif
@@ -279,20 +371,27 @@ namespace ngraph
                 std::vector<std::function<bool(CPURuntimeContext*)>> enables;
                 std::list<std::pair<std::function<bool(CPURuntimeContext*)>, std::string>>
                     enable_nodename_list;
-                std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>
-                    executor;
+                std::function<void(CPURuntimeContext*, void** inputs, void** outputs)> executor;
                 std::unordered_map<std::string, void*> tensor_data;
                 std::unordered_map<std::string, bool> tensor_stale;
                 std::unordered_map<std::string, std::string> tensor_alias;
                 std::unordered_map<std::string, size_t> function_input_name_index;
-                std::list<std::pair<std::reference_wrapper<void*>, size_t>> intermediates_offsets;
-                std::list<std::tuple<std::reference_wrapper<void*>, size_t, size_t>>
-                    intermediate_input_index_offset;
-                std::list<
-                    std::tuple<std::reference_wrapper<void*>, size_t, std::reference_wrapper<bool>>>
-                    function_input_index;
-                std::list<std::pair<std::reference_wrapper<void*>, size_t>> function_output_index;
+                // Slots in tensor_data the functors read their buffer addresses from, and where
+                // each one is rebound from on a call. Kept in flat arrays so rebinding is a
+                // linear walk over pointers.
+                std::vector<std::pair<void**, size_t>> intermediates_offsets;
+                std::vector<std::tuple<void**, size_t, size_t>> intermediate_input_index_offset;
+                std::vector<std::tuple<void**, size_t, bool*>> function_input_index;
+                std::vector<std::pair<void**, size_t>> function_output_index;
                 std::unordered_map<std::string, std::shared_ptr<CPU_ExternalFunction>> callees;
+                std::vector<size_t> m_op_dependency_counts;
+                std::vector<std::vector<size_t>> m_op_successors;
+                std::unique_ptr<std::atomic<size_t>[]> m_op_pending;
+                std::atomic<size_t> m_running_ops{0};
+                std::atomic<size_t> m_max_concurrent_ops{0};
+                std::unique_ptr<tbb::task_arena> m_inter_op_arena;
+                int m_intra_op_thread_pool_base;
+                std::vector<CPUKernelFunctor*> m_replay_functors;
                 bool m_is_built;
                 std::vector<runtime::PerformanceCounter> m_perf_counters;
 
@@ -104,6 +104,60 @@ namespace cblas
                            const int64_t* ldc_array,
                            const int64_t group_count,
                            const int64_t* group_size);
+
+    float* cblas_sgemm_alloc(const Ident identifier,
+                             const int64_t M,
+                             const int64_t N,
+                             const int64_t K);
+
+    void cblas_sgemm_pack(const Layout layout,
+                          const Ident identifier,
+                          const Transpose trans,
+                          const int64_t M,
+                          const int64_t N,
+                          const int64_t K,
+                          const float alpha,
+                          const float* src,
+                          const int64_t ld,
+                          float* dest);
+
+    // transa and transb take a Transpose value or Storage::Packed
+    void cblas_sgemm_compute(const Layout layout,
+                             const int64_t transa,
+                             const int64_t transb,
+                             const int64_t M,
+                             const int64_t N,
+                             const int64_t K,
+                             const float* A,
+                             const int64_t lda,
+                             const float* B,
+                             const int64_t ldb,
+                             const float beta,
+                             float* C,
+                             const int64_t ldc);
+
+    void cblas_sgemm_free(float* dest);
+
+    // C = alpha * (op(A) + ao) * (op(B) + bo) + beta * C + co with signed 8-bit A, unsigned
+    // 8-bit B and 32-bit accumulation
+    void cblas_gemm_s8u8s32(const Layout layout,
+                            const Transpose transa,
+                            const Transpose transb,
+                            const Offset offsetc,
+                            const int64_t M,
+                            const int64_t N,
+                            const int64_t K,
+                            const float alpha,
+                            const void* A,
+                            const int64_t lda,
+                            const int8_t ao,
+                            const void* B,
+                            const int64_t ldb,
+                            const int8_t bo,
+                            const float beta,
+                            int32_t* C,
+                            const int64_t ldc,
+                            const int32_t* co);
     }
 }
 
@@ -69,6 +69,9 @@ namespace ngraph
                 State* const* states;
                 std::set<size_t> breakpoints;
                 size_t pc;
+                // Bytes Result ops copied into the outputs during the current call, rather than
+                // having their producers write there directly
+                size_t output_bytes_copied;
 #ifdef NGRAPH_DISTRIBUTED
                 MLSL::Environment* mlsl_env;
                 MLSL::Distribution* mlsl_dist;
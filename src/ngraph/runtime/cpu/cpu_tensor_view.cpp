@@ -108,6 +108,36 @@ void runtime::cpu::CPUTensorView::write(const void* source, size_t tensor_offset
     memcpy(&target[tensor_offset], source, n);
 }
 
+bool runtime::cpu::CPUTensorView::needs_layout_conversion() const
+{
+    auto tvl = this->get_tensor_layout();
+    auto cpu_tvl = dynamic_cast<runtime::cpu::LayoutDescriptor*>(tvl.get());
+    if (!cpu_tvl)
+    {
+        return false;
+    }
+    if (!cpu_tvl->is_mkldnn_layout())
+    {
+        return false;
+    }
+    if (cpu_tvl->get_size() <= 1)
+    {
+        return false;
+    }
+    auto native_md = mkldnn_utils::create_blocked_mkldnn_md(
+        this->get_shape(), cpu_tvl->get_strides(), this->get_element_type());
+    if (mkldnn_utils::compare_mkldnn_mds(cpu_tvl->get_mkldnn_md(), native_md))
+    {
+        return false;
+    }
+    return true;
+}
+
+void* runtime::cpu::CPUTensorView::get_host_data_ptr()
+{
+    return needs_layout_conversion() ? nullptr : aligned_buffer;
+}
+
 void runtime::cpu::CPUTensorView::read(void* target, size_t tensor_offset, size_t n) const
 {
     if (tensor_offset + n > buffer_size)
@@ -115,34 +145,9 @@ void runtime::cpu::CPUTensorView::read(void* target, size_t tensor_offset, size_
         throw out_of_range("read access past end of tensor");
     }
 
-    auto tvl = this->get_tensor_layout();
-    auto cpu_tvl = dynamic_cast<runtime::cpu::LayoutDescriptor*>(tvl.get());
-
-    auto needs_conversion = [&]() {
-        if (!cpu_tvl)
-        {
-            return false;
-        }
-        if (!cpu_tvl->is_mkldnn_layout())
-        {
-            return false;
-        }
-        if (cpu_tvl->get_size() <= 1)
-        {
-            return false;
-        }
-        auto native_md = mkldnn_utils::create_blocked_mkldnn_md(
-            this->get_shape(), cpu_tvl->get_strides(), this->get_element_type());
-        if (mkldnn_utils::compare_mkldnn_mds(cpu_tvl->get_mkldnn_md(), native_md))
-        {
-            return false;
-        }
-        return true;
-    };
-
-    if (needs_conversion())
+    if (needs_layout_conversion())
     {
-        auto tensor_shape = this->get_shape();
+        auto cpu_tvl = static_cast<runtime::cpu::LayoutDescriptor*>(get_tensor_layout().get());
         auto input_desc = cpu_tvl->get_mkldnn_md();
         auto output_desc = mkldnn_utils::create_blocked_mkldnn_md(
             this->get_shape(), cpu_tvl->get_strides(), this->get_element_type());
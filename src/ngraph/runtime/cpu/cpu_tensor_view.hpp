@@ -57,6 +57,8 @@ namespace ngraph
                 /// \param n Number of bytes to read, must be integral number of elements.
                 void read(void* p, size_t tensor_offset, size_t n) const override;
 
+                void* get_host_data_ptr() override;
+
                 static constexpr int BufferAlignment = NGRAPH_CPU_ALIGNMENT;
 
             private:
@@ -64,6 +66,9 @@ namespace ngraph
                 CPUTensorView(CPUTensorView&&) = delete;
                 CPUTensorView& operator=(const CPUTensorView&) = delete;
 
+                // True if the data is held in an MKLDNN layout other than row-major
+                bool needs_layout_conversion() const;
+
                 char* buffer;
                 char* aligned_buffer;
                 size_t buffer_size;
@@ -16,7 +16,13 @@
 
 #pragma once
 
-#include "ngraph/runtime/reference/batch_norm.hpp"
+#include <algorithm>
+#include <cmath>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -27,6 +33,9 @@ namespace ngraph
         {
             namespace kernel
             {
+                // The input is viewed as [N, C, S] where S covers all spatial axes, so every
+                // (n, c) pair owns a contiguous row of S elements.
+
                 template <typename ElementType>
                 void batch_norm_training(double eps,
                                          const void* arg0,
@@ -35,16 +44,69 @@ namespace ngraph
                                          void* out0,
                                          void* out1,
                                          void* out2,
-                                         const Shape& arg2_shape)
+                                         const Shape& arg2_shape,
+                                         int arena)
                 {
-                    reference::batch_norm_training(eps,
-                                                   static_cast<const ElementType*>(arg0),
-                                                   static_cast<const ElementType*>(arg1),
-                                                   static_cast<const ElementType*>(arg2),
-                                                   static_cast<ElementType*>(out0),
-                                                   static_cast<ElementType*>(out1),
-                                                   static_cast<ElementType*>(out2),
-                                                   arg2_shape);
+                    auto gamma = static_cast<const ElementType*>(arg0);
+                    auto beta = static_cast<const ElementType*>(arg1);
+                    auto input = static_cast<const ElementType*>(arg2);
+                    auto normed = static_cast<ElementType*>(out0);
+                    auto mean = static_cast<ElementType*>(out1);
+                    auto variance = static_cast<ElementType*>(out2);
+
+                    size_t batch = arg2_shape[0];
+                    size_t channels = arg2_shape[1];
+                    if (shape_size(arg2_shape) == 0)
+                    {
+                        return;
+                    }
+                    size_t spatial = shape_size(arg2_shape) / (batch * channels);
+                    size_t count = batch * spatial;
+
+                    // Each channel is reduced and normalized by the same task. The statistics
+                    // are gathered in one pass as sums of differences from the first element
+                    // of the channel, which keeps the variance accurate for large means.
+                    Eigen::TensorOpCost cost(2 * count * sizeof(ElementType),
+                                             count * sizeof(ElementType),
+                                             4 * count);
+                    auto compute = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index c = first; c < last; c++)
+                        {
+                            double shift = input[c * spatial];
+                            double sum = 0;
+                            double square_sum = 0;
+                            for (size_t n = 0; n < batch; n++)
+                            {
+                                const ElementType* row = input + (n * channels + c) * spatial;
+                                for (size_t s = 0; s < spatial; s++)
+                                {
+                                    double diff = row[s] - shift;
+                                    sum += diff;
+                                    square_sum += diff * diff;
+                                }
+                            }
+                            double channel_mean = shift + sum / count;
+                            double channel_var =
+                                std::max(square_sum / count - (sum / count) * (sum / count), 0.0);
+                            mean[c] = static_cast<ElementType>(channel_mean);
+                            variance[c] = static_cast<ElementType>(channel_var);
+
+                            ElementType scale =
+                                static_cast<ElementType>(gamma[c] / std::sqrt(channel_var + eps));
+                            ElementType offset =
+                                static_cast<ElementType>(beta[c] - channel_mean * scale);
+                            for (size_t n = 0; n < batch; n++)
+                            {
+                                size_t row = (n * channels + c) * spatial;
+                                for (size_t s = 0; s < spatial; s++)
+                                {
+                                    normed[row + s] = input[row + s] * scale + offset;
+                                }
+                            }
+                        }
+                    };
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        channels, cost, compute);
                 }
 
                 template <typename ElementType>
@@ -55,16 +117,43 @@ namespace ngraph
                                           const void* arg3,
                                           const void* arg4,
                                           void* out0,
-                                          const Shape& arg2_shape)
+                                          const Shape& arg2_shape,
+                                          int arena)
                 {
-                    reference::batch_norm_inference(eps,
-                                                    static_cast<const ElementType*>(arg0),
-                                                    static_cast<const ElementType*>(arg1),
-                                                    static_cast<const ElementType*>(arg2),
-                                                    static_cast<const ElementType*>(arg3),
-                                                    static_cast<const ElementType*>(arg4),
-                                                    static_cast<ElementType*>(out0),
-                                                    arg2_shape);
+                    auto gamma = static_cast<const ElementType*>(arg0);
+                    auto beta = static_cast<const ElementType*>(arg1);
+                    auto input = static_cast<const ElementType*>(arg2);
+                    auto mean = static_cast<const ElementType*>(arg3);
+                    auto variance = static_cast<const ElementType*>(arg4);
+                    auto normed = static_cast<ElementType*>(out0);
+
+                    size_t channels = arg2_shape[1];
+                    size_t rows = arg2_shape[0] * channels;
+                    if (shape_size(arg2_shape) == 0)
+                    {
+                        return;
+                    }
+                    size_t spatial = shape_size(arg2_shape) / rows;
+
+                    // Normalization folds into one multiply-add per element
+                    Eigen::TensorOpCost cost(
+                        spatial * sizeof(ElementType), spatial * sizeof(ElementType), 2 * spatial);
+                    auto compute = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index row = first; row < last; row++)
+                        {
+                            size_t c = row % channels;
+                            ElementType scale = static_cast<ElementType>(
+                                gamma[c] / std::sqrt(static_cast<double>(variance[c]) + eps));
+                            ElementType offset = beta[c] - mean[c] * scale;
+                            const ElementType* in = input + row * spatial;
+                            ElementType* out = normed + row * spatial;
+                            for (size_t s = 0; s < spatial; s++)
+                            {
+                                out[s] = in[s] * scale + offset;
+                            }
+                        }
+                    };
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(rows, cost, compute);
                 }
             }
         }
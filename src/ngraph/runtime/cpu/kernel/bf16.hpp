@@ -0,0 +1,252 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/type/bfloat16.hpp"
+
+// bf16 kernels keep tensors in bf16 in memory and do all arithmetic in f32.
+// Each element is widened on load and rounded to nearest even on store, inside a single Eigen
+// expression, so no f32 copy of the tensor is ever materialized.
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace bf16
+                {
+                    struct widen
+                    {
+                        float operator()(const bfloat16& x) const { return x; }
+                    };
+
+                    struct narrow
+                    {
+                        bfloat16 operator()(float x) const { return bfloat16(x, true); }
+                    };
+
+                    struct relu
+                    {
+                        float operator()(float x) const { return x > 0 ? x : 0; }
+                    };
+
+                    using Vector = Eigen::TensorMap<Eigen::Tensor<bfloat16, 1, Eigen::RowMajor>>;
+                    using Matrix = Eigen::TensorMap<Eigen::Tensor<bfloat16, 2, Eigen::RowMajor>>;
+
+                    /// Work buffers of one bf16 Dot. The builder gives every op its own, so
+                    /// they are allocated on the first call and reused afterwards.
+                    struct MatmulScratch
+                    {
+                        std::vector<float> a;
+                        /// One widened panel and one product buffer per concurrent worker
+                        std::vector<std::vector<float>> panels;
+                        std::vector<std::vector<float>> products;
+                    };
+                }
+
+                template <typename Op>
+                void bf16_unary(void* input, void* output, size_t count, int arena)
+                {
+                    Eigen::array<Eigen::Index, 1> dims;
+                    dims[0] = count;
+                    bf16::Vector out(static_cast<bfloat16*>(output), dims);
+                    bf16::Vector in(static_cast<bfloat16*>(input), dims);
+
+                    executor::assign_elementwise(
+                        out,
+                        in.unaryExpr(bf16::widen()).unaryExpr(Op()).unaryExpr(bf16::narrow()),
+                        count,
+                        arena);
+                }
+
+                template <typename Op>
+                void bf16_binary(void* input0, void* input1, void* output, size_t count, int arena)
+                {
+                    Eigen::array<Eigen::Index, 1> dims;
+                    dims[0] = count;
+                    bf16::Vector out(static_cast<bfloat16*>(output), dims);
+                    bf16::Vector in0(static_cast<bfloat16*>(input0), dims);
+                    bf16::Vector in1(static_cast<bfloat16*>(input1), dims);
+
+                    executor::assign_elementwise(
+                        out,
+                        in0.unaryExpr(bf16::widen())
+                            .binaryExpr(in1.unaryExpr(bf16::widen()), Op())
+                            .unaryExpr(bf16::narrow()),
+                        count,
+                        arena);
+                }
+
+                /// \brief Sums the trailing `inner` elements of each of `outer` rows, accumulating
+                ///        in f32.
+                void inline bf16_reduce_sum_innermost(
+                    void* input, void* output, size_t outer, size_t inner, int arena)
+                {
+                    Eigen::array<Eigen::Index, 2> in_dims;
+                    Eigen::array<Eigen::Index, 1> out_dims;
+                    Eigen::IndexList<Eigen::type2index<1>> reduction_dim;
+                    in_dims[0] = out_dims[0] = outer;
+                    in_dims[1] = inner;
+                    bf16::Vector out(static_cast<bfloat16*>(output), out_dims);
+                    bf16::Matrix in(static_cast<bfloat16*>(input), in_dims);
+
+                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
+                        in.unaryExpr(bf16::widen()).sum(reduction_dim).unaryExpr(bf16::narrow());
+                }
+
+                /// \brief [m, k] x [k, n] matrix product, rounded to bf16 once per result.
+                ///
+                ///        The left operand is widened once. The right one, usually the larger
+                ///        weights, is widened a panel of columns at a time into a buffer that
+                ///        stays in cache, so it is only ever read from memory as bf16. Panels
+                ///        are split across the arena's threads; a single panel uses the
+                ///        threaded contraction instead.
+                void inline bf16_matmul(void* input0,
+                                        void* input1,
+                                        void* output,
+                                        size_t m,
+                                        size_t k,
+                                        size_t n,
+                                        bf16::MatmulScratch& scratch,
+                                        int arena)
+                {
+                    auto b = static_cast<const bfloat16*>(input1);
+                    auto out = static_cast<bfloat16*>(output);
+                    auto& device = executor::GetCPUExecutor().get_device(arena);
+
+                    Eigen::array<Eigen::Index, 1> a_dims;
+                    a_dims[0] = m * k;
+                    scratch.a.resize(m * k);
+                    Eigen::TensorMap<Eigen::Tensor<float, 1, Eigen::RowMajor>> a(scratch.a.data(),
+                                                                                 a_dims);
+                    bf16::Vector a_in(static_cast<bfloat16*>(input0), a_dims);
+                    executor::assign_elementwise(a, a_in.unaryExpr(bf16::widen()), m * k, arena);
+
+                    // Keep a widened panel at roughly 256KiB
+                    const size_t panel_elements = 1 << 16;
+                    size_t panel = std::min(n, std::max<size_t>(16, panel_elements / k));
+                    size_t panels = (n + panel - 1) / panel;
+                    size_t workers =
+                        std::min(panels, static_cast<size_t>(std::max(device.numThreads(), 1)));
+                    // Sized here, before any worker runs, so the workers never reallocate
+                    scratch.panels.resize(workers);
+                    scratch.products.resize(workers);
+                    for (size_t w = 0; w < workers; w++)
+                    {
+                        scratch.panels[w].resize(k * panel);
+                        scratch.products[w].resize(m * panel);
+                    }
+
+                    Eigen::array<Eigen::IndexPair<Eigen::Index>, 1> contract_dims{
+                        {Eigen::IndexPair<Eigen::Index>(1, 0)}};
+                    auto multiply_panel = [&](size_t index, size_t worker) {
+                        size_t begin = index * panel;
+                        size_t count = std::min(panel, n - begin);
+                        float* b_panel = scratch.panels[worker].data();
+                        float* product = scratch.products[worker].data();
+                        for (size_t row = 0; row < k; row++)
+                        {
+                            const bfloat16* src = b + row * n + begin;
+                            for (size_t j = 0; j < count; j++)
+                            {
+                                b_panel[row * count + j] = src[j];
+                            }
+                        }
+
+                        Eigen::TensorMap<Eigen::Tensor<float, 2, Eigen::RowMajor>> result(
+                            product, m, count);
+                        Eigen::TensorMap<Eigen::Tensor<const float, 2, Eigen::RowMajor>> lhs(
+                            scratch.a.data(), m, k);
+                        Eigen::TensorMap<Eigen::Tensor<const float, 2, Eigen::RowMajor>> rhs(
+                            b_panel, k, count);
+                        if (workers == 1)
+                        {
+                            result.device(device) = lhs.contract(rhs, contract_dims);
+                        }
+                        else
+                        {
+                            result = lhs.contract(rhs, contract_dims);
+                        }
+
+                        for (size_t i = 0; i < m; i++)
+                        {
+                            bfloat16* dst = out + i * n + begin;
+                            for (size_t j = 0; j < count; j++)
+                            {
+                                dst[j] = bfloat16(product[i * count + j], true);
+                            }
+                        }
+                    };
+
+                    if (workers == 1)
+                    {
+                        for (size_t index = 0; index < panels; index++)
+                        {
+                            multiply_panel(index, 0);
+                        }
+                        return;
+                    }
+                    size_t worker_panels = (panels + workers - 1) / workers;
+                    Eigen::TensorOpCost cost(worker_panels * k * panel * sizeof(bfloat16),
+                                             worker_panels * m * panel * sizeof(bfloat16),
+                                             worker_panels * m * k * panel);
+                    device.parallelFor(workers, cost, [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index worker = first; worker < last; worker++)
+                        {
+                            for (size_t index = worker; index < panels; index += workers)
+                            {
+                                multiply_panel(index, worker);
+                            }
+                        }
+                    });
+                }
+
+                void inline convert_bf16_to_f32(void* input, void* output, size_t count, int arena)
+                {
+                    Eigen::array<Eigen::Index, 1> dims;
+                    dims[0] = count;
+                    Eigen::TensorMap<Eigen::Tensor<float, 1, Eigen::RowMajor>> out(
+                        static_cast<float*>(output), dims);
+                    bf16::Vector in(static_cast<bfloat16*>(input), dims);
+
+                    executor::assign_elementwise(out, in.unaryExpr(bf16::widen()), count, arena);
+                }
+
+                void inline convert_f32_to_bf16(void* input, void* output, size_t count, int arena)
+                {
+                    Eigen::array<Eigen::Index, 1> dims;
+                    dims[0] = count;
+                    bf16::Vector out(static_cast<bfloat16*>(output), dims);
+                    Eigen::TensorMap<Eigen::Tensor<float, 1, Eigen::RowMajor>> in(
+                        static_cast<float*>(input), dims);
+
+                    executor::assign_elementwise(out, in.unaryExpr(bf16::narrow()), count, arena);
+                }
+            }
+        }
+    }
+}
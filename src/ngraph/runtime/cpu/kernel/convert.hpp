@@ -41,8 +41,8 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<InputElementType, 1, Eigen::RowMajor>> in(
                         static_cast<InputElementType*>(input), in_dims);
 
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        in.template cast<OutputElementType>();
+                    executor::assign_elementwise(
+                        out, in.template cast<OutputElementType>(), count, arena);
                 }
 
                 template <typename InputElementType>
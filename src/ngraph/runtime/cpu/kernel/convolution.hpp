@@ -16,8 +16,18 @@
 
 #pragma once
 
-#include "ngraph/runtime/reference/convolution.hpp"
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+#include "ngraph/type/bfloat16.hpp"
 
 namespace ngraph
 {
@@ -27,6 +37,58 @@ namespace ngraph
         {
             namespace kernel
             {
+                /// \brief Work buffers of one convolution op. The builder gives every op its
+                ///        own, so they are allocated on the first call and reused afterwards.
+                struct ConvolutionScratch
+                {
+                    std::vector<char> weights;
+                    /// One column and one product buffer per concurrent worker
+                    std::vector<std::vector<char>> columns;
+                    std::vector<std::vector<char>> products;
+                };
+
+                /// bf16 convolutions keep their tensors in bf16 and unroll, multiply and
+                /// accumulate in f32
+                template <typename ElementType>
+                using convolution_compute_type =
+                    typename std::conditional<std::is_same<ElementType, bfloat16>::value,
+                                              float,
+                                              ElementType>::type;
+
+                template <typename ElementType, typename ComputeType>
+                ElementType convolution_store(ComputeType value)
+                {
+                    return static_cast<ElementType>(value);
+                }
+
+                template <>
+                inline bfloat16 convolution_store<bfloat16, float>(float value)
+                {
+                    return bfloat16(value, true);
+                }
+
+                template <typename ElementType>
+                ElementType* get_scratch_buffer(std::vector<char>& buffer, size_t count)
+                {
+                    if (buffer.size() < count * sizeof(ElementType))
+                    {
+                        buffer.resize(count * sizeof(ElementType));
+                    }
+                    return reinterpret_cast<ElementType*>(buffer.data());
+                }
+
+                /// \brief Convolution for the cases MKLDNN does not take, with the same
+                ///        arguments and semantics as reference::convolution.
+                ///
+                ///        For every batch (or, for backprop filters, every input channel) the
+                ///        padded and dilated input windows are unrolled into a column matrix
+                ///        [input channels * filter size, output size] (im2col), which is then
+                ///        multiplied by the filters gathered into [output channels, input
+                ///        channels * filter size]. With at least as many batches as threads,
+                ///        each thread convolves its own batches; otherwise the batches run one
+                ///        after the other with the unrolling and the blocked Eigen contraction
+                ///        split across the arena's thread pool. Columns are processed in blocks
+                ///        so the unrolled matrices stay bounded for large inputs.
                 template <typename ElementType>
                 void convolution(void* input0,
                                  void* input1,
@@ -45,26 +107,244 @@ namespace ngraph
                                  size_t output_channel_axis_filters,
                                  size_t batch_axis_result,
                                  size_t output_channel_axis_result,
-                                 bool rotate_filter)
+                                 bool rotate_filter,
+                                 ConvolutionScratch& scratch,
+                                 int arena)
                 {
-                    reference::convolution<ElementType>(static_cast<const ElementType*>(input0),
-                                                        static_cast<const ElementType*>(input1),
-                                                        static_cast<ElementType*>(output),
-                                                        arg0_shape,
-                                                        arg1_shape,
-                                                        result_shape,
-                                                        window_movement_strides,
-                                                        window_dilation_strides,
-                                                        padding_below,
-                                                        padding_above,
-                                                        data_dilation_strides,
-                                                        batch_axis_data,
-                                                        input_channel_axis_data,
-                                                        input_channel_axis_filters,
-                                                        output_channel_axis_filters,
-                                                        batch_axis_result,
-                                                        output_channel_axis_result,
-                                                        rotate_filter);
+                    auto data = static_cast<const ElementType*>(input0);
+                    auto filters = static_cast<const ElementType*>(input1);
+                    auto out = static_cast<ElementType*>(output);
+
+                    size_t spatial_rank = arg0_shape.size() - 2;
+                    size_t batch = arg0_shape[batch_axis_data];
+                    size_t input_channels = arg0_shape[input_channel_axis_data];
+                    size_t output_channels = arg1_shape[output_channel_axis_filters];
+                    Shape data_spatial(arg0_shape.begin() + 2, arg0_shape.end());
+                    Shape filter_spatial(arg1_shape.begin() + 2, arg1_shape.end());
+                    Shape out_spatial(result_shape.begin() + 2, result_shape.end());
+                    size_t filter_size = shape_size(filter_spatial);
+                    size_t out_size = shape_size(out_spatial);
+                    if (shape_size(result_shape) == 0)
+                    {
+                        return;
+                    }
+                    if (input_channels * filter_size == 0)
+                    {
+                        std::fill(out, out + shape_size(result_shape), 0);
+                        return;
+                    }
+
+                    std::vector<size_t> data_strides = row_major_strides(arg0_shape);
+                    std::vector<size_t> filter_strides = row_major_strides(arg1_shape);
+                    std::vector<size_t> out_strides = row_major_strides(result_shape);
+
+                    // Filters as a row-major [output_channels, input_channels * filter_size]
+                    // matrix, with the spatial axes reversed when rotating. Forward filters
+                    // are already laid out that way, unless they have to be widened.
+                    using ComputeType = convolution_compute_type<ElementType>;
+                    size_t k_size = input_channels * filter_size;
+                    const ComputeType* weights = reinterpret_cast<const ComputeType*>(filters);
+                    if (rotate_filter || output_channel_axis_filters != 0 ||
+                        input_channel_axis_filters != 1 ||
+                        !std::is_same<ElementType, ComputeType>::value)
+                    {
+                        ComputeType* gathered = get_scratch_buffer<ComputeType>(
+                            scratch.weights, output_channels * k_size);
+                        for (size_t co = 0; co < output_channels; co++)
+                        {
+                            for (size_t ci = 0; ci < input_channels; ci++)
+                            {
+                                size_t base = co * filter_strides[output_channel_axis_filters] +
+                                              ci * filter_strides[input_channel_axis_filters];
+                                ComputeType* row = gathered + co * k_size + ci * filter_size;
+                                for (size_t f = 0; f < filter_size; f++)
+                                {
+                                    size_t offset = base;
+                                    size_t index = f;
+                                    for (size_t d = spatial_rank; d-- > 0;)
+                                    {
+                                        size_t coord = index % filter_spatial[d];
+                                        index /= filter_spatial[d];
+                                        if (rotate_filter)
+                                        {
+                                            coord = filter_spatial[d] - coord - 1;
+                                        }
+                                        offset += coord * filter_strides[d + 2];
+                                    }
+                                    row[f] = static_cast<ComputeType>(filters[offset]);
+                                }
+                            }
+                        }
+                        weights = gathered;
+                    }
+
+                    auto& device = executor::GetCPUExecutor().get_device(arena);
+                    size_t threads = static_cast<size_t>(device.numThreads());
+                    bool batch_parallel = threads > 1 && batch >= threads;
+                    size_t workers = batch_parallel ? threads : 1;
+
+                    // Keep the unrolled blocks at roughly 16M elements in total
+                    const size_t max_block_elements = 1 << 24;
+                    size_t block = std::max<size_t>(
+                        1, std::min(out_size, max_block_elements / (k_size * workers)));
+                    // Sized here, before any worker runs, so the workers never reallocate
+                    scratch.columns.resize(workers);
+                    scratch.products.resize(workers);
+                    for (size_t w = 0; w < workers; w++)
+                    {
+                        get_scratch_buffer<ComputeType>(scratch.columns[w], k_size * block);
+                        get_scratch_buffer<ComputeType>(scratch.products[w],
+                                                        output_channels * block);
+                    }
+
+                    Eigen::array<Eigen::IndexPair<Eigen::Index>, 1> contract_dims{
+                        {Eigen::IndexPair<Eigen::Index>(1, 0)}};
+
+                    // im2col: row (ci, f) holds the input element under filter position f for
+                    // each output position, or 0 in padding and dilation gaps
+                    auto im2col = [&](size_t n,
+                                      size_t p_begin,
+                                      size_t p_count,
+                                      ComputeType* columns,
+                                      size_t first,
+                                      size_t last) {
+                        std::vector<size_t> f_coord(spatial_rank);
+                        std::vector<size_t> p_coord(spatial_rank);
+                        for (size_t k = first; k < last; k++)
+                        {
+                            size_t ci = k / filter_size;
+                            size_t index = k % filter_size;
+                            for (size_t d = spatial_rank; d-- > 0;)
+                            {
+                                f_coord[d] = index % filter_spatial[d];
+                                index /= filter_spatial[d];
+                            }
+                            index = p_begin;
+                            for (size_t d = spatial_rank; d-- > 0;)
+                            {
+                                p_coord[d] = index % out_spatial[d];
+                                index /= out_spatial[d];
+                            }
+
+                            size_t base = n * data_strides[batch_axis_data] +
+                                          ci * data_strides[input_channel_axis_data];
+                            ComputeType* row = columns + k * p_count;
+                            for (size_t p = 0; p < p_count; p++)
+                            {
+                                size_t offset = base;
+                                bool in_bounds = true;
+                                for (size_t d = 0; d < spatial_rank && in_bounds; d++)
+                                {
+                                    // Position in the padded, dilated input
+                                    std::ptrdiff_t pos =
+                                        static_cast<std::ptrdiff_t>(
+                                            p_coord[d] * window_movement_strides[d] +
+                                            f_coord[d] * window_dilation_strides[d]) -
+                                        padding_below[d];
+                                    std::ptrdiff_t dilation = data_dilation_strides[d];
+                                    in_bounds = pos >= 0 && pos % dilation == 0 &&
+                                                static_cast<size_t>(pos / dilation) <
+                                                    data_spatial[d];
+                                    offset += (pos / dilation) * data_strides[d + 2];
+                                }
+                                row[p] = in_bounds ? static_cast<ComputeType>(data[offset]) : 0;
+
+                                for (size_t d = spatial_rank; d-- > 0;)
+                                {
+                                    if (++p_coord[d] < out_spatial[d])
+                                    {
+                                        break;
+                                    }
+                                    p_coord[d] = 0;
+                                }
+                            }
+                        }
+                    };
+
+                    // Convolves batch n into the output, using the pool inside each block
+                    // when `parallel` is set
+                    auto convolve_batch = [&](size_t n, size_t worker, bool parallel) {
+                        ComputeType* columns =
+                            reinterpret_cast<ComputeType*>(scratch.columns[worker].data());
+                        ComputeType* product =
+                            reinterpret_cast<ComputeType*>(scratch.products[worker].data());
+                        for (size_t p_begin = 0; p_begin < out_size; p_begin += block)
+                        {
+                            size_t p_count = std::min(block, out_size - p_begin);
+
+                            if (parallel)
+                            {
+                                Eigen::TensorOpCost im2col_cost(p_count * sizeof(ElementType),
+                                                                p_count * sizeof(ComputeType),
+                                                                0);
+                                device.parallelFor(
+                                    k_size,
+                                    im2col_cost,
+                                    [&](Eigen::Index first, Eigen::Index last) {
+                                        im2col(n, p_begin, p_count, columns, first, last);
+                                    });
+                            }
+                            else
+                            {
+                                im2col(n, p_begin, p_count, columns, 0, k_size);
+                            }
+
+                            Eigen::TensorMap<Eigen::Tensor<ComputeType, 2, Eigen::RowMajor>>
+                                result(product, output_channels, p_count);
+                            Eigen::TensorMap<
+                                Eigen::Tensor<const ComputeType, 2, Eigen::RowMajor>>
+                                lhs(weights, output_channels, k_size);
+                            Eigen::TensorMap<
+                                Eigen::Tensor<const ComputeType, 2, Eigen::RowMajor>>
+                                rhs(columns, k_size, p_count);
+                            if (parallel)
+                            {
+                                result.device(device) = lhs.contract(rhs, contract_dims);
+                            }
+                            else
+                            {
+                                result = lhs.contract(rhs, contract_dims);
+                            }
+
+                            for (size_t co = 0; co < output_channels; co++)
+                            {
+                                ElementType* dst = out + n * out_strides[batch_axis_result] +
+                                                   co * out_strides[output_channel_axis_result] +
+                                                   p_begin;
+                                const ComputeType* src = product + co * p_count;
+                                for (size_t p = 0; p < p_count; p++)
+                                {
+                                    dst[p] = convolution_store<ElementType>(src[p]);
+                                }
+                            }
+                        }
+                    };
+
+                    if (!batch_parallel)
+                    {
+                        for (size_t n = 0; n < batch; n++)
+                        {
+                            convolve_batch(n, 0, true);
+                        }
+                        return;
+                    }
+
+                    // Worker w takes batches w, w + workers, ... with its own buffers, so no
+                    // two threads ever share a column or product buffer
+                    size_t worker_batches = (batch + workers - 1) / workers;
+                    Eigen::TensorOpCost cost(
+                        worker_batches * k_size * out_size * sizeof(ElementType),
+                        worker_batches * output_channels * out_size * sizeof(ElementType),
+                        worker_batches * output_channels * k_size * out_size);
+                    device.parallelFor(workers, cost, [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index worker = first; worker < last; worker++)
+                        {
+                            for (size_t n = worker; n < batch; n += workers)
+                            {
+                                convolve_batch(n, worker, false);
+                            }
+                        }
+                    });
                 }
             }
         }
@@ -41,8 +41,11 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in0(
                         static_cast<ElementType*>(input0), in_dims);
 
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        in0.unaryExpr(Eigen::internal::scalar_cosh_op<ElementType>());
+                    executor::assign_elementwise(
+                        out,
+                        in0.unaryExpr(Eigen::internal::scalar_cosh_op<ElementType>()),
+                        count,
+                        arena);
                 }
             }
         }
@@ -43,9 +43,12 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in1(
                         static_cast<ElementType*>(input1), in_dims);
 
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
+                    executor::assign_elementwise(
+                        out,
                         in0.binaryExpr(in1,
-                                       Eigen::internal::scalar_pow_op<ElementType, ElementType>());
+                                       Eigen::internal::scalar_pow_op<ElementType, ElementType>()),
+                        count,
+                        arena);
                 }
             }
         }
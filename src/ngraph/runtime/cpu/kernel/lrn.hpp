@@ -0,0 +1,103 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Local response normalization across channels.
+                ///
+                ///        The input is viewed as [N, C, S] with S covering all spatial axes. Each
+                ///        output row (n, c) sums the squares of the rows of the `nsize` channels
+                ///        centred on c, matching reference::lrn, with contiguous row operations.
+                template <typename ElementType>
+                void lrn(void* input,
+                         void* output,
+                         const Shape& arg_shape,
+                         double alpha,
+                         double beta,
+                         double bias,
+                         size_t nsize,
+                         int arena)
+                {
+                    auto in = static_cast<const ElementType*>(input);
+                    auto out = static_cast<ElementType*>(output);
+
+                    size_t channels = arg_shape[1];
+                    size_t rows = arg_shape[0] * channels;
+                    if (shape_size(arg_shape) == 0)
+                    {
+                        return;
+                    }
+                    size_t spatial = shape_size(arg_shape) / rows;
+                    size_t before = (nsize - 1) / 2;
+                    size_t after = nsize - 1 - before;
+                    ElementType scale = static_cast<ElementType>(alpha / nsize);
+                    ElementType k = static_cast<ElementType>(bias);
+                    ElementType b = static_cast<ElementType>(beta);
+
+                    Eigen::TensorOpCost cost(nsize * spatial * sizeof(ElementType),
+                                             spatial * sizeof(ElementType),
+                                             (2 * nsize + 10) * spatial);
+                    auto compute = [&](Eigen::Index first, Eigen::Index last) {
+                        std::vector<ElementType> square_sum(spatial);
+                        for (Eigen::Index row = first; row < last; row++)
+                        {
+                            size_t c = row % channels;
+                            size_t batch_row = row - c;
+                            size_t c_begin = c < before ? 0 : c - before;
+                            size_t c_end = std::min(channels, c + after + 1);
+
+                            std::fill(square_sum.begin(), square_sum.end(), 0);
+                            for (size_t i = c_begin; i < c_end; i++)
+                            {
+                                const ElementType* x = in + (batch_row + i) * spatial;
+                                for (size_t s = 0; s < spatial; s++)
+                                {
+                                    square_sum[s] += x[s] * x[s];
+                                }
+                            }
+
+                            const ElementType* x = in + row * spatial;
+                            ElementType* y = out + row * spatial;
+                            for (size_t s = 0; s < spatial; s++)
+                            {
+                                y[s] = x[s] / std::pow(k + scale * square_sum[s], b);
+                            }
+                        }
+                    };
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(rows, cost, compute);
+                }
+            }
+        }
+    }
+}
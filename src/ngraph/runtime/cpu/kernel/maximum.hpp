@@ -43,8 +43,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in1(
                         static_cast<ElementType*>(input1), in_dims);
 
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        in0.cwiseMax(in1);
+                    executor::assign_elementwise(out, in0.cwiseMax(in1), count, arena);
                 }
             }
         }
@@ -43,8 +43,8 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in1(
                         static_cast<ElementType*>(input1), in_dims);
 
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        (in0 != in1).template cast<char>();
+                    executor::assign_elementwise(
+                        out, (in0 != in1).template cast<char>(), count, arena);
                 }
             }
         }
@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "packed_gemm.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                PackedSgemmWeights::PackedSgemmWeights(bool transpose,
+                                                       size_t m,
+                                                       size_t n,
+                                                       size_t k,
+                                                       const float* weights,
+                                                       size_t ld)
+                    : m_transpose(transpose)
+                    , m_m(m)
+                    , m_n(n)
+                    , m_k(k)
+                    , m_ld(ld)
+                    , m_packed(nullptr)
+                {
+                    m_packed = cblas::cblas_sgemm_alloc(cblas::Ident::BMatrix, m_m, m_n, m_k);
+                    if (m_packed == nullptr)
+                    {
+                        throw ngraph_error("Failed to allocate packed GEMM weights");
+                    }
+                    pack(weights);
+                }
+
+                PackedSgemmWeights::~PackedSgemmWeights() { cblas::cblas_sgemm_free(m_packed); }
+
+                void PackedSgemmWeights::pack(const float* weights)
+                {
+                    cblas::cblas_sgemm_pack(cblas::Layout::RowMajor,
+                                            cblas::Ident::BMatrix,
+                                            m_transpose ? cblas::Transpose::Transpose
+                                                        : cblas::Transpose::None,
+                                            m_m,
+                                            m_n,
+                                            m_k,
+                                            1.0f,
+                                            weights,
+                                            m_ld,
+                                            m_packed);
+                }
+
+                void PackedSgemmWeights::compute(bool transpose_a,
+                                                 const float* a,
+                                                 size_t lda,
+                                                 float beta,
+                                                 float* c,
+                                                 size_t ldc) const
+                {
+                    auto transa =
+                        transpose_a ? cblas::Transpose::Transpose : cblas::Transpose::None;
+                    cblas::cblas_sgemm_compute(cblas::Layout::RowMajor,
+                                               static_cast<int64_t>(transa),
+                                               static_cast<int64_t>(cblas::Storage::Packed),
+                                               m_m,
+                                               m_n,
+                                               m_k,
+                                               a,
+                                               lda,
+                                               m_packed,
+                                               m_ld,
+                                               beta,
+                                               c,
+                                               ldc);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,71 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Right-hand operand of a row-major single precision GEMM, packed once into
+                // the internal panel layout of the BLAS library. Products against constant
+                // weights then skip the repacking that cblas_sgemm performs on every call.
+                class PackedSgemmWeights
+                {
+                public:
+                    PackedSgemmWeights(bool transpose,
+                                       size_t m,
+                                       size_t n,
+                                       size_t k,
+                                       const float* weights,
+                                       size_t ld);
+                    ~PackedSgemmWeights();
+
+                    PackedSgemmWeights(const PackedSgemmWeights&) = delete;
+                    PackedSgemmWeights& operator=(const PackedSgemmWeights&) = delete;
+
+                    // Re-packs new weights with the same shape and transposition
+                    void pack(const float* weights);
+
+                    // c = op(a) * weights + beta * c
+                    void compute(bool transpose_a,
+                                 const float* a,
+                                 size_t lda,
+                                 float beta,
+                                 float* c,
+                                 size_t ldc) const;
+
+                    size_t get_m() const { return m_m; }
+                    size_t get_n() const { return m_n; }
+                    size_t get_k() const { return m_k; }
+                private:
+                    bool m_transpose;
+                    size_t m_m;
+                    size_t m_n;
+                    size_t m_k;
+                    size_t m_ld;
+                    float* m_packed;
+                };
+            }
+        }
+    }
+}
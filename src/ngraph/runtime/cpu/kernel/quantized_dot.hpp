@@ -0,0 +1,111 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                struct round_half_even
+                {
+                    float operator()(float x) const { return std::nearbyint(x); }
+                };
+
+                // Row-major [rows, k] u8 data times [k, m] i8 weights accumulated in i32.
+                // The optional i32 bias (length m) is folded into the GEMM as a column offset.
+                // With requantize the accumulators in `acc` are scaled, rounded half to even
+                // and saturated into output; otherwise `acc` must alias output.
+                template <typename OutputElementType>
+                void quantized_dot(const void* input0,
+                                   const void* input1,
+                                   const void* bias,
+                                   float scale,
+                                   void* output,
+                                   int32_t* acc,
+                                   size_t rows,
+                                   size_t k,
+                                   size_t m,
+                                   bool requantize,
+                                   bool with_relu,
+                                   int arena)
+                {
+                    const int32_t zero = 0;
+
+                    // Row-major C = D * W is computed as column-major C' = W' * D'
+                    cblas::cblas_gemm_s8u8s32(cblas::Layout::ColMajor,
+                                              cblas::Transpose::None,
+                                              cblas::Transpose::None,
+                                              bias ? cblas::Offset::ColOffset
+                                                   : cblas::Offset::FixOffset,
+                                              m,
+                                              rows,
+                                              k,
+                                              1.0f,
+                                              input1,
+                                              m,
+                                              0,
+                                              input0,
+                                              k,
+                                              0,
+                                              0.0f,
+                                              acc,
+                                              m,
+                                              bias ? static_cast<const int32_t*>(bias) : &zero);
+
+                    Eigen::array<Eigen::Index, 1> dims;
+                    dims[0] = rows * m;
+                    Eigen::TensorMap<Eigen::Tensor<int32_t, 1, Eigen::RowMajor>> in(acc, dims);
+                    Eigen::TensorMap<Eigen::Tensor<OutputElementType, 1, Eigen::RowMajor>> out(
+                        static_cast<OutputElementType*>(output), dims);
+                    auto& device = executor::GetCPUExecutor().get_device(arena);
+
+                    if (!requantize)
+                    {
+                        if (with_relu)
+                        {
+                            out.device(device) = in.cwiseMax(0).template cast<OutputElementType>();
+                        }
+                        return;
+                    }
+
+                    using limits = std::numeric_limits<OutputElementType>;
+                    float lowest = with_relu ? 0.0f : static_cast<float>(limits::min());
+                    float highest = static_cast<float>(limits::max());
+                    out.device(device) = (in.template cast<float>() * scale)
+                                             .unaryExpr(round_half_even())
+                                             .cwiseMax(lowest)
+                                             .cwiseMin(highest)
+                                             .template cast<OutputElementType>();
+                }
+            }
+        }
+    }
+}
@@ -16,14 +16,21 @@
 
 #pragma once
 
-#define EIGEN_USE_THREADS
-#include <unsupported/Eigen/CXX11/Tensor>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <vector>
 
 #include "ngraph/axis_set.hpp"
-#include "ngraph/runtime/backend.hpp"
-#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/pass/reduce_lowering.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/kernel/reduction.hpp"
+#include "ngraph/runtime/reference/reduce.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 
@@ -35,146 +42,205 @@ namespace ngraph
         {
             namespace kernel
             {
-                template <typename ElementType>
-                struct Reducer
+                // Reduction functions that are evaluated inline instead of through a call frame
+                enum class ReductionOp
                 {
-                    static const bool PacketAccess = false;
-                    static const bool IsStateful = false;
-
-                    ElementType initial;
-                    const std::shared_ptr<CPU_ExternalFunction>& external_function;
-                    std::shared_ptr<Backend> backend;
+                    Add,
+                    Multiply,
+                    Maximum,
+                    Minimum,
+                    And,
+                    Or,
+                    // anything else, evaluated by calling the reduction Function
+                    Function
+                };
 
-                    Reducer(ElementType x, const std::shared_ptr<CPU_ExternalFunction>& ef)
-                        : initial(x)
-                        , external_function(ef)
-                        , backend(runtime::Backend::create("CPU"))
+                inline ReductionOp get_reduction_op(const std::shared_ptr<Function>& f)
+                {
+                    auto op = ngraph::pass::ReduceLowering::get_reduction_op(f);
+                    if (!op)
                     {
+                        return ReductionOp::Function;
                     }
-
-                    void reduce(const ElementType v, ElementType* R)
+                    const std::string& name = op->description();
+                    if (name == "Add")
                     {
-                        TensorViewPtrs inputs, outputs;
-                        ElementType p __attribute__((aligned(NGRAPH_CPU_ALIGNMENT))) = v;
-                        ElementType q __attribute__((aligned(NGRAPH_CPU_ALIGNMENT))) = *R;
-                        ElementType r __attribute__((aligned(NGRAPH_CPU_ALIGNMENT)));
-
-                        inputs.emplace_back(backend->create_tensor(
-                            ngraph::element::from<ElementType>(), Shape{}, &p));
-                        inputs.emplace_back(backend->create_tensor(
-                            ngraph::element::from<ElementType>(), Shape{}, &q));
-                        outputs.emplace_back(backend->create_tensor(
-                            ngraph::element::from<ElementType>(), Shape{}, &r));
-                        auto call_frame = external_function->make_call_frame();
-                        call_frame->call(outputs, inputs);
-                        *R = r;
+                        return ReductionOp::Add;
                     }
-                    ElementType initialize() const { return initial; }
-                    ElementType finalize(const ElementType R) const { return R; }
-                };
+                    if (name == "Multiply")
+                    {
+                        return ReductionOp::Multiply;
+                    }
+                    if (name == "Maximum")
+                    {
+                        return ReductionOp::Maximum;
+                    }
+                    if (name == "Minimum")
+                    {
+                        return ReductionOp::Minimum;
+                    }
+                    if (name == "And")
+                    {
+                        return ReductionOp::And;
+                    }
+                    if (name == "Or")
+                    {
+                        return ReductionOp::Or;
+                    }
+                    return ReductionOp::Function;
+                }
 
-                template <typename ElementType, unsigned int Rank, unsigned int ReductionDims>
-                void reduce_function(void* input0,
-                                     void* input1,
-                                     void* output,
-                                     const Shape& input_shape,
-                                     const Shape& output_shape,
-                                     const AxisSet& reduction_axes,
-                                     int arena,
-                                     const std::shared_ptr<CPU_ExternalFunction>& external_function)
+                template <typename ElementType>
+                std::function<ElementType(ElementType, ElementType)>
+                    get_inline_reducer(ReductionOp op)
                 {
-                    Eigen::array<Eigen::Index, Rank> in_dims;
-                    Eigen::array<Eigen::Index, Rank - ReductionDims> out_dims;
-                    Eigen::array<Eigen::Index, ReductionDims> reduction_dims;
+                    switch (op)
+                    {
+                    case ReductionOp::Add:
+                        return [](ElementType a, ElementType b) { return a + b; };
+                    case ReductionOp::Multiply:
+                        return [](ElementType a, ElementType b) { return a * b; };
+                    case ReductionOp::Maximum:
+                        return [](ElementType a, ElementType b) { return a < b ? b : a; };
+                    case ReductionOp::Minimum:
+                        return [](ElementType a, ElementType b) { return b < a ? b : a; };
+                    case ReductionOp::And:
+                        return [](ElementType a, ElementType b) { return a && b; };
+                    case ReductionOp::Or:
+                        return [](ElementType a, ElementType b) { return a || b; };
+                    case ReductionOp::Function:
+                        break;
+                    }
+                    throw ngraph_error("Reduction function has no inline equivalent");
+                }
 
-                    for (int i = 0; i < Rank; i++)
+                /// \brief Evaluates a scalar reduction Function through a single call frame.
+                ///
+                ///        Built once per op. The call frame is pinned to scalar slots of this
+                ///        object, so after the first evaluation binds them each evaluation only
+                ///        runs the compiled function's kernels. Not safe to share between
+                ///        threads.
+                class FunctionReducer
+                {
+                public:
+                    FunctionReducer(const std::shared_ptr<CPU_ExternalFunction>& external_function)
+                        : m_call_frame(external_function->make_call_frame())
+                        , m_slots(3 * NGRAPH_CPU_ALIGNMENT, NGRAPH_CPU_ALIGNMENT)
                     {
-                        in_dims[i] = input_shape[i];
+                        void* inputs[] = {slot(0), slot(1)};
+                        void* outputs[] = {slot(2)};
+                        m_call_frame->pin(outputs, inputs);
                     }
 
-                    for (int i = 0; i < Rank - ReductionDims; i++)
+                    FunctionReducer(const FunctionReducer&) = delete;
+                    FunctionReducer& operator=(const FunctionReducer&) = delete;
+
+                    template <typename ElementType>
+                    ElementType operator()(ElementType a, ElementType b)
                     {
-                        out_dims[i] = output_shape[i];
+                        static_assert(sizeof(ElementType) <= sizeof(Slot),
+                                      "Element type does not fit a reducer slot");
+                        std::memcpy(slot(0), &a, sizeof(ElementType));
+                        std::memcpy(slot(1), &b, sizeof(ElementType));
+                        m_call_frame->call_pinned();
+                        ElementType result;
+                        std::memcpy(&result, slot(2), sizeof(ElementType));
+                        return result;
                     }
 
-                    int i = 0;
-                    for (auto axis : reduction_axes)
+                private:
+                    // Large enough for any element type
+                    using Slot = uint64_t;
+
+                    void* slot(size_t index) const
                     {
-                        reduction_dims[i++] = axis;
+                        return m_slots.get_ptr(index * NGRAPH_CPU_ALIGNMENT);
                     }
 
-                    Eigen::TensorMap<
-                        Eigen::Tensor<ElementType, Rank - ReductionDims, Eigen::RowMajor>>
-                        out(static_cast<ElementType*>(output), out_dims);
-                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(
-                        static_cast<ElementType*>(input0), in_dims);
-                    Reducer<ElementType> reducer(*static_cast<ElementType*>(input1),
-                                                 external_function);
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        in.reduce(reduction_dims, reducer);
-                }
+                    std::shared_ptr<CPU_CallFrame> m_call_frame;
+                    // The two arguments and the result, each on its own aligned line like the
+                    // tensors the compiled function expects
+                    AlignedBuffer m_slots;
+                };
 
-                template <typename ElementType, unsigned int Rank>
-                void reduce_function_1rd(
-                    void* input0,
-                    void* input1,
-                    void* output,
-                    const Shape& input_shape,
-                    const Shape& output_shape,
-                    const AxisSet& reduction_axes,
-                    int arena,
-                    const std::shared_ptr<CPU_ExternalFunction>& external_function)
+                /// \brief Reduces with `Reducer` directly, then combines every output element
+                ///        with the initial value once.
+                template <typename ElementType, typename Reducer>
+                void reduce_inline(void* input0,
+                                   void* input1,
+                                   void* output,
+                                   const Shape& input_shape,
+                                   const Shape& output_shape,
+                                   const AxisSet& reduction_axes,
+                                   int arena)
                 {
-                    reduce_function<ElementType, Rank, 1>(input0,
-                                                          input1,
-                                                          output,
-                                                          input_shape,
-                                                          output_shape,
-                                                          reduction_axes,
-                                                          arena,
-                                                          external_function);
+                    reduce_any_axes<ElementType, Reducer>(
+                        input0, output, input_shape, reduction_axes, arena);
+                    ElementType init = *static_cast<const ElementType*>(input1);
+                    auto out = static_cast<ElementType*>(output);
+                    for (size_t i = 0; i < shape_size(output_shape); i++)
+                    {
+                        out[i] = Reducer::reduce(init, out[i]);
+                    }
                 }
 
                 template <typename ElementType>
-                void reduce_function_2d_2rd(
-                    void* input0,
-                    void* input1,
-                    void* output,
-                    const Shape& input_shape,
-                    const Shape& output_shape,
-                    const AxisSet& reduction_axes,
-                    int arena,
-                    const std::shared_ptr<CPU_ExternalFunction>& external_function)
+                void reduce_function(void* input0,
+                                     void* input1,
+                                     void* output,
+                                     const Shape& input_shape,
+                                     const Shape& output_shape,
+                                     const AxisSet& reduction_axes,
+                                     ReductionOp op,
+                                     FunctionReducer* reducer,
+                                     int arena)
                 {
-                    reduce_function<ElementType, 2, 2>(input0,
-                                                       input1,
-                                                       output,
-                                                       input_shape,
-                                                       output_shape,
-                                                       reduction_axes,
-                                                       arena,
-                                                       external_function);
-                }
+                    void (*inline_kernel)(
+                        void*, void*, void*, const Shape&, const Shape&, const AxisSet&, int) =
+                        nullptr;
+                    switch (op)
+                    {
+                    case ReductionOp::Add:
+                        inline_kernel = reduce_inline<ElementType, SumReducer<ElementType>>;
+                        break;
+                    case ReductionOp::Multiply:
+                        inline_kernel = reduce_inline<ElementType, ProductReducer<ElementType>>;
+                        break;
+                    case ReductionOp::Maximum:
+                        inline_kernel = reduce_inline<ElementType, MaxReducer<ElementType>>;
+                        break;
+                    case ReductionOp::Minimum:
+                        inline_kernel = reduce_inline<ElementType, MinReducer<ElementType>>;
+                        break;
+                    case ReductionOp::And:
+                        inline_kernel = reduce_inline<ElementType, AndReducer<ElementType>>;
+                        break;
+                    case ReductionOp::Or:
+                        inline_kernel = reduce_inline<ElementType, OrReducer<ElementType>>;
+                        break;
+                    case ReductionOp::Function:
+                        break;
+                    }
+                    if (inline_kernel)
+                    {
+                        inline_kernel(input0,
+                                      input1,
+                                      output,
+                                      input_shape,
+                                      output_shape,
+                                      reduction_axes,
+                                      arena);
+                        return;
+                    }
 
-                template <typename ElementType>
-                void reduce_function_3d_2rd(
-                    void* input0,
-                    void* input1,
-                    void* output,
-                    const Shape& input_shape,
-                    const Shape& output_shape,
-                    const AxisSet& reduction_axes,
-                    int arena,
-                    const std::shared_ptr<CPU_ExternalFunction>& external_function)
-                {
-                    reduce_function<ElementType, 3, 2>(input0,
-                                                       input1,
-                                                       output,
-                                                       input_shape,
-                                                       output_shape,
-                                                       reduction_axes,
-                                                       arena,
-                                                       external_function);
+                    reference::reduce<ElementType>(
+                        static_cast<const ElementType*>(input0),
+                        static_cast<const ElementType*>(input1),
+                        static_cast<ElementType*>(output),
+                        input_shape,
+                        output_shape,
+                        reduction_axes,
+                        [reducer](ElementType a, ElementType b) { return (*reducer)(a, b); });
                 }
             }
         }
@@ -16,10 +16,7 @@
 
 #pragma once
 
-#include "ngraph/runtime/backend.hpp"
-#include "ngraph/runtime/cpu/cpu_external_function.hpp"
-#include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
-
+#include "ngraph/runtime/cpu/kernel/reduce_function.hpp"
 #include "ngraph/runtime/reference/reduce_window.hpp"
 
 namespace ngraph
@@ -39,38 +36,32 @@ namespace ngraph
                     const Shape& output_shape,
                     const Shape& window_shape,
                     const Strides& window_movement_strides,
-                    const std::shared_ptr<CPU_ExternalFunction>& external_function)
+                    ReductionOp op,
+                    FunctionReducer* reducer)
                 {
-                    auto backend = runtime::Backend::create("CPU");
-
-                    auto reducer = [&](ElementType a, ElementType b) {
-                        TensorViewPtrs inputs, outputs;
-
-                        ElementType p __attribute__((aligned(NGRAPH_CPU_ALIGNMENT))) = a;
-                        ElementType q __attribute__((aligned(NGRAPH_CPU_ALIGNMENT))) = b;
-                        ElementType r __attribute__((aligned(NGRAPH_CPU_ALIGNMENT)));
-
-                        inputs.emplace_back(backend->create_tensor(
-                            ngraph::element::from<ElementType>(), Shape{}, &p));
-                        inputs.emplace_back(backend->create_tensor(
-                            ngraph::element::from<ElementType>(), Shape{}, &q));
-                        outputs.emplace_back(backend->create_tensor(
-                            ngraph::element::from<ElementType>(), Shape{}, &r));
-
-                        auto call_frame = external_function->make_call_frame();
-                        call_frame->call(outputs, inputs);
-
-                        return r;
-                    };
+                    if (op != ReductionOp::Function)
+                    {
+                        reference::reduce_window<ElementType>(
+                            static_cast<const ElementType*>(input0),
+                            static_cast<const ElementType*>(input1),
+                            static_cast<ElementType*>(output),
+                            input_shape,
+                            output_shape,
+                            get_inline_reducer<ElementType>(op),
+                            window_shape,
+                            window_movement_strides);
+                        return;
+                    }
 
-                    reference::reduce_window<ElementType>(static_cast<const ElementType*>(input0),
-                                                          static_cast<const ElementType*>(input1),
-                                                          static_cast<ElementType*>(output),
-                                                          input_shape,
-                                                          output_shape,
-                                                          reducer,
-                                                          window_shape,
-                                                          window_movement_strides);
+                    reference::reduce_window<ElementType>(
+                        static_cast<const ElementType*>(input0),
+                        static_cast<const ElementType*>(input1),
+                        static_cast<ElementType*>(output),
+                        input_shape,
+                        output_shape,
+                        [reducer](ElementType a, ElementType b) { return (*reducer)(a, b); },
+                        window_shape,
+                        window_movement_strides);
                 }
             }
         }
@@ -20,7 +20,7 @@
 #include <unsupported/Eigen/CXX11/Tensor>
 
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
-#include "ngraph/runtime/reference/min.hpp"
+#include "ngraph/runtime/cpu/kernel/reduction.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -176,11 +176,8 @@ namespace ngraph
                          const AxisSet& reduction_axes,
                          int arena)
                 {
-                    reference::min(static_cast<ElementType*>(arg),
-                                   static_cast<ElementType*>(out),
-                                   in_shape,
-                                   out_shape,
-                                   reduction_axes);
+                    reduce_any_axes<ElementType, MinReducer<ElementType>>(
+                        arg, out, in_shape, reduction_axes, arena);
                 }
             }
         }
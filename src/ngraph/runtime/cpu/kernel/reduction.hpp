@@ -0,0 +1,288 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Drops unit axes and merges runs of adjacent axes that are all reduced
+                ///        or all kept. The reduction is unchanged in memory, but usually ends up
+                ///        with a rank the Eigen kernels are instantiated for.
+                inline void coalesce_reduction_axes(Shape& shape, AxisSet& reduction_axes)
+                {
+                    Shape coalesced_shape;
+                    AxisSet coalesced_axes;
+                    bool last_reduced = false;
+                    for (size_t i = 0; i < shape.size(); i++)
+                    {
+                        if (shape[i] == 1)
+                        {
+                            continue;
+                        }
+                        bool reduced = reduction_axes.count(i) != 0;
+                        if (!coalesced_shape.empty() && reduced == last_reduced)
+                        {
+                            coalesced_shape.back() *= shape[i];
+                            continue;
+                        }
+                        if (reduced)
+                        {
+                            coalesced_axes.insert(coalesced_shape.size());
+                        }
+                        coalesced_shape.push_back(shape[i]);
+                        last_reduced = reduced;
+                    }
+                    shape = coalesced_shape;
+                    reduction_axes = coalesced_axes;
+                }
+
+                template <typename ElementType>
+                struct SumReducer
+                {
+                    static ElementType identity() { return 0; }
+                    static ElementType reduce(ElementType a, ElementType b) { return a + b; }
+                };
+
+                template <typename ElementType>
+                struct ProductReducer
+                {
+                    static ElementType identity() { return 1; }
+                    static ElementType reduce(ElementType a, ElementType b) { return a * b; }
+                };
+
+                template <typename ElementType>
+                struct MaxReducer
+                {
+                    static ElementType identity()
+                    {
+                        return std::numeric_limits<ElementType>::has_infinity
+                                   ? -std::numeric_limits<ElementType>::infinity()
+                                   : std::numeric_limits<ElementType>::lowest();
+                    }
+                    static ElementType reduce(ElementType a, ElementType b)
+                    {
+                        return b > a ? b : a;
+                    }
+                };
+
+                template <typename ElementType>
+                struct MinReducer
+                {
+                    static ElementType identity()
+                    {
+                        return std::numeric_limits<ElementType>::has_infinity
+                                   ? std::numeric_limits<ElementType>::infinity()
+                                   : std::numeric_limits<ElementType>::max();
+                    }
+                    static ElementType reduce(ElementType a, ElementType b)
+                    {
+                        return b < a ? b : a;
+                    }
+                };
+
+                template <typename ElementType>
+                struct AndReducer
+                {
+                    static ElementType identity() { return 1; }
+                    static ElementType reduce(ElementType a, ElementType b) { return a && b; }
+                };
+
+                template <typename ElementType>
+                struct OrReducer
+                {
+                    static ElementType identity() { return 0; }
+                    static ElementType reduce(ElementType a, ElementType b) { return a || b; }
+                };
+
+                /// \brief Calls f(offset) for the offset of every coordinate in `dims`, where
+                ///        axis i advances the offset by strides[i], starting from `base`.
+                template <typename F>
+                void for_each_offset(const std::vector<size_t>& dims,
+                                     const std::vector<size_t>& strides,
+                                     size_t base,
+                                     F f)
+                {
+                    size_t count = shape_size(dims);
+                    std::vector<size_t> coord(dims.size(), 0);
+                    size_t offset = base;
+                    for (size_t n = 0; n < count; n++)
+                    {
+                        f(offset);
+                        for (size_t i = dims.size(); i-- > 0;)
+                        {
+                            offset += strides[i];
+                            if (++coord[i] < dims[i])
+                            {
+                                break;
+                            }
+                            offset -= coord[i] * strides[i];
+                            coord[i] = 0;
+                        }
+                    }
+                }
+
+                /// \brief Rank-agnostic reduction used when no Eigen kernel matches the
+                ///        coalesced shape.
+                ///
+                ///        When the innermost axis is reduced every output element is produced by
+                ///        one task, reading contiguous runs of the input. Otherwise each task
+                ///        owns a block of contiguous output elements and accumulates input rows
+                ///        into it, so the block stays in cache while all reduced coordinates are
+                ///        visited.
+                template <typename ElementType, typename Reducer>
+                void reduce_any_axes(const void* arg,
+                                     void* out,
+                                     const Shape& in_shape,
+                                     const AxisSet& in_reduction_axes,
+                                     int arena)
+                {
+                    auto input = static_cast<const ElementType*>(arg);
+                    auto output = static_cast<ElementType*>(out);
+
+                    Shape shape = in_shape;
+                    AxisSet reduction_axes = in_reduction_axes;
+                    coalesce_reduction_axes(shape, reduction_axes);
+
+                    size_t out_size = 1;
+                    for (size_t i = 0; i < shape.size(); i++)
+                    {
+                        if (reduction_axes.count(i) == 0)
+                        {
+                            out_size *= shape[i];
+                        }
+                    }
+                    if (out_size == 0)
+                    {
+                        return;
+                    }
+                    if (reduction_axes.empty())
+                    {
+                        std::copy(input, input + out_size, output);
+                        return;
+                    }
+                    if (shape_size(shape) == 0)
+                    {
+                        std::fill(output, output + out_size, Reducer::identity());
+                        return;
+                    }
+
+                    // Split the outer axes into kept and reduced ones, with their input strides
+                    size_t rank = shape.size();
+                    bool inner_reduced = reduction_axes.count(rank - 1) != 0;
+                    size_t inner = shape[rank - 1];
+                    std::vector<size_t> strides = row_major_strides(shape);
+                    std::vector<size_t> kept_dims, kept_strides, reduced_dims, reduced_strides;
+                    for (size_t i = 0; i + 1 < rank; i++)
+                    {
+                        if (reduction_axes.count(i) != 0)
+                        {
+                            reduced_dims.push_back(shape[i]);
+                            reduced_strides.push_back(strides[i]);
+                        }
+                        else
+                        {
+                            kept_dims.push_back(shape[i]);
+                            kept_strides.push_back(strides[i]);
+                        }
+                    }
+                    size_t reduced_count = shape_size(reduced_dims);
+
+                    // Input offset of the first element contributing to kept coordinate `index`
+                    auto kept_offset = [&](size_t index) {
+                        size_t offset = 0;
+                        for (size_t i = kept_dims.size(); i-- > 0;)
+                        {
+                            offset += (index % kept_dims[i]) * kept_strides[i];
+                            index /= kept_dims[i];
+                        }
+                        return offset;
+                    };
+
+                    auto& device = executor::GetCPUExecutor().get_device(arena);
+                    size_t reduced_size = reduced_count * (inner_reduced ? inner : 1);
+                    if (inner_reduced)
+                    {
+                        Eigen::TensorOpCost cost(
+                            reduced_size * sizeof(ElementType), sizeof(ElementType), reduced_size);
+                        device.parallelFor(
+                            out_size, cost, [&](Eigen::Index first, Eigen::Index last) {
+                                for (Eigen::Index o = first; o < last; o++)
+                                {
+                                    ElementType acc = Reducer::identity();
+                                    auto accumulate = [&](size_t offset) {
+                                        const ElementType* row = input + offset;
+                                        for (size_t j = 0; j < inner; j++)
+                                        {
+                                            acc = Reducer::reduce(acc, row[j]);
+                                        }
+                                    };
+                                    for_each_offset(
+                                        reduced_dims, reduced_strides, kept_offset(o), accumulate);
+                                    output[o] = acc;
+                                }
+                            });
+                        return;
+                    }
+
+                    const size_t block_size = 1024;
+                    size_t blocks_per_row = (inner + block_size - 1) / block_size;
+                    size_t rows = out_size / inner;
+                    size_t block = std::min(inner, block_size);
+                    Eigen::TensorOpCost cost(reduced_size * block * sizeof(ElementType),
+                                             block * sizeof(ElementType),
+                                             reduced_size * block);
+                    device.parallelFor(
+                        rows * blocks_per_row, cost, [&](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index task = first; task < last; task++)
+                            {
+                                size_t row = task / blocks_per_row;
+                                size_t begin = (task % blocks_per_row) * block_size;
+                                size_t end = std::min(inner, begin + block_size);
+                                ElementType* y = output + row * inner;
+                                std::fill(y + begin, y + end, Reducer::identity());
+                                auto accumulate = [&](size_t offset) {
+                                    const ElementType* x = input + offset;
+                                    for (size_t j = begin; j < end; j++)
+                                    {
+                                        y[j] = Reducer::reduce(y[j], x[j]);
+                                    }
+                                };
+                                for_each_offset(
+                                    reduced_dims, reduced_strides, kept_offset(row), accumulate);
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
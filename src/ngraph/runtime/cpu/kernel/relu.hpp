@@ -42,8 +42,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in0(
                         static_cast<ElementType*>(input0), in_dims);
 
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        in0.cwiseMax(ElementType(0));
+                    executor::assign_elementwise(out, in0.cwiseMax(ElementType(0)), count, arena);
                 }
 
                 template <typename ElementType>
@@ -59,8 +58,8 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in0(
                         static_cast<ElementType*>(input0), in_dims);
 
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        in0.cwiseMax(ElementType(0)).cwiseMin(alpha);
+                    executor::assign_elementwise(
+                        out, in0.cwiseMax(ElementType(0)).cwiseMin(alpha), count, arena);
                 }
 
                 template <typename ElementType>
@@ -76,8 +75,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in0(
                         static_cast<ElementType*>(input0), in_dims);
 
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        in0.cwiseMax(in0 * alpha);
+                    executor::assign_elementwise(out, in0.cwiseMax(in0 * alpha), count, arena);
                 }
 
                 template <typename ElementType>
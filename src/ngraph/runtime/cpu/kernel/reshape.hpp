@@ -16,12 +16,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
-#include "ngraph/runtime/reference/reshape.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -144,6 +147,72 @@ namespace ngraph
                                                      arena);
                 }
 
+                /// \brief Drops unit axes and merges input axes that stay next to each other
+                ///        in the output. The permutation moves the same bytes, usually at a lower
+                ///        rank.
+                inline void coalesce_transpose(Shape& shape, AxisVector& axis_order)
+                {
+                    Shape dims;
+                    std::vector<size_t> new_axis(shape.size());
+                    for (size_t i = 0; i < shape.size(); i++)
+                    {
+                        if (shape[i] != 1)
+                        {
+                            new_axis[i] = dims.size();
+                            dims.push_back(shape[i]);
+                        }
+                    }
+
+                    // Runs of consecutive input axes in output order, as [first, last]
+                    std::vector<std::pair<size_t, size_t>> runs;
+                    for (size_t axis : axis_order)
+                    {
+                        if (shape[axis] == 1)
+                        {
+                            continue;
+                        }
+                        if (!runs.empty() && runs.back().second + 1 == new_axis[axis])
+                        {
+                            runs.back().second = new_axis[axis];
+                        }
+                        else
+                        {
+                            runs.emplace_back(new_axis[axis], new_axis[axis]);
+                        }
+                    }
+
+                    std::vector<size_t> run_order(runs.size());
+                    for (size_t i = 0; i < runs.size(); i++)
+                    {
+                        run_order[i] = i;
+                    }
+                    std::sort(run_order.begin(), run_order.end(), [&](size_t a, size_t b) {
+                        return runs[a].first < runs[b].first;
+                    });
+
+                    Shape coalesced_shape(runs.size());
+                    AxisVector coalesced_order(runs.size());
+                    for (size_t i = 0; i < run_order.size(); i++)
+                    {
+                        const std::pair<size_t, size_t>& run = runs[run_order[i]];
+                        coalesced_shape[i] = 1;
+                        for (size_t axis = run.first; axis <= run.second; axis++)
+                        {
+                            coalesced_shape[i] *= dims[axis];
+                        }
+                        coalesced_order[run_order[i]] = i;
+                    }
+                    shape = coalesced_shape;
+                    axis_order = coalesced_order;
+                }
+
+                /// \brief Rank-agnostic transpose for permutations the Eigen kernels are not
+                ///        instantiated for.
+                ///
+                ///        If the innermost axis stays innermost, whole rows are copied. Otherwise
+                ///        the output is produced in square tiles spanning the output's innermost
+                ///        axis and the axis that is innermost in the input, so both the reads and
+                ///        the writes of a tile touch only a few cache lines each.
                 template <typename ElementType>
                 void reshape(const void* arg,
                              void* out,
@@ -152,11 +221,108 @@ namespace ngraph
                              const Shape& out_shape,
                              int arena)
                 {
-                    reference::reshape(static_cast<const ElementType*>(arg),
-                                       static_cast<ElementType*>(out),
-                                       in_shape,
-                                       in_axis_order,
-                                       out_shape);
+                    auto input = static_cast<const ElementType*>(arg);
+                    auto output = static_cast<ElementType*>(out);
+
+                    Shape shape = in_shape;
+                    AxisVector axis_order = in_axis_order;
+                    coalesce_transpose(shape, axis_order);
+                    size_t rank = shape.size();
+                    size_t size = shape_size(shape);
+                    if (rank <= 1 || size == 0)
+                    {
+                        std::copy(input, input + size, output);
+                        return;
+                    }
+
+                    // Output dimensions, with the input stride that each of them walks
+                    std::vector<size_t> in_strides = row_major_strides(shape);
+                    std::vector<size_t> out_dims(rank), out_in_strides(rank);
+                    for (size_t i = 0; i < rank; i++)
+                    {
+                        out_dims[i] = shape[axis_order[i]];
+                        out_in_strides[i] = in_strides[axis_order[i]];
+                    }
+                    std::vector<size_t> out_strides = row_major_strides(out_dims);
+
+                    auto& device = executor::GetCPUExecutor().get_device(arena);
+                    size_t inner = out_dims[rank - 1];
+                    if (axis_order[rank - 1] == rank - 1)
+                    {
+                        Eigen::TensorOpCost cost(
+                            inner * sizeof(ElementType), inner * sizeof(ElementType), inner);
+                        device.parallelFor(
+                            size / inner, cost, [&](Eigen::Index first, Eigen::Index last) {
+                                for (Eigen::Index row = first; row < last; row++)
+                                {
+                                    size_t in_offset = 0;
+                                    size_t index = row;
+                                    for (size_t i = rank - 1; i-- > 0;)
+                                    {
+                                        in_offset += (index % out_dims[i]) * out_in_strides[i];
+                                        index /= out_dims[i];
+                                    }
+                                    memcpy(output + row * inner,
+                                           input + in_offset,
+                                           inner * sizeof(ElementType));
+                                }
+                            });
+                        return;
+                    }
+
+                    // Tile the output axis that is contiguous in the input against the output's
+                    // innermost axis. Every other output axis is walked one index at a time.
+                    const size_t tile = 32;
+                    size_t p = std::find(axis_order.begin(), axis_order.end(), rank - 1) -
+                               axis_order.begin();
+                    std::vector<size_t> outer_axes;
+                    for (size_t i = 0; i + 1 < rank; i++)
+                    {
+                        if (i != p)
+                        {
+                            outer_axes.push_back(i);
+                        }
+                    }
+                    size_t outer = size / (out_dims[p] * inner);
+                    size_t p_tiles = (out_dims[p] + tile - 1) / tile;
+                    size_t inner_tiles = (inner + tile - 1) / tile;
+
+                    Eigen::TensorOpCost cost(
+                        tile * tile * sizeof(ElementType), tile * tile * sizeof(ElementType), 0);
+                    auto compute = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index task = first; task < last; task++)
+                        {
+                            size_t inner_tile = task % inner_tiles;
+                            size_t p_tile = (task / inner_tiles) % p_tiles;
+                            size_t index = task / (inner_tiles * p_tiles);
+
+                            size_t in_offset = 0;
+                            size_t out_offset = 0;
+                            for (size_t i = outer_axes.size(); i-- > 0;)
+                            {
+                                size_t axis = outer_axes[i];
+                                size_t coord = index % out_dims[axis];
+                                index /= out_dims[axis];
+                                in_offset += coord * out_in_strides[axis];
+                                out_offset += coord * out_strides[axis];
+                            }
+
+                            size_t p_end = std::min(out_dims[p], (p_tile + 1) * tile);
+                            size_t j_begin = inner_tile * tile;
+                            size_t j_end = std::min(inner, j_begin + tile);
+                            size_t in_stride = out_in_strides[rank - 1];
+                            for (size_t i = p_tile * tile; i < p_end; i++)
+                            {
+                                ElementType* y = output + out_offset + i * out_strides[p];
+                                const ElementType* x = input + in_offset + i;
+                                for (size_t j = j_begin; j < j_end; j++)
+                                {
+                                    y[j] = x[j * in_stride];
+                                }
+                            }
+                        }
+                    };
+                    device.parallelFor(outer * p_tiles * inner_tiles, cost, compute);
                 }
             }
         }
@@ -46,8 +46,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in2(
                         static_cast<ElementType*>(input2), in_dims);
 
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        in0.select(in1, in2);
+                    executor::assign_elementwise(out, in0.select(in1, in2), count, arena);
                 }
             }
         }
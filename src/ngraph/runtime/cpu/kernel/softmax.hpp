@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <cmath>
+#include <limits>
+#include <vector>
+
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
@@ -164,6 +168,82 @@ namespace ngraph
                 {
                     softmax<ElementType, 4, 3>(input, output, input_shape, softmax_axes, arena);
                 }
+
+                /// \brief Softmax over any set of axes, for the cases the Eigen kernels above
+                ///        are not instantiated for.
+                ///
+                ///        The offsets of the elements within one softmax group, and of the first
+                ///        element of every group, are computed once per call. Groups are spread
+                ///        across threads. Each group takes one pass for a running max and sum of
+                ///        exponentials, rescaling the sum whenever the max grows, and one pass
+                ///        to write the normalized output.
+                template <typename ElementType>
+                void softmax_any_axes(void* input,
+                                      void* output,
+                                      const Shape& input_shape,
+                                      const AxisSet& softmax_axes,
+                                      int arena)
+                {
+                    auto in = static_cast<const ElementType*>(input);
+                    auto out = static_cast<ElementType*>(output);
+
+                    std::vector<size_t> strides = row_major_strides(input_shape);
+                    std::vector<size_t> group_offsets{0};
+                    std::vector<size_t> group_bases{0};
+                    for (size_t axis = 0; axis < input_shape.size(); axis++)
+                    {
+                        std::vector<size_t>& offsets =
+                            softmax_axes.count(axis) != 0 ? group_offsets : group_bases;
+                        std::vector<size_t> expanded;
+                        expanded.reserve(offsets.size() * input_shape[axis]);
+                        for (size_t offset : offsets)
+                        {
+                            for (size_t i = 0; i < input_shape[axis]; i++)
+                            {
+                                expanded.push_back(offset + i * strides[axis]);
+                            }
+                        }
+                        offsets.swap(expanded);
+                    }
+                    if (group_offsets.empty() || group_bases.empty())
+                    {
+                        return;
+                    }
+
+                    size_t group_size = group_offsets.size();
+                    Eigen::TensorOpCost cost(2 * group_size * sizeof(ElementType),
+                                             group_size * sizeof(ElementType),
+                                             40 * group_size);
+                    auto compute = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index g = first; g < last; g++)
+                        {
+                            const ElementType* x = in + group_bases[g];
+                            ElementType* y = out + group_bases[g];
+                            ElementType max = -std::numeric_limits<ElementType>::infinity();
+                            ElementType sum = 0;
+                            for (size_t offset : group_offsets)
+                            {
+                                ElementType value = x[offset];
+                                if (value > max)
+                                {
+                                    sum = sum * std::exp(max - value) + 1;
+                                    max = value;
+                                }
+                                else
+                                {
+                                    sum += std::exp(value - max);
+                                }
+                            }
+                            ElementType inverse_sum = 1 / sum;
+                            for (size_t offset : group_offsets)
+                            {
+                                y[offset] = std::exp(x[offset] - max) * inverse_sum;
+                            }
+                        }
+                    };
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        group_bases.size(), cost, compute);
+                }
             }
         }
     }
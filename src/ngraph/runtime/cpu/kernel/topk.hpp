@@ -0,0 +1,206 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Orders (value, index) pairs exactly like reference::topk. Indices are unique,
+                // so this is a total order and the selected elements, and their order, do not
+                // depend on how a slice is split between threads.
+                template <typename T, typename U>
+                struct TopKCompare
+                {
+                    bool compute_max;
+                    bool operator()(const std::pair<T, U>& a, const std::pair<T, U>& b) const
+                    {
+                        return compute_max ? a > b : a < b;
+                    }
+                };
+
+                // Selects the best min(k, end - begin) elements of arg[begin * stride] ..
+                // arg[(end - 1) * stride] into `selected`, best first.
+                template <typename T, typename U>
+                void topk_select(const T* arg,
+                                 size_t stride,
+                                 size_t begin,
+                                 size_t end,
+                                 size_t k,
+                                 const TopKCompare<T, U>& compare,
+                                 std::vector<std::pair<T, U>>& selected)
+                {
+                    selected.clear();
+                    size_t n = end - begin;
+                    k = std::min(k, n);
+                    if (k == 0)
+                    {
+                        return;
+                    }
+
+                    if (k * 8 <= n)
+                    {
+                        // Small k: keep the k best seen so far in a heap whose front is the
+                        // worst of them, so most elements are rejected with one comparison.
+                        selected.reserve(k);
+                        size_t i = begin;
+                        for (; i < begin + k; i++)
+                        {
+                            selected.emplace_back(arg[i * stride], static_cast<U>(i));
+                        }
+                        std::make_heap(selected.begin(), selected.end(), compare);
+                        for (; i < end; i++)
+                        {
+                            std::pair<T, U> candidate(arg[i * stride], static_cast<U>(i));
+                            if (compare(candidate, selected.front()))
+                            {
+                                std::pop_heap(selected.begin(), selected.end(), compare);
+                                selected.back() = candidate;
+                                std::push_heap(selected.begin(), selected.end(), compare);
+                            }
+                        }
+                        std::sort_heap(selected.begin(), selected.end(), compare);
+                    }
+                    else
+                    {
+                        selected.reserve(n);
+                        for (size_t i = begin; i < end; i++)
+                        {
+                            selected.emplace_back(arg[i * stride], static_cast<U>(i));
+                        }
+                        std::partial_sort(
+                            selected.begin(), selected.begin() + k, selected.end(), compare);
+                        selected.resize(k);
+                    }
+                }
+
+                template <typename T, typename U>
+                void topk(const T* arg,
+                          U* out_indices,
+                          T* out_values,
+                          const Shape& in_shape,
+                          size_t axis,
+                          size_t k,
+                          bool compute_max,
+                          int arena)
+                {
+                    // Slices along `axis` are independent. A slice starts at
+                    // arg[o * n * inner + i] and its elements are `inner` apart.
+                    size_t n = in_shape[axis];
+                    size_t outer = shape_size(Shape(in_shape.begin(), in_shape.begin() + axis));
+                    size_t inner = shape_size(Shape(in_shape.begin() + axis + 1, in_shape.end()));
+                    size_t slices = outer * inner;
+                    if (slices == 0 || k == 0)
+                    {
+                        return;
+                    }
+
+                    TopKCompare<T, U> compare{compute_max};
+                    auto& device = executor::GetCPUExecutor().get_device(arena);
+                    auto slice_input = [&](size_t slice) {
+                        return arg + (slice / inner) * n * inner + slice % inner;
+                    };
+                    auto write_slice = [&](size_t slice,
+                                           const std::vector<std::pair<T, U>>& selected) {
+                        size_t out_index = (slice / inner) * k * inner + slice % inner;
+                        for (const std::pair<T, U>& entry : selected)
+                        {
+                            out_values[out_index] = entry.first;
+                            out_indices[out_index] = entry.second;
+                            out_index += inner;
+                        }
+                    };
+
+                    // Chunks are only worth their merge step for a few very long slices
+                    const size_t min_chunk_size = 16384;
+                    size_t threads = static_cast<size_t>(device.numThreads());
+                    size_t chunks = 1;
+                    if (slices < threads)
+                    {
+                        chunks = std::min(threads / slices, n / std::max(min_chunk_size, 4 * k));
+                    }
+
+                    if (chunks <= 1)
+                    {
+                        Eigen::TensorOpCost cost(n * sizeof(T), k * (sizeof(T) + sizeof(U)), n);
+                        device.parallelFor(
+                            slices, cost, [&](Eigen::Index first, Eigen::Index last) {
+                                std::vector<std::pair<T, U>> selected;
+                                for (Eigen::Index slice = first; slice < last; slice++)
+                                {
+                                    topk_select(
+                                        slice_input(slice), inner, 0, n, k, compare, selected);
+                                    write_slice(slice, selected);
+                                }
+                            });
+                        return;
+                    }
+
+                    // Each chunk selects its own k best. The k best of the slice are among
+                    // them, so merging the per-chunk winners gives the same result as a
+                    // single pass.
+                    size_t chunk_size = (n + chunks - 1) / chunks;
+                    std::vector<std::vector<std::pair<T, U>>> partial(chunks);
+                    std::vector<std::pair<T, U>> merged;
+                    Eigen::TensorOpCost cost(
+                        chunk_size * sizeof(T), k * (sizeof(T) + sizeof(U)), chunk_size);
+                    for (size_t slice = 0; slice < slices; slice++)
+                    {
+                        const T* input = slice_input(slice);
+                        device.parallelFor(
+                            chunks, cost, [&](Eigen::Index first, Eigen::Index last) {
+                                for (size_t c = first; c < last; c++)
+                                {
+                                    topk_select(input,
+                                                inner,
+                                                c * chunk_size,
+                                                std::min(n, (c + 1) * chunk_size),
+                                                k,
+                                                compare,
+                                                partial[c]);
+                                }
+                            });
+
+                        merged.clear();
+                        for (const std::vector<std::pair<T, U>>& winners : partial)
+                        {
+                            merged.insert(merged.end(), winners.begin(), winners.end());
+                        }
+                        std::partial_sort(
+                            merged.begin(), merged.begin() + k, merged.end(), compare);
+                        merged.resize(k);
+                        write_slice(slice, merged);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -1029,7 +1029,9 @@ size_t MKLDNNEmitter::build_rnn_forward(const mkldnn::memory::desc& src_layer_de
                                         const mkldnn::memory::desc& weights_iter_desc,
                                         const mkldnn::memory::desc& bias_desc,
                                         const mkldnn::memory::desc& dst_layer_desc,
-                                        const mkldnn::memory::desc& dst_iter_desc)
+                                        const mkldnn::memory::desc& dst_iter_desc,
+                                        const mkldnn::algorithm rnn_cell_kind,
+                                        const mkldnn::rnn_direction rnn_direction)
 {
     size_t src_layer_index = build_memory_primitive(src_layer_desc);
     size_t src_iter_index = build_memory_primitive(src_iter_desc);
@@ -1039,10 +1041,11 @@ size_t MKLDNNEmitter::build_rnn_forward(const mkldnn::memory::desc& src_layer_de
     size_t dst_layer_index = build_memory_primitive(dst_layer_desc);
     size_t dst_iter_index = build_memory_primitive(dst_iter_desc);
 
-    mkldnn::rnn_cell::desc rnn_cell(mkldnn::algorithm::vanilla_lstm);
+    // Vanilla RNN cells need an activation, it is ignored for LSTM and GRU cells
+    mkldnn::rnn_cell::desc rnn_cell(rnn_cell_kind, mkldnn::algorithm::eltwise_tanh);
     mkldnn::rnn_forward::desc rnn_layer_desc(mkldnn::prop_kind::forward_training,
                                              rnn_cell,
-                                             mkldnn::rnn_direction::unidirectional_left2right,
+                                             rnn_direction,
                                              src_layer_desc,
                                              src_iter_desc,
                                              weights_layer_desc,
@@ -32,6 +32,7 @@
 #include "ngraph/op/experimental/quantized_conv_relu.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
@@ -483,7 +484,13 @@ namespace ngraph
                     auto rnn_cell_n_states =
                         static_cast<unsigned long>(rnn_node->get_num_cell_states());
 
-                    if (out[0].get_shape().size() == 2 && (out[0].get_shape()[1] != feature_size))
+                    auto rnn_cell_kind = mkldnn_utils::get_rnn_cell_kind(rnn_cell_n_gates);
+                    auto rnn_direction = direction == 2
+                                             ? mkldnn::rnn_direction::bidirectional_concat
+                                             : mkldnn::rnn_direction::unidirectional_left2right;
+
+                    if (out[0].get_shape().size() == 2 &&
+                        (out[0].get_shape()[1] != direction * feature_size))
                     {
                         throw ngraph_error(
                             "input slc{ht} feature size is not equal to output dlc{ht} feature "
@@ -514,7 +521,7 @@ namespace ngraph
                     Shape wei_iter_tz{
                         num_fused_layers, direction, feature_size, rnn_cell_n_gates, feature_size};
                     Shape bias_tz{num_fused_layers, direction, rnn_cell_n_gates, feature_size};
-                    Shape dst_layer_tz{src_sequence_length_max, batch, feature_size};
+                    Shape dst_layer_tz{src_sequence_length_max, batch, direction * feature_size};
                     Shape dst_iter_tz{
                         num_fused_layers, direction, rnn_cell_n_states, batch, feature_size};
 
@@ -540,7 +547,9 @@ namespace ngraph
                                              wei_iter_md,
                                              bias_md,
                                              dst_layer_md,
-                                             dst_iter_md);
+                                             dst_iter_md,
+                                             rnn_cell_kind,
+                                             rnn_direction);
                 }
 
                 size_t build_rnn_forward(const mkldnn::memory::desc& src_layer_desc,
@@ -549,7 +558,9 @@ namespace ngraph
                                          const mkldnn::memory::desc& weights_iter_desc,
                                          const mkldnn::memory::desc& bias_desc,
                                          const mkldnn::memory::desc& dst_layer_desc,
-                                         const mkldnn::memory::desc& dst_iter_desc);
+                                         const mkldnn::memory::desc& dst_iter_desc,
+                                         const mkldnn::algorithm rnn_cell_kind,
+                                         const mkldnn::rnn_direction rnn_direction);
 
                 size_t build_concat(const std::vector<mkldnn::memory::desc>& inputs_data_desc,
                                     const mkldnn::memory::desc& result_desc,
@@ -822,6 +833,67 @@ namespace ngraph
                     m_mkldnn_primitives[conv_idx] = prim;
                 }
 
+                /// \brief Returns the pool of forward convolutions for `node`, shared with every
+                ///        function that has a convolution of the same descriptor. Primitives are
+                ///        only created when the pool first runs.
+                template <typename OP>
+                std::shared_ptr<MKLDNNPrimitivePool>
+                    build_convolution_pool(const ngraph::Node* node,
+                                           const std::vector<TensorViewWrapper>& args,
+                                           const std::vector<TensorViewWrapper>& out)
+                {
+                    auto desc = get_convolution_forward_desc<OP>(node, args, out);
+                    auto attr = get_convolution_forward_attr<OP>(node);
+                    bool with_bias = has_bias<OP>();
+
+                    auto factory = [desc, attr, with_bias]() {
+                        const mkldnn::engine& engine = executor::global_cpu_engine;
+                        std::unique_ptr<MKLDNNPrimitivePool::Instance> instance(
+                            new MKLDNNPrimitivePool::Instance);
+                        auto& memories = instance->memories;
+                        try
+                        {
+                            memories.emplace_back(
+                                new mkldnn::memory({{desc.data.src_desc}, engine}, nullptr));
+                            memories.emplace_back(
+                                new mkldnn::memory({{desc.data.weights_desc}, engine}, nullptr));
+                            if (with_bias)
+                            {
+                                memories.emplace_back(
+                                    new mkldnn::memory({{desc.data.bias_desc}, engine}, nullptr));
+                            }
+                            memories.emplace_back(
+                                new mkldnn::memory({{desc.data.dst_desc}, engine}, nullptr));
+
+                            if (with_bias)
+                            {
+                                instance->primitive.reset(
+                                    new mkldnn::convolution_forward({desc, attr, engine},
+                                                                    *memories[0],
+                                                                    *memories[1],
+                                                                    *memories[2],
+                                                                    *memories[3]));
+                            }
+                            else
+                            {
+                                instance->primitive.reset(
+                                    new mkldnn::convolution_forward({desc, attr, engine},
+                                                                    *memories[0],
+                                                                    *memories[1],
+                                                                    *memories[2]));
+                            }
+                        }
+                        catch (const mkldnn::error& e)
+                        {
+                            throw ngraph_error("Could not create mkldnn convolution " + e.message);
+                        }
+                        return instance;
+                    };
+
+                    return MKLDNNPrimitiveCache::get().get_pool(
+                        MKLDNNPrimitiveCache::convolution_forward_key(desc, attr), factory);
+                }
+
             private:
                 std::vector<mkldnn::primitive*> m_mkldnn_primitives;
                 std::vector<mkldnn::stream> m_mkldnn_streams;
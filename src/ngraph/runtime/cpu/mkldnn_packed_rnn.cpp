@@ -0,0 +1,336 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <numeric>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/mkldnn_packed_rnn.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::cpu::MKLDNNPackedRnn::MKLDNNPackedRnn(const ngraph::op::Rnn* rnn)
+    : m_num_timesteps(rnn->get_num_timesteps())
+    , m_batch_size(rnn->get_batch_size())
+    , m_src_layer_feature_size(rnn->get_src_layer_feature_size())
+    , m_feature_size(rnn->get_src_iter_feature_size())
+    , m_num_gates_per_cell(rnn->get_gates_per_cell())
+    , m_num_cell_states(rnn->get_num_cell_states())
+    , m_direction(rnn->get_direction())
+    , m_num_fused_layers(rnn->get_num_fused_layers())
+    , m_rnn_cell_kind(mkldnn_utils::get_rnn_cell_kind(rnn->get_gates_per_cell()))
+    , m_lengths(m_batch_size)
+    , m_order(m_batch_size)
+{
+    // The weights of each direction are only contiguous with a single layer
+    if (m_direction == 2 && m_num_fused_layers != 1)
+    {
+        throw ngraph_error("Bidirectional Rnn with sequence lengths must have a single layer");
+    }
+
+    size_t state_size = m_num_fused_layers * m_num_cell_states * m_batch_size * m_feature_size;
+    m_states.resize(state_size);
+    m_packed_src_layer.resize(m_num_timesteps * m_batch_size * m_src_layer_feature_size);
+    m_packed_src_iter.resize(state_size);
+    m_packed_dst_layer.resize(m_num_timesteps * m_batch_size * m_feature_size);
+    m_packed_dst_iter.resize(state_size);
+}
+
+runtime::cpu::MKLDNNPackedRnn::Primitive& runtime::cpu::MKLDNNPackedRnn::get_primitive(
+    size_t timesteps, size_t batch, mkldnn::rnn_direction direction)
+{
+    auto key = make_tuple(timesteps, batch, direction);
+    auto it = m_primitives.find(key);
+    if (it != m_primitives.end())
+    {
+        return *it->second;
+    }
+
+    size_t num_directions = direction == mkldnn::rnn_direction::bidirectional_concat ? 2 : 1;
+    size_t layers = m_num_fused_layers;
+    size_t gates = m_num_gates_per_cell;
+    size_t states = m_num_cell_states;
+    size_t slc = m_src_layer_feature_size;
+    size_t sic = m_feature_size;
+    auto md = [](const Shape& shape, mkldnn::memory::format format) {
+        return mkldnn::memory::desc(mkldnn::memory::dims(shape.begin(), shape.end()),
+                                    mkldnn::memory::data_type::f32,
+                                    format);
+    };
+    auto src_layer_md = md(Shape{timesteps, batch, slc}, mkldnn::memory::format::tnc);
+    auto src_iter_md =
+        md(Shape{layers, num_directions, states, batch, sic}, mkldnn::memory::format::ldsnc);
+    auto weights_layer_md =
+        md(Shape{layers, num_directions, slc, gates, sic}, mkldnn::memory::format::ldigo);
+    auto weights_iter_md =
+        md(Shape{layers, num_directions, sic, gates, sic}, mkldnn::memory::format::ldigo);
+    auto bias_md = md(Shape{layers, num_directions, gates, sic}, mkldnn::memory::format::ldgo);
+    auto dst_layer_md =
+        md(Shape{timesteps, batch, num_directions * sic}, mkldnn::memory::format::tnc);
+    auto dst_iter_md =
+        md(Shape{layers, num_directions, states, batch, sic}, mkldnn::memory::format::ldsnc);
+
+    auto memory = [](const mkldnn::memory::desc& desc) {
+        return unique_ptr<mkldnn::memory>(
+            new mkldnn::memory({desc, executor::global_cpu_engine}, nullptr));
+    };
+    unique_ptr<Primitive> primitive(new Primitive);
+    primitive->src_layer = memory(src_layer_md);
+    primitive->src_iter = memory(src_iter_md);
+    primitive->weights_layer = memory(weights_layer_md);
+    primitive->weights_iter = memory(weights_iter_md);
+    primitive->bias = memory(bias_md);
+    primitive->dst_layer = memory(dst_layer_md);
+    primitive->dst_iter = memory(dst_iter_md);
+
+    // Vanilla RNN cells need an activation, it is ignored for LSTM and GRU cells
+    mkldnn::rnn_cell::desc rnn_cell(m_rnn_cell_kind, mkldnn::algorithm::eltwise_tanh);
+    mkldnn::rnn_forward::desc rnn_desc(mkldnn::prop_kind::forward_training,
+                                       rnn_cell,
+                                       direction,
+                                       src_layer_md,
+                                       src_iter_md,
+                                       weights_layer_md,
+                                       weights_iter_md,
+                                       bias_md,
+                                       dst_layer_md,
+                                       dst_iter_md);
+    mkldnn::rnn_forward::primitive_desc rnn_pd(rnn_desc, executor::global_cpu_engine);
+    primitive->workspace_buffer.resize(rnn_pd.workspace_primitive_desc().get_size());
+    primitive->workspace.reset(new mkldnn::memory(rnn_pd.workspace_primitive_desc(),
+                                                  primitive->workspace_buffer.data()));
+    primitive->rnn.reset(new mkldnn::rnn_forward(rnn_pd,
+                                                 mkldnn::primitive::at(*primitive->src_layer),
+                                                 mkldnn::primitive::at(*primitive->src_iter),
+                                                 mkldnn::primitive::at(*primitive->weights_layer),
+                                                 mkldnn::primitive::at(*primitive->weights_iter),
+                                                 mkldnn::primitive::at(*primitive->bias),
+                                                 *primitive->dst_layer,
+                                                 *primitive->dst_iter,
+                                                 *primitive->workspace));
+
+    auto& result = *primitive;
+    m_primitives[key] = move(primitive);
+    return result;
+}
+
+void runtime::cpu::MKLDNNPackedRnn::run(Primitive& primitive,
+                                         const float* src_layer,
+                                         const float* src_iter,
+                                         const float* weights_layer,
+                                         const float* weights_iter,
+                                         const float* bias,
+                                         float* dst_layer,
+                                         float* dst_iter)
+{
+    primitive.src_layer->set_data_handle(const_cast<float*>(src_layer));
+    primitive.src_iter->set_data_handle(const_cast<float*>(src_iter));
+    primitive.weights_layer->set_data_handle(const_cast<float*>(weights_layer));
+    primitive.weights_iter->set_data_handle(const_cast<float*>(weights_iter));
+    primitive.bias->set_data_handle(const_cast<float*>(bias));
+    primitive.dst_layer->set_data_handle(dst_layer);
+    primitive.dst_iter->set_data_handle(dst_iter);
+
+    mkldnn::stream s(mkldnn::stream::kind::eager);
+    try
+    {
+        s.submit({*primitive.rnn}).wait();
+    }
+    catch (const mkldnn::error& e)
+    {
+        throw ngraph_error("Could not run mkdnn primitive " + e.message);
+    }
+}
+
+void runtime::cpu::MKLDNNPackedRnn::execute(const float* src_layer,
+                                             const float* src_iter,
+                                             const float* weights_layer,
+                                             const float* weights_iter,
+                                             const float* bias,
+                                             const int32_t* sequence_lengths,
+                                             float* dst_layer,
+                                             float* dst_iter)
+{
+    for (size_t n = 0; n < m_batch_size; n++)
+    {
+        if (sequence_lengths[n] < 0 || static_cast<size_t>(sequence_lengths[n]) > m_num_timesteps)
+        {
+            throw ngraph_error("Rnn sequence length is out of range");
+        }
+        m_lengths[n] = sequence_lengths[n];
+    }
+    iota(m_order.begin(), m_order.end(), 0);
+    stable_sort(m_order.begin(), m_order.end(), [this](size_t a, size_t b) {
+        return m_lengths[a] > m_lengths[b];
+    });
+
+    if (m_lengths[m_order.back()] == m_num_timesteps)
+    {
+        // No sequence ends early, so the whole batch runs in place
+        auto direction = m_direction == 2 ? mkldnn::rnn_direction::bidirectional_concat
+                                          : mkldnn::rnn_direction::unidirectional_left2right;
+        run(get_primitive(m_num_timesteps, m_batch_size, direction),
+            src_layer,
+            src_iter,
+            weights_layer,
+            weights_iter,
+            bias,
+            dst_layer,
+            dst_iter);
+        return;
+    }
+
+    // Over [begin, end) the first `batch` sorted sequences have not ended
+    m_segments.clear();
+    for (size_t batch = m_batch_size; batch > 0; batch--)
+    {
+        size_t begin = batch == m_batch_size ? 0 : m_lengths[m_order[batch]];
+        size_t end = m_lengths[m_order[batch - 1]];
+        if (end > begin)
+        {
+            m_segments.push_back({begin, end, batch});
+        }
+    }
+
+    // Steps past the end of a sequence produce zeros
+    size_t dst_layer_feature_size = m_direction * m_feature_size;
+    for (size_t n = 0; n < m_batch_size; n++)
+    {
+        for (size_t t = m_lengths[n]; t < m_num_timesteps; t++)
+        {
+            fill_n(dst_layer + (t * m_batch_size + n) * dst_layer_feature_size,
+                   dst_layer_feature_size,
+                   0.0f);
+        }
+    }
+
+    for (size_t direction = 0; direction < m_direction; direction++)
+    {
+        run_direction(
+            direction, src_layer, src_iter, weights_layer, weights_iter, bias, dst_layer, dst_iter);
+    }
+}
+
+void runtime::cpu::MKLDNNPackedRnn::run_direction(size_t direction,
+                                                   const float* src_layer,
+                                                   const float* src_iter,
+                                                   const float* weights_layer,
+                                                   const float* weights_iter,
+                                                   const float* bias,
+                                                   float* dst_layer,
+                                                   float* dst_iter)
+{
+    const size_t batch_size = m_batch_size;
+    const size_t slc = m_src_layer_feature_size;
+    const size_t sic = m_feature_size;
+    const size_t gates = m_num_gates_per_cell;
+    const size_t state_rows = m_num_fused_layers * m_num_cell_states;
+    const size_t dst_layer_feature_size = m_direction * sic;
+
+    // Both directions share the input, the right to left direction walks the segments
+    // backwards. A sequence joins it with its initial state at the segment where it ends,
+    // and the rows of the sequences that have not joined yet still hold their initial states.
+    const float* direction_weights_layer = weights_layer + direction * slc * gates * sic;
+    const float* direction_weights_iter = weights_iter + direction * sic * gates * sic;
+    const float* direction_bias = bias + direction * gates * sic;
+    bool right_to_left = direction == 1;
+    auto rnn_direction = right_to_left ? mkldnn::rnn_direction::unidirectional_right2left
+                                       : mkldnn::rnn_direction::unidirectional_left2right;
+
+    // Offset of row `n` of state `row` (layer * states + state) in src_iter and dst_iter
+    auto state_offset = [&](size_t row, size_t n) {
+        size_t layer = row / m_num_cell_states;
+        size_t state = row % m_num_cell_states;
+        return (((layer * m_direction + direction) * m_num_cell_states + state) * batch_size +
+                n) *
+               sic;
+    };
+
+    for (size_t row = 0; row < state_rows; row++)
+    {
+        for (size_t i = 0; i < batch_size; i++)
+        {
+            copy_n(src_iter + state_offset(row, m_order[i]),
+                   sic,
+                   m_states.data() + (row * batch_size + i) * sic);
+        }
+    }
+
+    for (size_t s = 0; s < m_segments.size(); s++)
+    {
+        const Segment& segment =
+            right_to_left ? m_segments[m_segments.size() - 1 - s] : m_segments[s];
+        size_t timesteps = segment.end - segment.begin;
+        size_t batch = segment.batch;
+
+        for (size_t t = 0; t < timesteps; t++)
+        {
+            for (size_t i = 0; i < batch; i++)
+            {
+                copy_n(src_layer + ((segment.begin + t) * batch_size + m_order[i]) * slc,
+                       slc,
+                       m_packed_src_layer.data() + (t * batch + i) * slc);
+            }
+        }
+        for (size_t row = 0; row < state_rows; row++)
+        {
+            copy_n(m_states.data() + row * batch_size * sic,
+                   batch * sic,
+                   m_packed_src_iter.data() + row * batch * sic);
+        }
+
+        run(get_primitive(timesteps, batch, rnn_direction),
+            m_packed_src_layer.data(),
+            m_packed_src_iter.data(),
+            direction_weights_layer,
+            direction_weights_iter,
+            direction_bias,
+            m_packed_dst_layer.data(),
+            m_packed_dst_iter.data());
+
+        for (size_t t = 0; t < timesteps; t++)
+        {
+            for (size_t i = 0; i < batch; i++)
+            {
+                copy_n(m_packed_dst_layer.data() + (t * batch + i) * sic,
+                       sic,
+                       dst_layer +
+                           ((segment.begin + t) * batch_size + m_order[i]) *
+                               dst_layer_feature_size +
+                           direction * sic);
+            }
+        }
+        for (size_t row = 0; row < state_rows; row++)
+        {
+            copy_n(m_packed_dst_iter.data() + row * batch * sic,
+                   batch * sic,
+                   m_states.data() + row * batch_size * sic);
+        }
+    }
+
+    for (size_t row = 0; row < state_rows; row++)
+    {
+        for (size_t i = 0; i < batch_size; i++)
+        {
+            copy_n(m_states.data() + (row * batch_size + i) * sic,
+                   sic,
+                   dst_iter + state_offset(row, m_order[i]));
+        }
+    }
+}
@@ -0,0 +1,125 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include <mkldnn.hpp>
+
+#include "ngraph/runtime/cpu/op/rnn.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Runs an Rnn with sequence lengths over a batch of variable length sequences.
+            ///
+            ///        Sequences are sorted by decreasing length, so the sequences that have not
+            ///        ended at any timestep are a prefix of the sorted batch. The timesteps are
+            ///        split into segments over which that prefix does not change, and each
+            ///        segment is packed and run as an MKLDNN RNN over just those sequences. No
+            ///        step past the end of a sequence is computed. Primitives are created the
+            ///        first time a segment shape is seen and reused afterwards.
+            class MKLDNNPackedRnn
+            {
+            public:
+                MKLDNNPackedRnn(const ngraph::op::Rnn* rnn);
+
+                void execute(const float* src_layer,
+                             const float* src_iter,
+                             const float* weights_layer,
+                             const float* weights_iter,
+                             const float* bias,
+                             const int32_t* sequence_lengths,
+                             float* dst_layer,
+                             float* dst_iter);
+
+            private:
+                struct Primitive
+                {
+                    std::unique_ptr<mkldnn::memory> src_layer;
+                    std::unique_ptr<mkldnn::memory> src_iter;
+                    std::unique_ptr<mkldnn::memory> weights_layer;
+                    std::unique_ptr<mkldnn::memory> weights_iter;
+                    std::unique_ptr<mkldnn::memory> bias;
+                    std::unique_ptr<mkldnn::memory> dst_layer;
+                    std::unique_ptr<mkldnn::memory> dst_iter;
+                    std::unique_ptr<mkldnn::memory> workspace;
+                    std::vector<char> workspace_buffer;
+                    std::unique_ptr<mkldnn::rnn_forward> rnn;
+                };
+
+                struct Segment
+                {
+                    size_t begin;
+                    size_t end;
+                    size_t batch;
+                };
+
+                Primitive& get_primitive(size_t timesteps,
+                                         size_t batch,
+                                         mkldnn::rnn_direction direction);
+                void run(Primitive& primitive,
+                         const float* src_layer,
+                         const float* src_iter,
+                         const float* weights_layer,
+                         const float* weights_iter,
+                         const float* bias,
+                         float* dst_layer,
+                         float* dst_iter);
+                void run_direction(size_t direction,
+                                   const float* src_layer,
+                                   const float* src_iter,
+                                   const float* weights_layer,
+                                   const float* weights_iter,
+                                   const float* bias,
+                                   float* dst_layer,
+                                   float* dst_iter);
+
+                size_t m_num_timesteps;
+                size_t m_batch_size;
+                size_t m_src_layer_feature_size;
+                size_t m_feature_size;
+                size_t m_num_gates_per_cell;
+                size_t m_num_cell_states;
+                size_t m_direction;
+                size_t m_num_fused_layers;
+                mkldnn::algorithm m_rnn_cell_kind;
+
+                std::map<std::tuple<size_t, size_t, mkldnn::rnn_direction>,
+                         std::unique_ptr<Primitive>>
+                    m_primitives;
+
+                std::vector<size_t> m_lengths;
+                std::vector<size_t> m_order;
+                std::vector<Segment> m_segments;
+                // Recurrent states of the sorted sequences, {layer, state, sequence, feature}
+                std::vector<float> m_states;
+                std::vector<float> m_packed_src_layer;
+                std::vector<float> m_packed_src_iter;
+                std::vector<float> m_packed_dst_layer;
+                std::vector<float> m_packed_dst_iter;
+            };
+        }
+    }
+}
@@ -0,0 +1,162 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
+#include "ngraph/except.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::cpu::MKLDNNPrimitivePool::MKLDNNPrimitivePool(Factory factory)
+    : m_factory(move(factory))
+{
+}
+
+void runtime::cpu::MKLDNNPrimitivePool::execute(initializer_list<void*> buffers)
+{
+    Instance* instance = nullptr;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        if (!m_idle.empty())
+        {
+            instance = m_idle.back();
+            m_idle.pop_back();
+        }
+    }
+    if (instance == nullptr)
+    {
+        // Creating the primitive generates its kernel, so don't hold up the other callers
+        unique_ptr<Instance> created = m_factory();
+        lock_guard<mutex> lock(m_mutex);
+        m_instances.push_back(move(created));
+        instance = m_instances.back().get();
+    }
+
+    size_t index = 0;
+    for (void* buffer : buffers)
+    {
+        instance->memories.at(index++)->set_data_handle(buffer);
+    }
+
+    string error;
+    try
+    {
+        mkldnn::stream s(mkldnn::stream::kind::eager);
+        s.submit({*instance->primitive}).wait();
+    }
+    catch (const mkldnn::error& e)
+    {
+        error = e.message;
+    }
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_idle.push_back(instance);
+    }
+    if (!error.empty())
+    {
+        throw ngraph_error("Could not run mkdnn primitive " + error);
+    }
+}
+
+size_t runtime::cpu::MKLDNNPrimitivePool::get_instance_count() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_instances.size();
+}
+
+runtime::cpu::MKLDNNPrimitiveCache& runtime::cpu::MKLDNNPrimitiveCache::get()
+{
+    static MKLDNNPrimitiveCache cache;
+    return cache;
+}
+
+shared_ptr<runtime::cpu::MKLDNNPrimitivePool>
+    runtime::cpu::MKLDNNPrimitiveCache::get_pool(const string& key,
+                                                 MKLDNNPrimitivePool::Factory factory)
+{
+    lock_guard<mutex> lock(m_mutex);
+    weak_ptr<MKLDNNPrimitivePool>& entry = m_pools[key];
+    shared_ptr<MKLDNNPrimitivePool> pool = entry.lock();
+    if (pool)
+    {
+        m_hits++;
+        return pool;
+    }
+    pool = make_shared<MKLDNNPrimitivePool>(move(factory));
+    entry = pool;
+    return pool;
+}
+
+size_t runtime::cpu::MKLDNNPrimitiveCache::get_pool_count()
+{
+    lock_guard<mutex> lock(m_mutex);
+    for (auto it = m_pools.begin(); it != m_pools.end();)
+    {
+        it = it->second.expired() ? m_pools.erase(it) : next(it);
+    }
+    return m_pools.size();
+}
+
+size_t runtime::cpu::MKLDNNPrimitiveCache::get_hit_count()
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_hits;
+}
+
+template <typename T>
+static void append_bytes(string& key, const T& value)
+{
+    key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+string runtime::cpu::MKLDNNPrimitiveCache::convolution_forward_key(
+    const mkldnn::convolution_forward::desc& desc, const mkldnn::primitive_attr& attr)
+{
+    string key = "convolution_forward";
+    append_bytes(key, desc.data);
+
+    const mkldnn::post_ops ops = attr.get_post_ops();
+    for (int i = 0; i < ops.len(); i++)
+    {
+        mkldnn::primitive::kind kind = ops.kind(i);
+        append_bytes(key, kind);
+        if (kind == mkldnn::primitive::kind::sum)
+        {
+            float scale;
+            ops.get_params_sum(i, scale);
+            append_bytes(key, scale);
+        }
+        else if (kind == mkldnn::primitive::kind::eltwise)
+        {
+            float scale, alpha, beta;
+            mkldnn::algorithm algorithm;
+            ops.get_params_eltwise(i, scale, algorithm, alpha, beta);
+            append_bytes(key, scale);
+            append_bytes(key, algorithm);
+            append_bytes(key, alpha);
+            append_bytes(key, beta);
+        }
+    }
+
+    int mask;
+    vector<float> scales;
+    attr.get_output_scales(mask, scales);
+    append_bytes(key, mask);
+    key.append(reinterpret_cast<const char*>(scales.data()), scales.size() * sizeof(float));
+    append_bytes(key, attr.get_int_output_round_mode());
+    return key;
+}
@@ -0,0 +1,98 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <mkldnn.hpp>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Identical MKLDNN primitives, created on first use and shared by every
+            ///        Function with an op of the same descriptor.
+            ///
+            ///        A primitive is bound to the memory primitives it reads and writes, so one
+            ///        instance can only run one call at a time. Calls take an idle instance and
+            ///        a new one is created when all are busy, so the pool grows to the number of
+            ///        concurrent callers rather than the number of Functions.
+            class MKLDNNPrimitivePool
+            {
+            public:
+                struct Instance
+                {
+                    // In the order of the buffers passed to execute()
+                    std::vector<std::unique_ptr<mkldnn::memory>> memories;
+                    std::unique_ptr<mkldnn::primitive> primitive;
+                };
+                using Factory = std::function<std::unique_ptr<Instance>()>;
+
+                MKLDNNPrimitivePool(Factory factory);
+
+                /// \brief Points the memory primitives of an idle instance at `buffers` and
+                ///        runs it
+                void execute(std::initializer_list<void*> buffers);
+
+                /// \brief Number of instances created so far
+                size_t get_instance_count() const;
+
+            private:
+                Factory m_factory;
+                mutable std::mutex m_mutex;
+                std::vector<std::unique_ptr<Instance>> m_instances;
+                std::vector<Instance*> m_idle;
+            };
+
+            /// \brief Process-wide index of primitive pools by descriptor. Pools are held weakly
+            ///        and released with the last function using them.
+            class MKLDNNPrimitiveCache
+            {
+            public:
+                static MKLDNNPrimitiveCache& get();
+
+                /// \brief Returns the live pool for `key`, or a new pool creating instances with
+                ///        `factory`
+                std::shared_ptr<MKLDNNPrimitivePool> get_pool(const std::string& key,
+                                                              MKLDNNPrimitivePool::Factory factory);
+
+                /// \brief Number of pools still used by some function
+                size_t get_pool_count();
+                /// \brief Number of get_pool() calls answered with an existing pool
+                size_t get_hit_count();
+
+                /// \brief Key of a forward convolution with the given descriptor and attributes
+                static std::string convolution_forward_key(
+                    const mkldnn::convolution_forward::desc& desc,
+                    const mkldnn::primitive_attr& attr);
+
+            private:
+                std::mutex m_mutex;
+                std::unordered_map<std::string, std::weak_ptr<MKLDNNPrimitivePool>> m_pools;
+                size_t m_hits = 0;
+            };
+        }
+    }
+}
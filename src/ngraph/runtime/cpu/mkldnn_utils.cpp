@@ -239,6 +239,18 @@ mkldnn::memory::data_type
     return it->second;
 }
 
+mkldnn::algorithm runtime::cpu::mkldnn_utils::get_rnn_cell_kind(size_t num_gates_per_cell)
+{
+    // The cell type is implied by the number of gates per cell
+    switch (num_gates_per_cell)
+    {
+    case 4: return mkldnn::algorithm::vanilla_lstm;
+    case 3: return mkldnn::algorithm::vanilla_gru;
+    case 1: return mkldnn::algorithm::vanilla_rnn;
+    default: throw ngraph_error("Unsupported number of gates per RNN cell");
+    }
+}
+
 const std::string& runtime::cpu::mkldnn_utils::get_mkldnn_format_string(memory::format fmt)
 {
     auto it = get_mkldnn_format_string_map().find(fmt);
@@ -23,6 +23,21 @@ using namespace ngraph;
 
 shared_ptr<Node> op::Rnn::copy_with_new_args(const NodeVector& new_args) const
 {
+    if (new_args.size() == 6)
+    {
+        return make_shared<Rnn>(new_args[0],
+                                new_args[1],
+                                new_args[2],
+                                new_args[3],
+                                new_args[4],
+                                new_args[5],
+                                m_num_timesteps,
+                                m_num_gates_per_cell,
+                                m_src_sequence_length,
+                                m_num_cell_states,
+                                m_direction,
+                                m_num_fused_layers);
+    }
     if (new_args.size() != 5)
     {
         throw ngraph_error("Incorrect number of new arguments");
@@ -60,6 +75,48 @@ op::Rnn::Rnn(std::shared_ptr<Node> src_layer,
     , m_num_fused_layers(num_fused_layers)
 {
     constructor_validate_and_infer_types();
+    validate_and_set_outputs();
+}
+
+op::Rnn::Rnn(std::shared_ptr<Node> src_layer,
+             std::shared_ptr<Node> src_iter,
+             std::shared_ptr<Node> weights_layer,
+             std::shared_ptr<Node> weights_iter,
+             std::shared_ptr<Node> bias,
+             std::shared_ptr<Node> sequence_lengths,
+             size_t num_timesteps,
+             size_t num_gates_per_cell,
+             size_t src_sequence_length,
+             size_t num_cell_states,
+             size_t direction,
+             size_t num_fused_layers)
+    : Op("Rnn",
+         check_single_output_args(
+             {src_layer, src_iter, weights_layer, weights_iter, bias, sequence_lengths}))
+    , m_num_timesteps(num_timesteps)
+    , m_num_gates_per_cell(num_gates_per_cell)
+    , m_src_sequence_length(src_sequence_length)
+    , m_num_cell_states(num_cell_states)
+    , m_direction(direction)
+    , m_num_fused_layers(num_fused_layers)
+{
+    constructor_validate_and_infer_types();
+    validate_and_set_outputs();
+}
+
+void op::Rnn::validate_and_set_outputs()
+{
+    auto src_layer = get_argument(0);
+    auto src_iter = get_argument(1);
+    auto weights_layer = get_argument(2);
+    auto weights_iter = get_argument(3);
+    auto bias = get_argument(4);
+
+    if (m_direction != 1 && m_direction != 2)
+    {
+        throw ngraph_error("Rnn direction must be 1 (left to right) or 2 (bidirectional)");
+    }
+
     if (src_layer->get_shape().size() != weights_layer->get_shape().size())
     {
         throw ngraph_error("src_layer and i2h weights size dont match");
@@ -90,25 +147,37 @@ op::Rnn::Rnn(std::shared_ptr<Node> src_layer,
         throw ngraph_error("src_layer size is not equal t*n*c");
     }
 
-    if ((bias->get_shape()[0] / m_num_fused_layers) != (weights_layer->get_shape()[1]) ||
-        (bias->get_shape()[0] / m_num_fused_layers) != (weights_iter->get_shape()[1]))
+    if ((bias->get_shape()[0] / (m_direction * m_num_fused_layers)) !=
+            (weights_layer->get_shape()[1]) ||
+        (bias->get_shape()[0] / (m_direction * m_num_fused_layers)) !=
+            (weights_iter->get_shape()[1]))
     {
         throw ngraph_error("bias and weights_shape are not compatible");
     }
 
     auto et = src_layer->get_element_type();
-    for (auto& rnn_input : get_arguments())
+    for (size_t i = 0; i < 5; i++)
     {
-        if (rnn_input->get_element_type() != et)
+        if (get_argument(i)->get_element_type() != et)
         {
             throw ngraph_error("all rnn inputs must have the same element type");
         }
     }
 
+    if (has_sequence_lengths())
+    {
+        auto sequence_lengths = get_argument(5);
+        if (sequence_lengths->get_element_type() != element::i32 ||
+            sequence_lengths->get_shape() != Shape{m_batch_size})
+        {
+            throw ngraph_error("sequence lengths must be an i32 tensor of Shape{batch_size}");
+        }
+    }
+
     set_output_size(2);
     set_output_type(0,
                     src_layer->get_element_type(),
-                    Shape{(m_direction * m_num_timesteps * m_batch_size), m_src_iter_feature_size});
+                    Shape{(m_num_timesteps * m_batch_size), m_direction * m_src_iter_feature_size});
     set_output_type(1,
                     src_layer->get_element_type(),
                     Shape{(m_num_cell_states * m_direction * m_num_fused_layers * m_batch_size),
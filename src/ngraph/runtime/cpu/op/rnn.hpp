@@ -32,15 +32,22 @@ namespace ngraph
         // [2] - initializer for the input weights matrix, used for the linear transformation of the inputs.
         // [3] - initializer for the recurrent weights matrix, used for the linear transformation of the recurrent state.
         // [4] - Initializer for the bias vector w.r.to inputs + hidden state (ibh_bias + hbh_bias)
+        // [5] - optional i32 tensor of Shape{batch_size} with the length of each sequence, steps
+        //       past the end of a sequence are not computed
         // number_of_timesteps - number of unrolled cells up to timestep t.
         // num_gates_per_cell - number of gates per RNN cell, LSTM = 4, GRU = 3, vanilla RNN = 1
         // src_sequence_length - this will be same as number_of_timesteps
         // src_layer_feature_size - feature size w.r.to input tensor
         // src_iter_feature_size - feature size w.r.to hidden state
         // num_cell_states - number of recurrent state tensor states , LSTM = 2, GRU = 1, vanilla RNN = 1
+        // direction - 1 for left to right, 2 for bidirectional. The right to left direction reads
+        //             the input sequence in reverse, its weights, bias and states follow those of
+        //             the left to right direction.
 
         // OUTPUT VALUE: A tuple with the following structure:
-        //   [0] - ht, output tensor with shape (sequence_length*batch_size, feature_size) .
+        //   [0] - ht, output tensor with shape (sequence_length*batch_size, direction*feature_size),
+        //         the outputs of both directions for a timestep are concatenated. With sequence
+        //         lengths, the steps past the end of a sequence are zero.
         //   [1] - {ht | ct} output recurrent state tensor with the same shape as states i.e (sequence_length*batch_size, feature_size)
 
         class Rnn : public Op
@@ -57,6 +64,18 @@ namespace ngraph
                 size_t num_cell_states,
                 size_t direction,
                 size_t num_fused_layers);
+            Rnn(std::shared_ptr<Node> src_layer,
+                std::shared_ptr<Node> src_iter,
+                std::shared_ptr<Node> weights_layer,
+                std::shared_ptr<Node> weights_iter,
+                std::shared_ptr<Node> bias,
+                std::shared_ptr<Node> sequence_lengths,
+                size_t num_timesteps,
+                size_t num_gates_per_cell,
+                size_t src_sequence_length,
+                size_t num_cell_states,
+                size_t direction,
+                size_t num_fused_layers);
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
             size_t get_num_timesteps() const { return m_num_timesteps; }
@@ -70,7 +89,10 @@ namespace ngraph
             size_t get_num_cell_states() const { return m_num_cell_states; }
             size_t get_direction() const { return m_direction; }
             size_t get_num_fused_layers() const { return m_num_fused_layers; }
+            bool has_sequence_lengths() const { return get_input_size() == 6; }
         private:
+            void validate_and_set_outputs();
+
             size_t m_num_timesteps;
             size_t m_num_gates_per_cell;
             size_t m_src_sequence_length;
@@ -0,0 +1,177 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/pass/cpu_bf16_fallback.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/sum.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+set<string> runtime::cpu::pass::CPUBF16Fallback::get_bf16_compute_ops()
+{
+    return {"Add",
+            "Convolution",
+            "ConvolutionBackpropData",
+            "ConvolutionBackpropFilters",
+            "Divide",
+            "Dot",
+            "Maximum",
+            "Minimum",
+            "Multiply",
+            "Negative",
+            "Relu",
+            "Sqrt",
+            "Subtract",
+            "Sum"};
+}
+
+set<string> runtime::cpu::pass::CPUBF16Fallback::get_bf16_movement_ops()
+{
+    return {"Broadcast", "Concat", "Reshape", "Slice"};
+}
+
+static bool uses_bf16(const Node& node)
+{
+    for (size_t i = 0; i < node.get_input_size(); i++)
+    {
+        if (node.get_input_element_type(i) == element::bf16)
+        {
+            return true;
+        }
+    }
+    for (size_t i = 0; i < node.get_output_size(); i++)
+    {
+        if (node.get_output_element_type(i) == element::bf16)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// The bf16 Sum kernel reduces a [outer, inner] view, so the reduced axes have to be trailing
+// once axes of length one are ignored
+static bool reduces_trailing_axes(const op::Sum& sum)
+{
+    const Shape& shape = sum.get_argument(0)->get_shape();
+    const AxisSet& axes = sum.get_reduction_axes();
+    bool reducing = false;
+    for (size_t i = 0; i < shape.size(); i++)
+    {
+        if (axes.count(i) != 0)
+        {
+            reducing = reducing || shape[i] != 1;
+        }
+        else if (reducing && shape[i] != 1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool runtime::cpu::pass::CPUBF16Fallback::is_bf16_supported(const Node& node)
+{
+    if (node.is_parameter() || node.is_constant() || node.is_output() ||
+        node.description() == "GetOutputElement")
+    {
+        return true;
+    }
+    if (node.description() == "Convert")
+    {
+        auto in = node.get_input_element_type(0);
+        auto out = node.get_output_element_type(0);
+        return (in == element::bf16 && out == element::f32) ||
+               (in == element::f32 && out == element::bf16);
+    }
+    if (node.get_output_size() != 1 || node.get_element_type() != element::bf16)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < node.get_input_size(); i++)
+    {
+        if (node.get_input_element_type(i) != element::bf16)
+        {
+            return false;
+        }
+    }
+    if (auto sum = dynamic_cast<const op::Sum*>(&node))
+    {
+        return reduces_trailing_axes(*sum);
+    }
+    return get_bf16_compute_ops().count(node.description()) != 0 ||
+           get_bf16_movement_ops().count(node.description()) != 0;
+}
+
+// Narrows an f32 output of a rebuilt op back to bf16 if the op it replaces produced bf16
+static shared_ptr<Node> restore_type(const shared_ptr<Node>& node, const element::Type& type)
+{
+    return node->get_element_type() != type ? make_shared<op::Convert>(node, type) : node;
+}
+
+bool runtime::cpu::pass::CPUBF16Fallback::run_on_function(shared_ptr<Function> function)
+{
+    bool modified = false;
+    for (shared_ptr<Node> node : function->get_ordered_ops())
+    {
+        if (!uses_bf16(*node) || is_bf16_supported(*node))
+        {
+            continue;
+        }
+        if (!m_direct_execution)
+        {
+            throw ngraph_error("CPU backend only executes bf16 graphs in direct execution mode");
+        }
+
+        NodeVector new_args;
+        for (const shared_ptr<Node>& arg : node->get_arguments())
+        {
+            bool bf16_arg = arg->get_output_size() == 1 && arg->get_element_type() == element::bf16;
+            new_args.push_back(bf16_arg ? make_shared<op::Convert>(arg, element::f32) : arg);
+        }
+
+        if (node->description() == "Convert")
+        {
+            // Any conversion not between bf16 and f32 goes through f32
+            auto arg = new_args.at(0);
+            if (arg->get_element_type() != element::f32)
+            {
+                arg = make_shared<op::Convert>(arg, element::f32);
+            }
+            replace_node(node, make_shared<op::Convert>(arg, node->get_element_type()));
+        }
+        else if (node->get_output_size() == 1)
+        {
+            auto new_node = node->copy_with_new_args(new_args);
+            replace_node(node, restore_type(new_node, node->get_element_type()));
+        }
+        else
+        {
+            auto new_node = node->copy_with_new_args(new_args);
+            for (const shared_ptr<Node>& user : node->get_users())
+            {
+                auto goe = static_pointer_cast<op::GetOutputElement>(user);
+                auto new_goe = make_shared<op::GetOutputElement>(new_node, goe->get_n());
+                replace_node(goe, restore_type(new_goe, goe->get_element_type()));
+            }
+        }
+        modified = true;
+    }
+    return modified;
+}
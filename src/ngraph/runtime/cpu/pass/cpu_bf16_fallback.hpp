@@ -0,0 +1,62 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <set>
+#include <string>
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Runs bf16 ops that have no CPU bf16 kernel in f32.
+                ///
+                ///        Each such op is rebuilt on f32 copies of its bf16 inputs and its
+                ///        outputs are converted back to bf16, so the rest of the graph keeps its
+                ///        bf16 storage. The MKL/MKLDNN backed ops go this way since those
+                ///        libraries only provide f32 kernels here; Dot and Convolution have their
+                ///        own bf16 kernels instead.
+                class CPUBF16Fallback : public ngraph::pass::FunctionPass
+                {
+                public:
+                    CPUBF16Fallback(bool direct_execution = true)
+                        : m_direct_execution(direct_execution)
+                    {
+                    }
+
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+                    static bool is_bf16_supported(const ngraph::Node& node);
+
+                    /// \brief Compute ops with bf16 kernels, by Node::description()
+                    static std::set<std::string> get_bf16_compute_ops();
+                    /// \brief Data movement ops that copy bf16 values unchanged
+                    static std::set<std::string> get_bf16_movement_ops();
+
+                private:
+                    bool m_direct_execution;
+                };
+            }
+        }
+    }
+}
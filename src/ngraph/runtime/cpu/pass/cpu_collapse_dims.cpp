@@ -27,6 +27,7 @@
 #include "ngraph/op/min.hpp"
 #include "ngraph/op/product.hpp"
 #include "ngraph/op/reshape.hpp"
+#include "ngraph/op/softmax.hpp"
 #include "ngraph/op/sum.hpp"
 #include "ngraph/util.hpp"
 
@@ -239,6 +240,44 @@ static bool collapse_dot(std::shared_ptr<Node> n)
     return replaced;
 }
 
+static bool collapse_softmax(std::shared_ptr<Node> n)
+{
+    auto node = std::static_pointer_cast<op::Softmax>(n).get();
+    auto input_shape = node->get_shape();
+    auto operated_axes = node->get_axes();
+
+    // Single axis softmax already has native kernels for every rank
+    if (operated_axes.size() < 2)
+    {
+        return false;
+    }
+
+    struct CollapsedShape cshape;
+
+    collapse_dims(input_shape, operated_axes, cshape);
+
+    if (cshape.axis_set.size() == 0 || input_shape.size() == cshape.fshape.size())
+    {
+        return false;
+    }
+
+    // Reshape arg to collapsed input_shape
+    AxisVector input_axis_order = ngraph::get_default_order(input_shape);
+    auto reshape_input = std::make_shared<op::Reshape>(
+        node->get_argument(0), input_axis_order, Shape(cshape.fshape));
+
+    auto softmax = std::make_shared<op::Softmax>(reshape_input, AxisSet(cshape.axis_set));
+
+    // Reshape collapsed output to original shape
+    AxisVector output_axis_order = ngraph::get_default_order(cshape.fshape);
+    auto reshape_output = std::make_shared<op::Reshape>(softmax, output_axis_order, input_shape);
+    ngraph::replace_node(n, reshape_output);
+
+    NGRAPH_DEBUG << "CollapseDims: Replaced softmax " << input_shape << " " << operated_axes
+                 << " with " << Shape(cshape.fshape) << " " << AxisSet(cshape.axis_set);
+    return true;
+}
+
 bool runtime::cpu::pass::CPUCollapseDims::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
     bool replaced = false;
@@ -268,6 +307,10 @@ bool runtime::cpu::pass::CPUCollapseDims::run_on_function(std::shared_ptr<ngraph
         {
             replaced |= collapse_dot<op::Dot>(n);
         }
+        else if (std::dynamic_pointer_cast<op::Softmax>(n))
+        {
+            replaced |= collapse_softmax(n);
+        }
     }
 
     return replaced;
@@ -15,10 +15,13 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <string>
 #include <typeindex>
 #include <typeinfo>
+#include <unordered_map>
+#include <vector>
 
 #include <mkldnn.hpp>
 
@@ -286,8 +289,152 @@ static void set_layouts_unaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction*
     }
 }
 
+// Connected regions of elementwise ops. Elementwise kernels run as fast in any unpadded layout,
+// so the layout a region is computed in only decides the reorders at its boundary: on the
+// tensors it reads from other ops and on the ones it hands to them. The first binary op whose
+// arguments disagree picks the layout for the rest of its region, and later ones in the region
+// keep to it.
+class ElementwiseRegions
+{
+public:
+    // Adds `node` to the region of its elementwise arguments, merging them if there are several.
+    // Nodes have to be added in topological order.
+    void add(const shared_ptr<Node>& node)
+    {
+        size_t index = m_nodes.size();
+        m_nodes.push_back(node);
+        m_parents.push_back(index);
+        m_positions[node.get()] = index;
+        for (const auto& arg : node->get_arguments())
+        {
+            auto it = m_positions.find(arg.get());
+            if (it != m_positions.end())
+            {
+                m_parents[find(it->second)] = find(index);
+            }
+        }
+    }
+
+    // Layout of a binary elementwise `node` whose arguments have the layouts `arg_mds`
+    int select_layout(const shared_ptr<Node>& node, const vector<memory::desc>& arg_mds)
+    {
+        size_t region = find(m_positions.at(node.get()));
+        auto chosen = m_layouts.find(region);
+        if (chosen != m_layouts.end())
+        {
+            for (int i = 0; i < 2; i++)
+            {
+                if (mkldnn_utils::compare_mkldnn_mds(arg_mds[i], chosen->second))
+                {
+                    return i;
+                }
+            }
+        }
+
+        size_t cost[2];
+        for (int i = 0; i < 2; i++)
+        {
+            cost[i] = estimate_conversions(node, arg_mds[i]);
+        }
+        int select = cost[1] < cost[0] ? 1 : 0;
+        NGRAPH_DEBUG << "Layout of " << node->get_name() << ": " << cost[0]
+                     << " bytes reordered in its region with argument 0's, " << cost[1]
+                     << " with argument 1's";
+        m_layouts.erase(region);
+        m_layouts.emplace(region, arg_mds[select]);
+        return select;
+    }
+
+private:
+    size_t find(size_t index)
+    {
+        while (m_parents[index] != index)
+        {
+            m_parents[index] = m_parents[m_parents[index]];
+            index = m_parents[index];
+        }
+        return index;
+    }
+
+    // Bytes reordered on the boundary of the part of `node`'s region that is not laid out yet,
+    // if it is computed in layout `md`. Tensors whose layout is not set yet are assumed to be
+    // in a blocked layout if they come from an MKLDNN kernel and in the native one otherwise.
+    // MKLDNN users are assumed to prefer blocked layouts and the remaining ops the native one.
+    size_t estimate_conversions(const shared_ptr<Node>& node, const memory::desc& md)
+    {
+        size_t position = m_positions.at(node.get());
+        size_t region = find(position);
+        auto is_pending = [&](const Node* member) {
+            auto it = m_positions.find(member);
+            return it != m_positions.end() && it->second >= position &&
+                   find(it->second) == region;
+        };
+        auto shape = node->get_shape();
+        bool native = mkldnn_utils::compare_mkldnn_mds(
+            md,
+            mkldnn_utils::create_blocked_mkldnn_md(
+                shape, Strides(row_major_strides(shape)), node->get_element_type()));
+
+        size_t bytes = 0;
+        for (size_t i = position; i < m_nodes.size(); i++)
+        {
+            const auto& member = m_nodes[i];
+            if (!is_pending(member.get()))
+            {
+                continue;
+            }
+            size_t member_bytes =
+                shape_size(member->get_shape()) * member->get_element_type().size();
+            for (const descriptor::Input& input : member->get_inputs())
+            {
+                const auto& output = input.get_output();
+                if (is_pending(output.get_node().get()))
+                {
+                    continue;
+                }
+                auto tvl = dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(
+                    output.get_tensor_ptr()->get_tensor_layout());
+                bool matches;
+                if (tvl && tvl->is_mkldnn_layout())
+                {
+                    matches = mkldnn_utils::compare_mkldnn_mds(tvl->get_mkldnn_md(), md);
+                }
+                else if (tvl)
+                {
+                    matches = native;
+                }
+                else
+                {
+                    matches = mkldnn_utils::use_mkldnn_kernel(output.get_node().get()) != native;
+                }
+                bytes += matches ? 0 : shape_size(input.get_shape()) *
+                                           input.get_element_type().size();
+            }
+            for (const auto& user : member->get_users())
+            {
+                if (is_pending(user.get()))
+                {
+                    continue;
+                }
+                bool use_mkldnn = mkldnn_utils::use_mkldnn_kernel(user.get()) &&
+                                  !std::dynamic_pointer_cast<ngraph::op::Result>(user);
+                bytes += use_mkldnn == native ? member_bytes : 0;
+            }
+        }
+        return bytes;
+    }
+
+    vector<shared_ptr<Node>> m_nodes;
+    vector<size_t> m_parents;
+    unordered_map<const Node*, size_t> m_positions;
+    map<size_t, memory::desc> m_layouts;
+};
+
+// `regions` is only given when the layout is chosen by cost, otherwise the first argument's
+// layout is taken
 void set_layouts_binaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* external_function,
-                               std::shared_ptr<ngraph::Node> node)
+                               std::shared_ptr<ngraph::Node> node,
+                               ElementwiseRegions* regions)
 {
     std::vector<mkldnn::memory::desc> arg_mds{mkldnn_utils::get_input_mkldnn_md(node.get(), 0),
                                               mkldnn_utils::get_input_mkldnn_md(node.get(), 1)};
@@ -307,6 +454,10 @@ void set_layouts_binaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* exter
             const int user_select = std::atoi(std::getenv("NGRAPH_PASS_CPU_LAYOUT_ELTWISE"));
             select = (user_select == 0 || user_select == 1) ? user_select : select;
         }
+        else if (regions && !mkldnn_utils::compare_mkldnn_mds(arg_mds[0], arg_mds[1]))
+        {
+            select = regions->select_layout(node, arg_mds);
+        }
         i_mds.push_back(arg_mds[select]);
         i_mds.push_back(arg_mds[select]);
         o_mds.push_back(arg_mds[select]);
@@ -2014,6 +2165,20 @@ static const runtime::cpu::pass::LayoutOpMap s_dispatcher{
 
 bool runtime::cpu::pass::CPULayout::run_on_call_graph(const std::list<std::shared_ptr<Node>>& nodes)
 {
+    ElementwiseRegions regions;
+    if (m_use_cost_model)
+    {
+        for (const auto& node : nodes)
+        {
+            if (s_dispatcher.find(TI(*node)) == s_dispatcher.end() &&
+                (dynamic_pointer_cast<ngraph::op::util::UnaryElementwiseArithmetic>(node) ||
+                 dynamic_pointer_cast<ngraph::op::util::BinaryElementwiseArithmetic>(node)))
+            {
+                regions.add(node);
+            }
+        }
+    }
+
     for (const auto& node : nodes)
     {
         auto& n = *node;
@@ -2030,7 +2195,8 @@ bool runtime::cpu::pass::CPULayout::run_on_call_graph(const std::list<std::share
         else if (dynamic_pointer_cast<ngraph::op::util::BinaryElementwiseArithmetic>(node) !=
                  nullptr)
         {
-            set_layouts_binaryeltwise(m_external_function, node);
+            set_layouts_binaryeltwise(
+                m_external_function, node, m_use_cost_model ? &regions : nullptr);
         }
         else
         {
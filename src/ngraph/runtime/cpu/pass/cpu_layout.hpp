@@ -39,8 +39,14 @@ namespace ngraph
                 class CPULayout : public ngraph::pass::CallGraphPass
                 {
                 public:
-                    CPULayout(CPU_ExternalFunction* external_function)
+                    /// \param use_cost_model Choose the layout of each connected region of
+                    ///     elementwise ops by the bytes reordered on its boundary, rather than
+                    ///     always taking the first input's at ops with inputs in different
+                    ///     layouts
+                    CPULayout(CPU_ExternalFunction* external_function,
+                              bool use_cost_model = false)
                         : m_external_function(external_function)
+                        , m_use_cost_model(use_cost_model)
                     {
                     }
                     virtual bool
@@ -53,6 +59,7 @@ namespace ngraph
 
                 private:
                     CPU_ExternalFunction* m_external_function;
+                    bool m_use_cost_model;
                 };
             }
         }
@@ -0,0 +1,199 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "cpu_quant_fusion.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/dequantize.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/experimental/quantized_dot.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/pattern/matcher.hpp"
+#include "ngraph/pattern/op/label.hpp"
+
+using namespace ngraph;
+
+void ngraph::runtime::cpu::pass::CPUQuantFusion::construct_qdot(bool with_bias, bool with_relu)
+{
+    Shape shape_data{2, 4};
+    Shape shape_weights{4, 3};
+    Shape shape_out{2, 3};
+    auto output_et = with_relu ? element::u8 : element::i8;
+
+    auto data = std::make_shared<pattern::op::Label>(element::u8, shape_data);
+    auto data_scale = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto data_offset = std::make_shared<pattern::op::Label>(element::u8, Shape{});
+    auto weights = std::make_shared<pattern::op::Label>(element::i8, shape_weights);
+    auto weights_scale = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto weights_offset = std::make_shared<pattern::op::Label>(element::i8, Shape{});
+    auto bias = std::make_shared<pattern::op::Label>(element::f32, Shape{shape_out[1]});
+    auto output_scale = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto output_offset = std::make_shared<pattern::op::Label>(output_et, Shape{});
+
+    auto dq_data = std::make_shared<op::Dequantize>(
+        data, data_scale, data_offset, element::f32, AxisSet{});
+    auto dq_weights = std::make_shared<op::Dequantize>(
+        weights, weights_scale, weights_offset, element::f32, AxisSet{});
+    std::shared_ptr<Node> pattern_node = std::make_shared<op::Dot>(dq_data, dq_weights);
+    if (with_bias)
+    {
+        pattern_node = pattern_node + std::make_shared<op::Broadcast>(bias, shape_out, AxisSet{0});
+    }
+    if (with_relu)
+    {
+        pattern_node = std::make_shared<op::Relu>(pattern_node);
+    }
+    auto pquantize =
+        std::make_shared<op::Quantize>(pattern_node,
+                                       output_scale,
+                                       output_offset,
+                                       output_et,
+                                       AxisSet{},
+                                       op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN);
+
+    pattern::graph_rewrite_callback callback = [=](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In a callback for construct_qdot against "
+                     << m.get_match_root()->get_name();
+
+        auto pattern_map = m.get_pattern_map();
+        auto quantize = std::static_pointer_cast<op::Quantize>(m.get_match_root());
+
+        // The kernel requantizes per tensor, rounding half to even and saturating to
+        // u8 after a relu and to i8 otherwise
+        if (quantize->get_round_mode() != op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN ||
+            quantize->get_element_type() != output_et)
+        {
+            NGRAPH_DEBUG << "Quantize type or round mode not supported";
+            return false;
+        }
+
+        if (pattern_map[data]->get_element_type() != element::u8 ||
+            pattern_map[weights]->get_element_type() != element::i8)
+        {
+            NGRAPH_DEBUG << "Only u8 data and i8 weights are supported";
+            return false;
+        }
+
+        for (auto scale : {data_scale, weights_scale, output_scale})
+        {
+            if (pattern_map[scale]->get_shape() != Shape{})
+            {
+                NGRAPH_DEBUG << "Only per-tensor scales are supported";
+                return false;
+            }
+        }
+
+        for (auto offset : {data_offset, weights_offset, output_offset})
+        {
+            if (!ngraph::is_zero(pattern_map[offset]))
+            {
+                NGRAPH_DEBUG << "Only zero offsets are supported";
+                return false;
+            }
+        }
+
+        NodeVector intermediates;
+        auto node = quantize->get_argument(0);
+        if (with_relu)
+        {
+            intermediates.push_back(node);
+            node = node->get_argument(0);
+        }
+        std::shared_ptr<Node> broadcast;
+        if (with_bias)
+        {
+            intermediates.push_back(node);
+            broadcast = node->get_argument(1);
+            node = node->get_argument(0);
+            if (!std::dynamic_pointer_cast<op::Dot>(node))
+            {
+                std::swap(node, broadcast);
+            }
+        }
+        auto dot = std::static_pointer_cast<op::Dot>(node);
+        intermediates.push_back(dot);
+
+        for (auto intermediate : intermediates)
+        {
+            if (intermediate->get_users().size() > 1)
+            {
+                NGRAPH_DEBUG << intermediate->get_name() << " has more than one user";
+                return false;
+            }
+        }
+
+        auto& data_shape = pattern_map[data]->get_shape();
+        auto& weights_shape = pattern_map[weights]->get_shape();
+        if (dot->get_reduction_axes_count() != 1 || weights_shape.size() != 2 ||
+            data_shape.size() < 1)
+        {
+            NGRAPH_DEBUG << "Only [..., K] x [K, M] products are supported";
+            return false;
+        }
+
+        auto quantized_scale = pattern_map[data_scale] * pattern_map[weights_scale];
+        auto requantization_scale = quantized_scale / pattern_map[output_scale];
+
+        std::shared_ptr<Node> qdot;
+        if (with_bias)
+        {
+            auto m_broadcast = std::static_pointer_cast<op::Broadcast>(broadcast);
+            AxisSet broadcast_axes;
+            for (size_t i = 0; i + 1 < data_shape.size(); i++)
+            {
+                broadcast_axes.insert(i);
+            }
+            if (m_broadcast->get_broadcast_axes() != broadcast_axes ||
+                pattern_map[bias]->get_shape() != Shape{weights_shape[1]})
+            {
+                NGRAPH_DEBUG << "Bias is not broadcast along the output dimension";
+                return false;
+            }
+
+            auto zero = op::Constant::create(element::i32, Shape{}, {0});
+            auto qbias = std::make_shared<op::Quantize>(
+                pattern_map[bias],
+                quantized_scale,
+                zero,
+                element::i32,
+                AxisSet{},
+                op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN);
+            qdot = std::make_shared<op::QuantizedDotBias>(pattern_map[data],
+                                                          pattern_map[weights],
+                                                          qbias,
+                                                          requantization_scale,
+                                                          true,
+                                                          with_relu);
+        }
+        else
+        {
+            qdot = std::make_shared<op::QuantizedDot>(
+                pattern_map[data], pattern_map[weights], requantization_scale, true, with_relu);
+        }
+
+        ngraph::replace_node(m.get_match_root(), qdot);
+        return true;
+    };
+
+    auto m = std::make_shared<pattern::Matcher>(pquantize, callback, "CPUQuantFusion.QDot");
+    this->add_matcher(m);
+}
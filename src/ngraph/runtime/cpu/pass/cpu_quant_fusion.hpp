@@ -0,0 +1,52 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/graph_rewrite.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                class CPUQuantFusion;
+            }
+        }
+    }
+}
+
+// Rewrites floating point subgraphs bracketed by Dequantize and Quantize into quantized ops.
+// Runs ahead of CPUFusion so that the Dot is still intact when the pattern is matched.
+class ngraph::runtime::cpu::pass::CPUQuantFusion : public ngraph::pass::GraphRewrite
+{
+public:
+    CPUQuantFusion()
+        : GraphRewrite()
+    {
+        construct_qdot(false, false);
+        construct_qdot(false, true);
+        construct_qdot(true, false);
+        construct_qdot(true, true);
+    }
+
+private:
+    // Quantize({Relu}(Dot(Dequantize(u8), Dequantize(i8)) {+ Broadcast(bias)}))
+    void construct_qdot(bool with_bias, bool with_relu);
+};
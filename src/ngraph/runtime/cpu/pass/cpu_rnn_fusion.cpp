@@ -29,10 +29,13 @@
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
+#include "ngraph/op/equal.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/greater.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/parameter.hpp"
@@ -40,6 +43,7 @@
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/op/slice.hpp"
+#include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/pattern/matcher.hpp"
@@ -316,6 +320,293 @@ void ngraph::runtime::cpu::pass::LSTMFusion::construct_lstm_fprop()
     this->add_matcher(m);
 }
 
+// Accepts a Slice that extracts gate `gate` out of `n_gates` gates concatenated along the
+// feature axis
+static std::function<bool(std::shared_ptr<Node>)> gate_slice(size_t gate, size_t n_gates)
+{
+    return [gate, n_gates](std::shared_ptr<Node> n) {
+        auto slice = std::dynamic_pointer_cast<op::Slice>(n);
+        if (!slice || slice->get_shape().size() != 2)
+        {
+            return false;
+        }
+        const Shape& gates_shape = slice->get_argument(0)->get_shape();
+        size_t feature_size = slice->get_shape()[1];
+        return gates_shape[0] == slice->get_shape()[0] &&
+               gates_shape[1] == n_gates * feature_size &&
+               slice->get_lower_bounds() == Coordinate{0, gate * feature_size} &&
+               slice->get_strides() == Strides{1, 1};
+    };
+}
+
+static bool is_broadcast_of_ones(std::shared_ptr<Node> n)
+{
+    if (std::dynamic_pointer_cast<op::Broadcast>(n))
+    {
+        n = n->get_argument(0);
+    }
+    auto constant = std::dynamic_pointer_cast<op::Constant>(n);
+    if (!constant || constant->get_element_type() != element::f32)
+    {
+        return false;
+    }
+    auto values = constant->get_vector<float>();
+    return std::all_of(values.begin(), values.end(), [](float v) { return v == 1.0f; });
+}
+
+// Checks that `state` is the recurrent input of a vanilla RNN cell with recurrent weights
+// `weights` and output `ht`. The cell is symmetric in x_t and h_{(t-1)}, so the pattern matcher
+// cannot tell them apart; only the recurrence can. Either h_{(t-1)} is the output of the
+// previous, already fused, cell with the same recurrent weights, or h_t is multiplied by them
+// in the next cell. A dense layer feeding nothing back is never taken for a cell.
+static bool is_recurrent_state(std::shared_ptr<Node> state,
+                               std::shared_ptr<Node> weights,
+                               std::shared_ptr<Node> ht)
+{
+    const Shape& weights_shape = weights->get_shape();
+    if (weights_shape.size() != 2 || weights_shape[0] != weights_shape[1] ||
+        state->get_shape() != ht->get_shape())
+    {
+        return false;
+    }
+    if (auto goe = std::dynamic_pointer_cast<op::GetOutputElement>(state))
+    {
+        auto cell = std::dynamic_pointer_cast<op::Rnn>(goe->get_arguments().at(0));
+        if (cell && cell->get_argument(3) == weights)
+        {
+            return true;
+        }
+    }
+    for (const std::shared_ptr<Node>& user : ht->get_users())
+    {
+        if (std::dynamic_pointer_cast<op::Dot>(user) && user->get_argument(0) == ht &&
+            user->get_argument(1) == weights)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ngraph::runtime::cpu::pass::RNNCellFusion::construct_gru_fprop()
+{
+    // This pattern captures the following equations in the given data
+    // flow graph
+    //
+    //   u_t = sigmoid(W_{iu} x_t + b_{iu} + W_{hu} h_{(t-1)} + b_{hu});
+    //   r_t = sigmoid(W_{ir} x_t + b_{ir} + W_{hr} h_{(t-1)} + b_{hr});
+    //   c_t = tanh   (W_{ic} x_t + b_{ic} + W_{hc} (r_t * h_{(t-1)}) + b_{hc});
+    //   h_t = (1 - u_t) * c_t + u_t * h_{(t-1)};
+    //
+
+    // Inputs to the sub-graph
+    // Assumes the input weights for all the 3 gates are fused in the order -
+    //                      update (u), reset (r) and candidate (c)
+    // and the recurrent weights of the update and reset gates are fused
+    auto w_i2h = std::make_shared<pattern::op::Label>(element::f32, Shape{100, 150});
+    auto bias_i2h = std::make_shared<pattern::op::Label>(element::f32, Shape{10, 150});
+    auto w_h2h_ur = std::make_shared<pattern::op::Label>(element::f32, Shape{50, 100});
+    auto bias_h2h_ur = std::make_shared<pattern::op::Label>(element::f32, Shape{10, 100});
+    auto w_h2h_c = std::make_shared<pattern::op::Label>(element::f32, Shape{50, 50});
+    auto bias_h2h_c = std::make_shared<pattern::op::Label>(element::f32, Shape{10, 50});
+    auto xt = std::make_shared<pattern::op::Label>(element::f32, Shape{10, 100});
+    auto ht_1 = std::make_shared<pattern::op::Label>(element::f32, Shape{10, 50});
+    auto ones =
+        std::make_shared<pattern::op::Label>(element::f32, Shape{10, 50}, is_broadcast_of_ones);
+
+    auto broadcast_pred = [](std::shared_ptr<Node> n) {
+        return ((std::dynamic_pointer_cast<op::Broadcast>(n) != nullptr) ||
+                (std::dynamic_pointer_cast<op::Reshape>(n) != nullptr));
+    };
+
+    // Fused MatMuls
+    // (W_{iu} | W_{ir} | W_{ic}) * x_t + (b_{iu} | b_{ir} | b_{ic})
+    auto x_gates = std::make_shared<op::Add>(
+        std::make_shared<op::Dot>(xt, w_i2h),
+        std::make_shared<pattern::op::Skip>(bias_i2h, broadcast_pred));
+    // (W_{hu} | W_{hr}) * h_{(t-1)} + (b_{hu} | b_{hr})
+    auto h_gates = std::make_shared<op::Add>(
+        std::make_shared<op::Dot>(ht_1, w_h2h_ur),
+        std::make_shared<pattern::op::Skip>(bias_h2h_ur, broadcast_pred));
+
+    // The gate slices are labelled so that the matcher checks which gate each one extracts
+    auto gate = [](std::shared_ptr<Node> gates, size_t index, size_t n_gates) {
+        auto slice = std::make_shared<op::Slice>(
+            gates, Coordinate{0, index * 50}, Coordinate{10, (index + 1) * 50});
+        return std::make_shared<pattern::op::Label>(
+            slice, gate_slice(index, n_gates), NodeVector{slice});
+    };
+
+    // construct gates
+    auto ut = std::make_shared<op::Sigmoid>(
+        std::make_shared<op::Add>(gate(x_gates, 0, 3), gate(h_gates, 0, 2)));
+    auto rt = std::make_shared<op::Sigmoid>(
+        std::make_shared<op::Add>(gate(x_gates, 1, 3), gate(h_gates, 1, 2)));
+    auto h_c = std::make_shared<op::Add>(
+        std::make_shared<op::Dot>(std::make_shared<op::Multiply>(rt, ht_1), w_h2h_c),
+        std::make_shared<pattern::op::Skip>(bias_h2h_c, broadcast_pred));
+    auto ct = std::make_shared<op::Tanh>(std::make_shared<op::Add>(gate(x_gates, 2, 3), h_c));
+
+    // construct (h_t)
+    auto ht = std::make_shared<op::Add>(
+        std::make_shared<op::Multiply>(std::make_shared<op::Subtract>(ones, ut), ct),
+        std::make_shared<op::Multiply>(ut, ht_1));
+
+    // Define a call back that needs to called once the DFG matches the pattern
+    pattern::graph_rewrite_callback callback =
+        [w_i2h, bias_i2h, w_h2h_ur, bias_h2h_ur, w_h2h_c, bias_h2h_c, xt, ht_1](
+            pattern::Matcher& m) {
+            NGRAPH_DEBUG << "In a callback for construct_gru_fprop pattern against "
+                         << m.get_match_root()->get_name();
+
+            auto pattern_map = m.get_pattern_map();
+
+            if (m.get_match_root()->get_element_type() != element::f32)
+            {
+                NGRAPH_DEBUG << "mpattern = " << m.get_match_root()->get_name()
+                             << " type is not float!";
+                return false;
+            }
+
+            CHECK_RANK(pattern_map[xt], 2);
+            CHECK_RANK(pattern_map[ht_1], 2);
+            CHECK_RANK(pattern_map[w_i2h], 2);
+            CHECK_RANK(pattern_map[w_h2h_ur], 2);
+            CHECK_RANK(pattern_map[w_h2h_c], 2);
+            CHECK_RANK(pattern_map[bias_i2h], 1);
+            CHECK_RANK(pattern_map[bias_h2h_ur], 1);
+            CHECK_RANK(pattern_map[bias_h2h_c], 1);
+
+            auto src_layer = pattern_map[xt];
+            auto src_iter = pattern_map[ht_1];
+            auto weights_layer = pattern_map[w_i2h];
+
+            // set GRU cell attributes
+            const size_t gru_n_gates = 3;
+            size_t slc = src_layer->get_shape()[1];
+            size_t sic = src_iter->get_shape()[1];
+            if (weights_layer->get_shape() != Shape{slc, gru_n_gates * sic} ||
+                pattern_map[w_h2h_ur]->get_shape() != Shape{sic, 2 * sic} ||
+                pattern_map[w_h2h_c]->get_shape() != Shape{sic, sic} ||
+                pattern_map[bias_i2h]->get_shape() != Shape{gru_n_gates * sic} ||
+                pattern_map[bias_h2h_ur]->get_shape() != Shape{2 * sic} ||
+                pattern_map[bias_h2h_c]->get_shape() != Shape{sic})
+            {
+                NGRAPH_DEBUG << "Feature size mismatch between weights and input tensors";
+                return false;
+            }
+
+            // MKLDNN applies the recurrent weights of the candidate gate to r_t * h_{(t-1)},
+            // so all the recurrent weights can be passed as one tensor
+            auto weights_iter = std::make_shared<op::Concat>(
+                NodeVector{pattern_map[w_h2h_ur], pattern_map[w_h2h_c]}, 1);
+            auto bias = std::make_shared<op::Add>(
+                pattern_map[bias_i2h],
+                std::make_shared<op::Concat>(
+                    NodeVector{pattern_map[bias_h2h_ur], pattern_map[bias_h2h_c]}, 0));
+
+            auto rnn_node = std::make_shared<op::Rnn>(
+                src_layer, src_iter, weights_layer, weights_iter, bias, 1, gru_n_gates, 1, 1, 1, 1);
+            ngraph::replace_node(m.get_match_root(),
+                                 std::make_shared<op::GetOutputElement>(rnn_node, 0));
+            return true;
+        };
+    auto m = std::make_shared<pattern::Matcher>(ht, callback, "RNNCellFusion.Gru");
+    this->add_matcher(m);
+}
+
+void ngraph::runtime::cpu::pass::RNNCellFusion::construct_vanilla_rnn_fprop()
+{
+    // This pattern captures the following equation in the given data
+    // flow graph
+    //
+    //   h_t = tanh(W_{ih} x_t + b_{ih} + W_{hh} h_{(t-1)} + b_{hh});
+    //
+    auto w_i2h = std::make_shared<pattern::op::Label>(element::f32, Shape{100, 50});
+    auto bias_i2h = std::make_shared<pattern::op::Label>(element::f32, Shape{10, 50});
+    auto w_h2h = std::make_shared<pattern::op::Label>(element::f32, Shape{50, 50});
+    auto bias_h2h = std::make_shared<pattern::op::Label>(element::f32, Shape{10, 50});
+    auto xt = std::make_shared<pattern::op::Label>(element::f32, Shape{10, 100});
+    auto ht_1 = std::make_shared<pattern::op::Label>(element::f32, Shape{10, 50});
+
+    auto broadcast_pred = [](std::shared_ptr<Node> n) {
+        return ((std::dynamic_pointer_cast<op::Broadcast>(n) != nullptr) ||
+                (std::dynamic_pointer_cast<op::Reshape>(n) != nullptr));
+    };
+
+    auto add1 = std::make_shared<op::Add>(
+        std::make_shared<op::Dot>(xt, w_i2h),
+        std::make_shared<pattern::op::Skip>(bias_i2h, broadcast_pred));
+    auto add2 = std::make_shared<op::Add>(
+        std::make_shared<op::Dot>(ht_1, w_h2h),
+        std::make_shared<pattern::op::Skip>(bias_h2h, broadcast_pred));
+    auto ht = std::make_shared<op::Tanh>(std::make_shared<op::Add>(add1, add2));
+
+    // Define a call back that needs to called once the DFG matches the pattern
+    pattern::graph_rewrite_callback callback =
+        [w_i2h, bias_i2h, w_h2h, bias_h2h, xt, ht_1](pattern::Matcher& m) {
+            NGRAPH_DEBUG << "In a callback for construct_vanilla_rnn_fprop pattern against "
+                         << m.get_match_root()->get_name();
+
+            auto pattern_map = m.get_pattern_map();
+
+            if (m.get_match_root()->get_element_type() != element::f32)
+            {
+                NGRAPH_DEBUG << "mpattern = " << m.get_match_root()->get_name()
+                             << " type is not float!";
+                return false;
+            }
+
+            CHECK_RANK(pattern_map[xt], 2);
+            CHECK_RANK(pattern_map[ht_1], 2);
+            CHECK_RANK(pattern_map[w_i2h], 2);
+            CHECK_RANK(pattern_map[w_h2h], 2);
+            CHECK_RANK(pattern_map[bias_i2h], 1);
+            CHECK_RANK(pattern_map[bias_h2h], 1);
+
+            auto src_layer = pattern_map[xt];
+            auto src_iter = pattern_map[ht_1];
+            auto weights_layer = pattern_map[w_i2h];
+            auto weights_iter = pattern_map[w_h2h];
+            auto bias_layer = pattern_map[bias_i2h];
+            auto bias_iter = pattern_map[bias_h2h];
+
+            // Only fuse cells that are a part of an RNN, otherwise a pair of dense layers
+            // followed by a tanh would be fused as well
+            auto cell_output = m.get_match_root();
+            if (!is_recurrent_state(src_iter, weights_iter, cell_output))
+            {
+                std::swap(src_layer, src_iter);
+                std::swap(weights_layer, weights_iter);
+                std::swap(bias_layer, bias_iter);
+            }
+            if (!is_recurrent_state(src_iter, weights_iter, cell_output))
+            {
+                NGRAPH_DEBUG << "Neither input is the recurrent state of an RNN cell";
+                return false;
+            }
+
+            size_t slc = src_layer->get_shape()[1];
+            size_t sic = src_iter->get_shape()[1];
+            if (weights_layer->get_shape() != Shape{slc, sic} ||
+                weights_iter->get_shape() != Shape{sic, sic} ||
+                bias_layer->get_shape() != Shape{sic} || bias_iter->get_shape() != Shape{sic})
+            {
+                NGRAPH_DEBUG << "Feature size mismatch between weights and input tensors";
+                return false;
+            }
+
+            auto bias = std::make_shared<op::Add>(bias_layer, bias_iter);
+            auto rnn_node = std::make_shared<op::Rnn>(
+                src_layer, src_iter, weights_layer, weights_iter, bias, 1, 1, 1, 1, 1, 1);
+            ngraph::replace_node(m.get_match_root(),
+                                 std::make_shared<op::GetOutputElement>(rnn_node, 0));
+            return true;
+        };
+    auto m = std::make_shared<pattern::Matcher>(ht, callback, "RNNCellFusion.VanillaRnn");
+    this->add_matcher(m);
+}
+
 void ngraph::runtime::cpu::pass::RNNFusion::construct_rnn_lstm_fprop()
 {
     // Captures multiple LSTM cells corresponding to the timesteps of a single RNN
@@ -328,15 +619,20 @@ void ngraph::runtime::cpu::pass::RNNFusion::construct_rnn_lstm_fprop()
     auto lstm_src_iter_label =
         std::make_shared<pattern::op::Label>(lstm_src_iter, nullptr, NodeVector{lstm_src_iter});
 
-    auto lstm_weights_layer_shared = std::make_shared<pattern::op::Label>(
-        element::f32, Shape{400, 100}, pattern::has_class<op::Parameter>());
+    // Weights are shared by all timesteps, as parameters or as constants of an imported model
+    auto is_weights = [](std::shared_ptr<Node> n) {
+        return std::dynamic_pointer_cast<op::Parameter>(n) != nullptr ||
+               std::dynamic_pointer_cast<op::Constant>(n) != nullptr;
+    };
+    auto lstm_weights_layer_shared =
+        std::make_shared<pattern::op::Label>(element::f32, Shape{400, 100}, is_weights);
     auto lstm_weights_layer =
         std::make_shared<op::Reshape>(lstm_weights_layer_shared, AxisVector{1, 0}, Shape{100, 400});
     auto lstm_weights_layer_label = std::make_shared<pattern::op::Label>(
         lstm_weights_layer, nullptr, NodeVector{lstm_weights_layer});
 
-    auto lstm_weights_iter_shared = std::make_shared<pattern::op::Label>(
-        element::f32, Shape{400, 100}, pattern::has_class<op::Parameter>());
+    auto lstm_weights_iter_shared =
+        std::make_shared<pattern::op::Label>(element::f32, Shape{400, 100}, is_weights);
     auto lstm_weights_iter =
         std::make_shared<op::Reshape>(lstm_weights_iter_shared, AxisVector{1, 0}, Shape{100, 400});
     auto lstm_weights_iter_label = std::make_shared<pattern::op::Label>(
@@ -551,6 +847,361 @@ void ngraph::runtime::cpu::pass::RNNFusion::construct_rnn_lstm_fprop()
     this->add_matcher(m);
 }
 
+// Combines single timestep GRU or vanilla RNN cells, captured by RNNCellFusion and matched
+// from the last timestep to the first, into one Rnn op
+static bool fuse_rnn_cells_across_timesteps(pattern::RecurrentMatcher& m,
+                                            std::shared_ptr<pattern::op::Label> cell_src_layer,
+                                            std::shared_ptr<pattern::op::Label> cell_goe_label,
+                                            size_t n_gates)
+{
+    NGRAPH_DEBUG << " In recurrent RNN fusion callback for " << n_gates << " gate cells";
+
+    const auto sequence_len = m.get_number_of_recurrent_matches();
+    if (sequence_len < 2)
+    {
+        NGRAPH_DEBUG << "Single timestep RNN";
+        return false;
+    }
+
+    auto cell_goes = m.get_bound_nodes_for_pattern(cell_goe_label);
+    std::reverse(cell_goes.begin(), cell_goes.end());
+    std::vector<std::shared_ptr<op::Rnn>> cells;
+    for (auto goe : cell_goes)
+    {
+        auto cell = std::dynamic_pointer_cast<op::Rnn>(goe->get_arguments().at(0));
+        if (!cell || std::static_pointer_cast<op::GetOutputElement>(goe)->get_n() != 0 ||
+            cell->get_num_timesteps() != 1 || cell->get_gates_per_cell() != n_gates ||
+            cell->get_num_cell_states() != 1 || cell->get_direction() != 1 ||
+            cell->get_num_fused_layers() != 1)
+        {
+            NGRAPH_DEBUG << "Matched node is not a single timestep RNN cell with " << n_gates
+                         << " gates";
+            return false;
+        }
+        cells.push_back(cell);
+    }
+
+    // src_layer -> concatenate input symbols of all the cells in the order 0, 1, 2... t
+    auto src_layers = m.get_bound_nodes_for_pattern(cell_src_layer);
+    std::reverse(src_layers.begin(), src_layers.end());
+    auto rnn_src_layer = std::make_shared<op::Concat>(src_layers, 0);
+    // pick src_iter from the first cell, weights and bias are shared across cells
+    auto first_cell = cells[0];
+    auto rnn = std::make_shared<op::Rnn>(rnn_src_layer,
+                                         first_cell->get_argument(1),
+                                         first_cell->get_argument(2),
+                                         first_cell->get_argument(3),
+                                         first_cell->get_argument(4),
+                                         sequence_len,
+                                         n_gates,
+                                         sequence_len,
+                                         1,
+                                         1,
+                                         1);
+
+    // ht of each timestep is a slice of the fused RNN's dst_layer
+    const size_t batch_size = first_cell->get_batch_size();
+    const size_t feature_size = first_cell->get_src_iter_feature_size();
+    auto rnn_ht_goe = std::make_shared<op::GetOutputElement>(rnn, 0);
+    for (size_t i = 0, start_index = 0; i < sequence_len; i++, start_index += batch_size)
+    {
+        auto ht_slice =
+            std::make_shared<op::Slice>(rnn_ht_goe,
+                                        Coordinate{start_index, 0},
+                                        Coordinate{start_index + batch_size, feature_size});
+        ngraph::replace_node(cell_goes[i], ht_slice);
+    }
+    NGRAPH_DEBUG << "End of recurrent fusion call back "
+                 << "matched_node: " << m.get_match_root()->get_name();
+    return true;
+}
+
+void ngraph::runtime::cpu::pass::RNNFusion::construct_rnn_gru_fprop()
+{
+    // Captures multiple GRU cells corresponding to the timesteps of a single RNN
+    auto gru_src_layer = std::make_shared<pattern::op::Label>(element::f32, Shape{10, 100});
+    auto gru_src_iter = std::make_shared<pattern::op::Label>(element::f32, Shape{10, 50});
+
+    // Shared nodes across GRU cells -
+    auto gru_weights_layer = std::make_shared<pattern::op::Label>(element::f32, Shape{100, 150});
+    auto gru_weights_iter_ur = std::make_shared<pattern::op::Label>(element::f32, Shape{50, 100});
+    auto gru_weights_iter_c = std::make_shared<pattern::op::Label>(element::f32, Shape{50, 50});
+    auto gru_weights_iter =
+        std::make_shared<op::Concat>(NodeVector{gru_weights_iter_ur, gru_weights_iter_c}, 1);
+    auto gru_bias_layer = std::make_shared<pattern::op::Label>(element::f32, Shape{150});
+    auto gru_bias_iter_ur = std::make_shared<pattern::op::Label>(element::f32, Shape{100});
+    auto gru_bias_iter_c = std::make_shared<pattern::op::Label>(element::f32, Shape{50});
+    auto gru_bias = std::make_shared<op::Add>(
+        gru_bias_layer,
+        std::make_shared<op::Concat>(NodeVector{gru_bias_iter_ur, gru_bias_iter_c}, 0));
+
+    auto gru = std::make_shared<op::Rnn>(gru_src_layer,
+                                         gru_src_iter,
+                                         gru_weights_layer,
+                                         gru_weights_iter,
+                                         gru_bias,
+                                         1,
+                                         3,
+                                         1,
+                                         1,
+                                         1,
+                                         1);
+    auto gru_goe = std::make_shared<op::GetOutputElement>(gru, 0);
+    // We cannot attach labels to multi-output nodes, so we attach a label to the goe instead
+    auto gru_goe_label =
+        std::make_shared<pattern::op::Label>(gru_goe, nullptr, NodeVector{gru_goe});
+
+    pattern::recurrent_graph_rewrite_callback callback = [gru_src_layer, gru_goe_label](
+        pattern::RecurrentMatcher& m) {
+        return fuse_rnn_cells_across_timesteps(m, gru_src_layer, gru_goe_label, 3);
+    };
+
+    auto m = std::make_shared<pattern::RecurrentMatcher>(
+        gru_goe_label,
+        gru_src_iter,
+        std::set<std::shared_ptr<pattern::op::Label>>{gru_weights_layer,
+                                                      gru_weights_iter_ur,
+                                                      gru_weights_iter_c,
+                                                      gru_bias_layer,
+                                                      gru_bias_iter_ur,
+                                                      gru_bias_iter_c},
+        callback);
+    this->add_matcher(m);
+}
+
+void ngraph::runtime::cpu::pass::RNNFusion::construct_rnn_vanilla_fprop()
+{
+    // Captures multiple vanilla RNN cells corresponding to the timesteps of a single RNN
+    auto cell_src_layer = std::make_shared<pattern::op::Label>(element::f32, Shape{10, 100});
+    auto cell_src_iter = std::make_shared<pattern::op::Label>(element::f32, Shape{10, 50});
+
+    // Shared nodes across vanilla RNN cells -
+    auto cell_weights_layer = std::make_shared<pattern::op::Label>(element::f32, Shape{100, 50});
+    auto cell_weights_iter = std::make_shared<pattern::op::Label>(element::f32, Shape{50, 50});
+    auto cell_bias_layer = std::make_shared<pattern::op::Label>(element::f32, Shape{50});
+    auto cell_bias_iter = std::make_shared<pattern::op::Label>(element::f32, Shape{50});
+    auto cell_bias = std::make_shared<op::Add>(cell_bias_layer, cell_bias_iter);
+
+    auto cell = std::make_shared<op::Rnn>(cell_src_layer,
+                                          cell_src_iter,
+                                          cell_weights_layer,
+                                          cell_weights_iter,
+                                          cell_bias,
+                                          1,
+                                          1,
+                                          1,
+                                          1,
+                                          1,
+                                          1);
+    auto cell_goe = std::make_shared<op::GetOutputElement>(cell, 0);
+    auto cell_goe_label =
+        std::make_shared<pattern::op::Label>(cell_goe, nullptr, NodeVector{cell_goe});
+
+    pattern::recurrent_graph_rewrite_callback callback = [cell_src_layer, cell_goe_label](
+        pattern::RecurrentMatcher& m) {
+        return fuse_rnn_cells_across_timesteps(m, cell_src_layer, cell_goe_label, 1);
+    };
+
+    auto m = std::make_shared<pattern::RecurrentMatcher>(
+        cell_goe_label,
+        cell_src_iter,
+        std::set<std::shared_ptr<pattern::op::Label>>{
+            cell_weights_layer, cell_weights_iter, cell_bias_layer, cell_bias_iter},
+        callback);
+    this->add_matcher(m);
+}
+
+// Checks that `rnn` and `reversed_rnn` are single layer Rnns of the same shape whose inputs
+// are the same timesteps in opposite orders
+static bool is_reversed_rnn_pair(std::shared_ptr<op::Rnn> rnn,
+                                 std::shared_ptr<op::Rnn> reversed_rnn)
+{
+    if (rnn->get_num_timesteps() != reversed_rnn->get_num_timesteps() ||
+        rnn->get_gates_per_cell() != reversed_rnn->get_gates_per_cell() ||
+        rnn->get_num_cell_states() != reversed_rnn->get_num_cell_states())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < 5; i++)
+    {
+        if (rnn->get_input_shape(i) != reversed_rnn->get_input_shape(i))
+        {
+            return false;
+        }
+    }
+
+    auto src_layer = rnn->get_argument(0)->get_arguments();
+    auto reversed_src_layer = reversed_rnn->get_argument(0)->get_arguments();
+    if (!std::equal(src_layer.begin(), src_layer.end(), reversed_src_layer.rbegin()))
+    {
+        return false;
+    }
+
+    // Neither Rnn may feed the other, or the fused Rnn would depend on itself
+    bool dependent = false;
+    traverse_nodes(rnn->get_arguments(),
+                   [&](std::shared_ptr<Node> n) { dependent |= n == reversed_rnn; },
+                   false);
+    traverse_nodes(reversed_rnn->get_arguments(),
+                   [&](std::shared_ptr<Node> n) { dependent |= n == rnn; },
+                   false);
+    return !dependent;
+}
+
+// Replaces the users of dst_layer (rnn_goe0) of an Rnn that became `direction` of the
+// bidirectional Rnn whose dst_layer is birnn_goe0. Timestep t of the right to left Rnn is
+// timestep (num_timesteps - 1 - t) of the bidirectional Rnn.
+static void replace_rnn_dst_layer(std::shared_ptr<Node> rnn_goe0,
+                                  std::shared_ptr<Node> birnn_goe0,
+                                  size_t direction,
+                                  size_t num_timesteps,
+                                  size_t batch_size,
+                                  size_t feature_size)
+{
+    auto birnn_row = [&](size_t row) {
+        size_t step = row / batch_size;
+        size_t birnn_step = direction == 0 ? step : num_timesteps - 1 - step;
+        return birnn_step * batch_size + row % batch_size;
+    };
+    const size_t column = direction * feature_size;
+
+    std::shared_ptr<Node> dst_layer;
+    for (auto user : rnn_goe0->get_users())
+    {
+        // The per timestep slices RNNFusion leaves behind map to slices of the bidirectional
+        // output
+        auto slice = std::dynamic_pointer_cast<op::Slice>(user);
+        if (slice && slice->get_strides() == Strides{1, 1})
+        {
+            auto& lower = slice->get_lower_bounds();
+            auto& upper = slice->get_upper_bounds();
+            if (lower[0] / batch_size == (upper[0] - 1) / batch_size)
+            {
+                size_t row = birnn_row(lower[0]);
+                ngraph::replace_node(
+                    slice,
+                    std::make_shared<op::Slice>(
+                        birnn_goe0,
+                        Coordinate{row, lower[1] + column},
+                        Coordinate{row + upper[0] - lower[0], upper[1] + column}));
+                continue;
+            }
+        }
+
+        if (!dst_layer)
+        {
+            NodeVector timesteps;
+            for (size_t t = 0; t < num_timesteps; t++)
+            {
+                size_t row = birnn_row(t * batch_size);
+                timesteps.push_back(std::make_shared<op::Slice>(
+                    birnn_goe0,
+                    Coordinate{row, column},
+                    Coordinate{row + batch_size, column + feature_size}));
+            }
+            dst_layer = std::make_shared<op::Concat>(timesteps, 0);
+        }
+        for (auto& input : user->get_inputs())
+        {
+            if (input.get_output().get_node() == rnn_goe0)
+            {
+                input.replace_output(dst_layer->get_outputs().at(0));
+            }
+        }
+    }
+}
+
+bool runtime::cpu::pass::BiDirectionalRNNFusion::run_on_function(std::shared_ptr<Function> f)
+{
+    // Candidates are Rnns over a concatenation of timesteps, as built by RNNFusion
+    std::vector<std::shared_ptr<op::Rnn>> rnns;
+    for (auto n : f->get_ordered_ops())
+    {
+        auto rnn = std::dynamic_pointer_cast<op::Rnn>(n);
+        if (rnn && rnn->get_direction() == 1 && rnn->get_num_fused_layers() == 1 &&
+            !rnn->has_sequence_lengths() && rnn->get_num_timesteps() > 1 &&
+            rnn->get_input_element_type(0) == element::f32)
+        {
+            auto src_layer = std::dynamic_pointer_cast<op::Concat>(rnn->get_argument(0));
+            if (src_layer && src_layer->get_concatenation_axis() == 0 &&
+                src_layer->get_input_size() == rnn->get_num_timesteps())
+            {
+                rnns.push_back(rnn);
+            }
+        }
+    }
+
+    bool replaced = false;
+    std::unordered_set<std::shared_ptr<Node>> fused;
+    for (size_t i = 0; i < rnns.size(); i++)
+    {
+        for (size_t j = i + 1; j < rnns.size() && !fused.count(rnns[i]); j++)
+        {
+            if (fused.count(rnns[j]) || !is_reversed_rnn_pair(rnns[i], rnns[j]))
+            {
+                continue;
+            }
+            NGRAPH_DEBUG << "Fusing " << rnns[i]->get_name() << " and " << rnns[j]->get_name()
+                         << " into a bidirectional Rnn";
+
+            // Weights, bias and states of the right to left direction follow those of the
+            // left to right one
+            std::vector<std::shared_ptr<op::Rnn>> directions{rnns[i], rnns[j]};
+            auto concat_inputs = [&](size_t index) -> std::shared_ptr<Node> {
+                return std::make_shared<op::Concat>(
+                    NodeVector{directions[0]->get_argument(index),
+                               directions[1]->get_argument(index)},
+                    0);
+            };
+            const size_t num_timesteps = rnns[i]->get_num_timesteps();
+            const size_t num_cell_states = rnns[i]->get_num_cell_states();
+            const size_t batch_size = rnns[i]->get_batch_size();
+            const size_t feature_size = rnns[i]->get_src_iter_feature_size();
+            auto birnn = std::make_shared<op::Rnn>(rnns[i]->get_argument(0),
+                                                   concat_inputs(1),
+                                                   concat_inputs(2),
+                                                   concat_inputs(3),
+                                                   concat_inputs(4),
+                                                   num_timesteps,
+                                                   rnns[i]->get_gates_per_cell(),
+                                                   rnns[i]->get_src_sequence_length(),
+                                                   num_cell_states,
+                                                   2,
+                                                   1);
+            auto birnn_goe0 = std::make_shared<op::GetOutputElement>(birnn, 0);
+            auto birnn_goe1 = std::make_shared<op::GetOutputElement>(birnn, 1);
+
+            for (size_t direction = 0; direction < 2; direction++)
+            {
+                auto goes = op::get_output_elements(directions[direction]);
+                if (goes[0])
+                {
+                    replace_rnn_dst_layer(goes[0],
+                                          birnn_goe0,
+                                          direction,
+                                          num_timesteps,
+                                          batch_size,
+                                          feature_size);
+                }
+                if (goes[1])
+                {
+                    // dst_iter of the bidirectional Rnn holds the states of both directions
+                    size_t rows = num_cell_states * batch_size;
+                    auto states = std::make_shared<op::Slice>(
+                        birnn_goe1,
+                        Coordinate{direction * rows, 0},
+                        Coordinate{(direction + 1) * rows, feature_size});
+                    replace_collapse_node_user(goes[1], states->get_outputs().at(0));
+                }
+            }
+            fused.insert(rnns[i]);
+            fused.insert(rnns[j]);
+            replaced = true;
+        }
+    }
+    return replaced;
+}
+
 static std::shared_ptr<Node> stack_rnn_inputs(NodeVector rnn_input_nodes)
 {
     std::reverse(rnn_input_nodes.begin(), rnn_input_nodes.end());
@@ -631,6 +1282,12 @@ void ngraph::runtime::cpu::pass::MultiLayerRNNFusion::construct_multi_layer_rnn_
         size_t rnn_direction = rnn_nodes[0]->get_direction();
         size_t num_fused_rnn_layers = rnn_nodes.size();
 
+        if (rnn_direction != 1)
+        {
+            NGRAPH_DEBUG << "Only left to right RNN layers are stacked";
+            return false;
+        }
+
         for (auto rnn_node : rnn_nodes)
         {
             if ((rnn_node->get_num_timesteps() != num_timesteps) ||
@@ -701,10 +1358,10 @@ void ngraph::runtime::cpu::pass::MultiLayerRNNFusion::construct_multi_layer_rnn_
             // multi layerd fused rnn second output {GOE1} holds the recurrent output state tensors for the last cell
             // of all the layers, {{ht_1 | ct_1} || {ht2 |ct2} || ....{htn | ctn}}
             // we will slice the cell state output tensor {ct_*} from the fused RNN kerenel output and feeds
-            // {ct_*} consumer if any
+            // {ct_*} consumer if any. The last state of single state cells is {ht_*}.
             auto ct_slice = std::make_shared<op::Slice>(
                 mrnn_ht_ct,
-                Coordinate{((layer - 1) * batch_size * num_rnn_cell_states) + batch_size, 0},
+                Coordinate{layer * batch_size * num_rnn_cell_states - batch_size, 0},
                 Coordinate{layer * batch_size * num_rnn_cell_states, src_iter_feature_size});
 
             replace_collapse_node_user(rnn_ct_goe1, ct_slice->get_outputs().at(0));
@@ -751,3 +1408,131 @@ void ngraph::runtime::cpu::pass::MultiLayerRNNFusion::construct_multi_layer_rnn_
         rnn_goe0_label, rnn_src_layer, empty_correlated_matches, callback);
     this->add_matcher(m);
 }
+
+// Returns the i32 lengths `mask` is computed from, if it is zero wherever `step` is past the end
+// of a sequence, i.e. Convert(Greater(Broadcast(lengths), c)) with c >= step, or
+// Convert(Equal(Broadcast(lengths), c)) with c > step, where c may also be broadcast
+static std::shared_ptr<Node> get_mask_lengths(const std::shared_ptr<Node>& mask, size_t step)
+{
+    if (!std::dynamic_pointer_cast<op::Convert>(mask))
+    {
+        return nullptr;
+    }
+    auto compare = mask->get_argument(0);
+    bool greater = std::dynamic_pointer_cast<op::Greater>(compare) != nullptr;
+    if (!greater && !std::dynamic_pointer_cast<op::Equal>(compare))
+    {
+        return nullptr;
+    }
+    auto broadcast = std::dynamic_pointer_cast<op::Broadcast>(compare->get_argument(0));
+    auto steps_arg = compare->get_argument(1);
+    if (std::dynamic_pointer_cast<op::Broadcast>(steps_arg))
+    {
+        steps_arg = steps_arg->get_argument(0);
+    }
+    auto steps = std::dynamic_pointer_cast<op::Constant>(steps_arg);
+    if (!broadcast || broadcast->get_broadcast_axes() != AxisSet{1} || !steps ||
+        steps->get_element_type() != element::i32)
+    {
+        return nullptr;
+    }
+    auto lengths = broadcast->get_argument(0);
+    if (lengths->get_element_type() != element::i32 || lengths->get_shape().size() != 1)
+    {
+        return nullptr;
+    }
+    for (int32_t c : steps->get_vector<int32_t>())
+    {
+        if (c < 0 || (greater ? static_cast<size_t>(c) < step : static_cast<size_t>(c) <= step))
+        {
+            return nullptr;
+        }
+    }
+    return lengths;
+}
+
+// Returns the lengths of the sequences of `rnn`, if each output row of a timestep is only used
+// multiplied by a mask of its sequence
+static std::shared_ptr<Node> get_rnn_sequence_lengths(const std::shared_ptr<op::Rnn>& rnn)
+{
+    const size_t batch_size = rnn->get_batch_size();
+    std::shared_ptr<Node> lengths;
+    for (auto user : rnn->get_users())
+    {
+        auto goe = std::dynamic_pointer_cast<op::GetOutputElement>(user);
+        if (!goe || !is_used(goe.get()))
+        {
+            continue;
+        }
+        // The final states would be those of the last timestep, not of the end of a sequence
+        if (goe->get_n() != 0)
+        {
+            return nullptr;
+        }
+        for (auto goe_user : goe->get_users())
+        {
+            if (!is_used(goe_user.get()))
+            {
+                continue;
+            }
+            auto slice = std::dynamic_pointer_cast<op::Slice>(goe_user);
+            if (!slice || slice->get_lower_bounds()[0] % batch_size != 0 ||
+                slice->get_upper_bounds()[0] != slice->get_lower_bounds()[0] + batch_size ||
+                slice->get_strides() != Strides{1, 1})
+            {
+                return nullptr;
+            }
+            const size_t step = slice->get_lower_bounds()[0] / batch_size;
+            for (auto slice_user : slice->get_users())
+            {
+                if (!is_used(slice_user.get()))
+                {
+                    continue;
+                }
+                if (!std::dynamic_pointer_cast<op::Multiply>(slice_user))
+                {
+                    return nullptr;
+                }
+                auto mask = slice_user->get_argument(0) == slice ? slice_user->get_argument(1)
+                                                                 : slice_user->get_argument(0);
+                auto mask_lengths = get_mask_lengths(mask, step);
+                if (!mask_lengths || (lengths && mask_lengths != lengths))
+                {
+                    return nullptr;
+                }
+                lengths = mask_lengths;
+            }
+        }
+    }
+    if (lengths && lengths->get_shape() != Shape{batch_size})
+    {
+        return nullptr;
+    }
+    return lengths;
+}
+
+bool runtime::cpu::pass::RNNSequenceLengthFusion::run_on_function(std::shared_ptr<Function> f)
+{
+    bool replaced = false;
+    for (auto n : f->get_ordered_ops())
+    {
+        auto rnn = std::dynamic_pointer_cast<op::Rnn>(n);
+        if (!rnn || rnn->get_direction() != 1 || rnn->has_sequence_lengths() ||
+            rnn->get_input_element_type(0) != element::f32)
+        {
+            continue;
+        }
+        auto lengths = get_rnn_sequence_lengths(rnn);
+        if (!lengths)
+        {
+            continue;
+        }
+        NGRAPH_DEBUG << "Giving " << rnn->get_name() << " the sequence lengths "
+                     << lengths->get_name();
+        auto new_args = rnn->get_arguments();
+        new_args.push_back(lengths);
+        replace_node(rnn, rnn->copy_with_new_args(new_args));
+        replaced = true;
+    }
+    return replaced;
+}
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "ngraph/pass/graph_rewrite.hpp"
+#include "ngraph/pass/pass.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 
 namespace ngraph
@@ -28,8 +29,11 @@ namespace ngraph
             namespace pass
             {
                 class LSTMFusion;
+                class RNNCellFusion;
                 class RNNFusion;
+                class BiDirectionalRNNFusion;
                 class MultiLayerRNNFusion;
+                class RNNSequenceLengthFusion;
             }
         }
     }
@@ -50,6 +54,23 @@ private:
     void construct_lstm_fprop();
 };
 
+// Fuses GRU and vanilla RNN cells into single timestep Rnn ops, which RNNFusion then
+// combines across timesteps
+class ngraph::runtime::cpu::pass::RNNCellFusion : public ngraph::pass::GraphRewrite
+{
+public:
+    RNNCellFusion()
+        : GraphRewrite()
+    {
+        construct_gru_fprop();
+        construct_vanilla_rnn_fprop();
+    }
+
+private:
+    void construct_gru_fprop();
+    void construct_vanilla_rnn_fprop();
+};
+
 class ngraph::runtime::cpu::pass::RNNFusion : public ngraph::pass::RecurrentGraphRewrite
 {
 public:
@@ -57,10 +78,22 @@ public:
         : RecurrentGraphRewrite()
     {
         construct_rnn_lstm_fprop();
+        construct_rnn_gru_fprop();
+        construct_rnn_vanilla_fprop();
     }
 
 private:
     void construct_rnn_lstm_fprop();
+    void construct_rnn_gru_fprop();
+    void construct_rnn_vanilla_fprop();
+};
+
+// Fuses two single layer Rnns that read the same input timesteps in opposite orders into one
+// bidirectional Rnn
+class ngraph::runtime::cpu::pass::BiDirectionalRNNFusion : public ngraph::pass::FunctionPass
+{
+public:
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 };
 
 class ngraph::runtime::cpu::pass::MultiLayerRNNFusion : public ngraph::pass::RecurrentGraphRewrite
@@ -75,3 +108,12 @@ public:
 private:
     void construct_multi_layer_rnn_fusion_fprop();
 };
+
+// Gives a left to right Rnn the lengths of its sequences when each of its outputs is only used
+// multiplied by a mask that is zero past the end of the sequence, so the steps past the end are
+// not computed
+class ngraph::runtime::cpu::pass::RNNSequenceLengthFusion : public ngraph::pass::FunctionPass
+{
+public:
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+};
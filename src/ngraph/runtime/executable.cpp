@@ -0,0 +1,124 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <sstream>
+
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::Executable::Executable(Backend* backend, const shared_ptr<Function>& function)
+    : m_backend(backend)
+    , m_function(function)
+    , m_inputs(function->get_parameters().size())
+    , m_outputs(function->get_output_size())
+    , m_prepared(false)
+{
+}
+
+runtime::Executable::~Executable()
+{
+}
+
+void runtime::Executable::bind_input(size_t index, const shared_ptr<Tensor>& tensor)
+{
+    if (index >= m_inputs.size())
+    {
+        stringstream ss;
+        ss << "Input index " << index << " out of range, Function has " << m_inputs.size()
+           << " Parameters";
+        throw runtime_error(ss.str());
+    }
+    const auto& parameter = m_function->get_parameters()[index];
+    if (parameter->get_element_type() != tensor->get_element_type())
+    {
+        stringstream ss;
+        ss << "Input " << index << " type '" << tensor->get_element_type()
+           << "' does not match Parameter type '" << parameter->get_element_type() << "'";
+        throw runtime_error(ss.str());
+    }
+    if (parameter->get_shape() != tensor->get_shape())
+    {
+        stringstream ss;
+        ss << "Input " << index << " shape {" << join(tensor->get_shape())
+           << "} does not match Parameter shape {" << join(parameter->get_shape()) << "}";
+        throw runtime_error(ss.str());
+    }
+    m_inputs[index] = tensor;
+    m_prepared = false;
+}
+
+void runtime::Executable::bind_output(size_t index, const shared_ptr<Tensor>& tensor)
+{
+    if (index >= m_outputs.size())
+    {
+        stringstream ss;
+        ss << "Output index " << index << " out of range, Function has " << m_outputs.size()
+           << " Results";
+        throw runtime_error(ss.str());
+    }
+    if (m_function->get_output_element_type(index) != tensor->get_element_type())
+    {
+        stringstream ss;
+        ss << "Output " << index << " type '" << tensor->get_element_type()
+           << "' does not match Result type '" << m_function->get_output_element_type(index)
+           << "'";
+        throw runtime_error(ss.str());
+    }
+    if (m_function->get_output_shape(index) != tensor->get_shape())
+    {
+        stringstream ss;
+        ss << "Output " << index << " shape {" << join(tensor->get_shape())
+           << "} does not match Result shape {" << join(m_function->get_output_shape(index))
+           << "}";
+        throw runtime_error(ss.str());
+    }
+    m_outputs[index] = tensor;
+    m_prepared = false;
+}
+
+void runtime::Executable::run()
+{
+    if (!m_prepared)
+    {
+        for (size_t i = 0; i < m_inputs.size(); i++)
+        {
+            if (m_inputs[i] == nullptr)
+            {
+                throw runtime_error("Input " + to_string(i) + " is not bound");
+            }
+        }
+        for (size_t i = 0; i < m_outputs.size(); i++)
+        {
+            if (m_outputs[i] == nullptr)
+            {
+                throw runtime_error("Output " + to_string(i) + " is not bound");
+            }
+        }
+        prepare();
+        m_prepared = true;
+    }
+    execute();
+}
+
+void runtime::Executable::execute()
+{
+    m_backend->call(m_function, m_outputs, m_inputs);
+}
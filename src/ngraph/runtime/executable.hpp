@@ -0,0 +1,78 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ngraph/function.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class Backend;
+        class Executable;
+        class Tensor;
+    }
+}
+
+/// \brief A compiled Function together with the tensors it reads and writes.
+///
+/// Inputs and outputs are bound once, and validated against the Function when they are bound.
+/// Every run() then executes on the bound tensors, reading the current contents of the inputs
+/// and writing the outputs in place, without per-call argument containers or checks. Create
+/// one with Backend::create_executable. The backend must outlive its executables.
+class ngraph::runtime::Executable
+{
+public:
+    Executable(Backend* backend, const std::shared_ptr<Function>& function);
+    virtual ~Executable();
+
+    /// \brief Bind the tensor read for the Function's parameter `index`
+    /// \param index Parameter index
+    /// \param tensor Tensor with the parameter's element type and shape
+    void bind_input(size_t index, const std::shared_ptr<Tensor>& tensor);
+
+    /// \brief Bind the tensor written for the Function's result `index`
+    /// \param index Result index
+    /// \param tensor Tensor with the result's element type and shape
+    void bind_output(size_t index, const std::shared_ptr<Tensor>& tensor);
+
+    /// \brief Execute the Function on the bound tensors. Throws if any parameter or result
+    ///     has not been bound.
+    void run();
+
+    const std::shared_ptr<Function>& get_function() const { return m_function; }
+protected:
+    /// \brief Called by run() on the first run after bindings changed, once every input and
+    ///     output is bound. Backends do their one-time setup for the bound tensors here.
+    virtual void prepare() {}
+    /// \brief Execute the Function on m_inputs and m_outputs.
+    virtual void execute();
+
+    Backend* m_backend;
+    std::shared_ptr<Function> m_function;
+    std::vector<std::shared_ptr<Tensor>> m_inputs;
+    std::vector<std::shared_ptr<Tensor>> m_outputs;
+
+private:
+    Executable(const Executable&) = delete;
+    Executable& operator=(const Executable&) = delete;
+
+    bool m_prepared;
+};
@@ -227,6 +227,8 @@ bool runtime::gpu::GPU_Backend::is_supported(const Node& op) const
 {
     set<string> unsupported_ops = {"Quantize",
                                    "Dequantize",
+                                   "QuantizedDot",
+                                   "QuantizedDotBias",
                                    "ShapeOf",
                                    "All",
                                    "Any",
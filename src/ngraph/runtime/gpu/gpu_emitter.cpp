@@ -58,6 +58,7 @@
 #include "ngraph/op/equal.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/experimental/generate_mask.hpp"
+#include "ngraph/op/experimental/quantized_dot.hpp"
 #include "ngraph/op/experimental/shape_of.hpp"
 #include "ngraph/op/floor.hpp"
 #include "ngraph/op/function_call.hpp"
@@ -994,6 +995,16 @@ void runtime::gpu::GPU_Emitter::emit_Quantize(EMIT_ARGS)
     throw unsupported_op("Unsupported op '" + node->description() + "'");
 }
 
+void runtime::gpu::GPU_Emitter::emit_QuantizedDot(EMIT_ARGS)
+{
+    throw unsupported_op("Unsupported op '" + node->description() + "'");
+}
+
+void runtime::gpu::GPU_Emitter::emit_QuantizedDotBias(EMIT_ARGS)
+{
+    throw unsupported_op("Unsupported op '" + node->description() + "'");
+}
+
 void runtime::gpu::GPU_Emitter::emit_Reduce(EMIT_ARGS)
 {
     const ngraph::op::Reduce* reduce_op = static_cast<const ngraph::op::Reduce*>(node);
@@ -80,6 +80,8 @@ public:
     /// \param n Number of bytes to read, must be integral number of elements.
     void read(void* p, size_t tensor_offset, size_t n) const override;
 
+    void* get_host_data_ptr() override { return get_data_ptr(); }
+
 private:
     HostTensor(const HostTensor&) = delete;
     HostTensor(HostTensor&&) = delete;
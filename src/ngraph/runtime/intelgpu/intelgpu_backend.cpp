@@ -1764,6 +1764,8 @@ runtime::Handle runtime::intelgpu::IntelGPUBackend::compile(shared_ptr<Function>
         case OP_TYPEID::FunctionCall:
         case OP_TYPEID::Dequantize:
         case OP_TYPEID::Quantize:
+        case OP_TYPEID::QuantizedDot:
+        case OP_TYPEID::QuantizedDotBias:
         case OP_TYPEID::ReduceWindow:
         case OP_TYPEID::ReplaceSlice:
         case OP_TYPEID::GenerateMask:
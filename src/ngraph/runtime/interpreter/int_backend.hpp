@@ -36,6 +36,7 @@
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/experimental/generate_mask.hpp"
+#include "ngraph/op/experimental/quantized_dot.hpp"
 #include "ngraph/op/experimental/shape_of.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/lrn.hpp"
@@ -113,6 +114,7 @@
 #include "ngraph/runtime/reference/power.hpp"
 #include "ngraph/runtime/reference/product.hpp"
 #include "ngraph/runtime/reference/quantize.hpp"
+#include "ngraph/runtime/reference/quantized_dot.hpp"
 #include "ngraph/runtime/reference/reduce.hpp"
 #include "ngraph/runtime/reference/reduce_window.hpp"
 #include "ngraph/runtime/reference/relu.hpp"
@@ -1052,6 +1054,34 @@ private:
 
             break;
         }
+        case OP_TYPEID::QuantizedDot:
+        {
+            const op::QuantizedDot* qdot = static_cast<const op::QuantizedDot*>(&node);
+            reference::quantized_dot<uint8_t, int8_t, T>(static_cast<const uint8_t*>(args[0]),
+                                                         static_cast<const int8_t*>(args[1]),
+                                                         nullptr,
+                                                         static_cast<const float*>(args[2]),
+                                                         static_cast<T*>(out[0]),
+                                                         node.get_input_shape(0),
+                                                         node.get_input_shape(1),
+                                                         qdot->get_requantize(),
+                                                         qdot->with_relu());
+            break;
+        }
+        case OP_TYPEID::QuantizedDotBias:
+        {
+            const op::QuantizedDotBias* qdot = static_cast<const op::QuantizedDotBias*>(&node);
+            reference::quantized_dot<uint8_t, int8_t, T>(static_cast<const uint8_t*>(args[0]),
+                                                         static_cast<const int8_t*>(args[1]),
+                                                         static_cast<const int32_t*>(args[2]),
+                                                         static_cast<const float*>(args[3]),
+                                                         static_cast<T*>(out[0]),
+                                                         node.get_input_shape(0),
+                                                         node.get_input_shape(1),
+                                                         qdot->get_requantize(),
+                                                         qdot->with_relu());
+            break;
+        }
         case OP_TYPEID::Reduce:
         {
             const op::Reduce* reduce = static_cast<const op::Reduce*>(&node);
@@ -0,0 +1,83 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "ngraph/shape.hpp"
+#include "ngraph/shape_util.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            // out[i, j] = requantize(sum_k arg0[i, k] * arg1[k, j] + bias[j])
+            // where arg0 has shape [..., K] and arg1 has shape [K, M]. bias may be null.
+            template <typename INPUT, typename FILTER, typename OUTPUT>
+            void quantized_dot(const INPUT* arg0,
+                               const FILTER* arg1,
+                               const int32_t* bias,
+                               const float* scale,
+                               OUTPUT* out,
+                               const Shape& arg0_shape,
+                               const Shape& arg1_shape,
+                               bool requantize,
+                               bool with_relu)
+            {
+                size_t k_size = arg1_shape.at(0);
+                size_t m_size = arg1_shape.at(1);
+                size_t rows = shape_size(arg0_shape) / std::max<size_t>(k_size, 1);
+
+                for (size_t i = 0; i < rows; i++)
+                {
+                    for (size_t j = 0; j < m_size; j++)
+                    {
+                        int32_t acc = bias ? bias[j] : 0;
+                        for (size_t k = 0; k < k_size; k++)
+                        {
+                            acc += static_cast<int32_t>(arg0[i * k_size + k]) *
+                                   static_cast<int32_t>(arg1[k * m_size + j]);
+                        }
+
+                        if (with_relu)
+                        {
+                            acc = std::max(acc, 0);
+                        }
+                        if (!requantize)
+                        {
+                            out[i * m_size + j] = static_cast<OUTPUT>(acc);
+                            continue;
+                        }
+
+                        // nearbyint rounds half to even in the default rounding mode
+                        float value = std::nearbyint(static_cast<float>(acc) * scale[0]);
+                        value = std::max(value,
+                                         static_cast<float>(std::numeric_limits<OUTPUT>::lowest()));
+                        value =
+                            std::min(value, static_cast<float>(std::numeric_limits<OUTPUT>::max()));
+                        out[i * m_size + j] = static_cast<OUTPUT>(value);
+                    }
+                }
+            }
+        }
+    }
+}
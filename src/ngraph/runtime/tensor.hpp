@@ -103,6 +103,12 @@ namespace ngraph
             /// \param n Number of bytes to read, must be integral number of elements.
             virtual void read(void* p, size_t offset, size_t n) const = 0;
 
+            /// \brief Get the host memory holding the tensor data, for reading or writing it
+            ///     without a copy.
+            /// \return pointer to the data in row-major order, or nullptr if the tensor is not
+            ///     held in host memory in that layout
+            virtual void* get_host_data_ptr() { return nullptr; }
+
             /// \brief copy bytes directly from source to this tensor
             /// \param source The source tensor
             virtual void copy_from(const ngraph::runtime::Tensor& source);
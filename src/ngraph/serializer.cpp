@@ -48,6 +48,7 @@
 #include "ngraph/op/equal.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/experimental/generate_mask.hpp"
+#include "ngraph/op/experimental/quantized_dot.hpp"
 #include "ngraph/op/experimental/shape_of.hpp"
 #include "ngraph/op/floor.hpp"
 #include "ngraph/op/function_call.hpp"
@@ -968,6 +969,22 @@ static shared_ptr<ngraph::Function>
                 node = make_shared<op::Quantize>(args[0], args[1], args[2], type, axes, round_mode);
                 break;
             }
+            case OP_TYPEID::QuantizedDot:
+            {
+                auto requantize = node_js.at("requantize").get<bool>();
+                auto with_relu = node_js.at("with_relu").get<bool>();
+                node = make_shared<op::QuantizedDot>(
+                    args[0], args[1], args[2], requantize, with_relu);
+                break;
+            }
+            case OP_TYPEID::QuantizedDotBias:
+            {
+                auto requantize = node_js.at("requantize").get<bool>();
+                auto with_relu = node_js.at("with_relu").get<bool>();
+                node = make_shared<op::QuantizedDotBias>(
+                    args[0], args[1], args[2], args[3], requantize, with_relu);
+                break;
+            }
             case OP_TYPEID::Reduce:
             {
                 auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
@@ -1562,6 +1579,20 @@ static json write(const Node& n, bool binary_constant_data)
         node["round_mode"] = tmp->get_round_mode();
         break;
     }
+    case OP_TYPEID::QuantizedDot:
+    {
+        auto tmp = dynamic_cast<const op::QuantizedDot*>(&n);
+        node["requantize"] = tmp->get_requantize();
+        node["with_relu"] = tmp->with_relu();
+        break;
+    }
+    case OP_TYPEID::QuantizedDotBias:
+    {
+        auto tmp = dynamic_cast<const op::QuantizedDotBias*>(&n);
+        node["requantize"] = tmp->get_requantize();
+        node["with_relu"] = tmp->with_relu();
+        break;
+    }
     case OP_TYPEID::Reduce:
     {
         auto tmp = dynamic_cast<const op::Reduce*>(&n);
@@ -39,14 +39,6 @@
 using namespace std;
 using namespace ngraph;
 
-// A value represents NaN in bfloat16
-static const uint16_t BF16_NAN_VALUE = 0x7FC0;
-
-bool float_isnan(const float& x)
-{
-    return std::isnan(x);
-}
-
 std::vector<float> bfloat16::to_float_vector(const std::vector<bfloat16>& v_bf16)
 {
     std::vector<float> v_f32(v_bf16.begin(), v_bf16.end());
@@ -55,7 +47,8 @@ std::vector<float> bfloat16::to_float_vector(const std::vector<bfloat16>& v_bf16
 
 std::vector<bfloat16> bfloat16::from_float_vector(const std::vector<float>& v_f32)
 {
-    std::vector<bfloat16> v_bf16(v_f32.size());
+    std::vector<bfloat16> v_bf16;
+    v_bf16.reserve(v_f32.size());
     for (float a : v_f32)
     {
         v_bf16.push_back(static_cast<bfloat16>(a));
@@ -63,33 +56,6 @@ std::vector<bfloat16> bfloat16::from_float_vector(const std::vector<float>& v_f3
     return v_bf16;
 }
 
-bfloat16::bfloat16(float value, bool rounding)
-{
-    if (float_isnan(value))
-    {
-        m_value = BF16_NAN_VALUE;
-    }
-    else if (!rounding)
-    {
-        // Truncate off 16 LSB, no rounding
-        // Treat system as little endian (Intel x86 family)
-        uint16_t* u16_ptr = reinterpret_cast<uint16_t*>(&value);
-        m_value = u16_ptr[1];
-    }
-    else
-    {
-        // Rounding with round-nearest-to-even to create bfloat16
-        // from float. Refer to TF implementation explanation:
-        // https://github.com/tensorflow/tensorflow/blob/d354efc/tensorflow/core/lib/bfloat16/bfloat16.h#L199
-        uint32_t* u32_ptr = reinterpret_cast<uint32_t*>(&value);
-        uint32_t u32_value = *u32_ptr;
-        uint32_t lsb = (u32_value >> 16) & 1;
-        uint32_t rounding_bias = 0x7fff + lsb;
-        u32_value += rounding_bias;
-        m_value = static_cast<uint16_t>(u32_value >> 16);
-    }
-}
-
 std::string bfloat16::to_string() const
 {
     return std::to_string(static_cast<float>(*this));
@@ -128,22 +94,7 @@ bool bfloat16::operator>=(const bfloat16& other) const
     return (static_cast<float>(*this) >= static_cast<float>(other));
 }
 
-bfloat16::operator float() const
-{
-    // float result = 0;
-    // uint16_t* u16_ptr = reinterpret_cast<uint16_t*>(&result);
-
-    // // Treat the system as little endian (Intel x86 family)
-    // u16_ptr[1] = m_value;
-    return static_cast<float>(static_cast<uint32_t>(m_value) << 16);
-}
-
-bfloat16::operator double() const
-{
-    return static_cast<float>(m_value);
-}
-
-std::ostream& operator<<(std::ostream& out, const bfloat16& obj)
+std::ostream& ngraph::operator<<(std::ostream& out, const bfloat16& obj)
 {
     return (out << static_cast<float>(obj));
 }
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -27,14 +29,20 @@
 
 namespace ngraph
 {
+    /// \brief 16-bit brain floating point: the upper half of an IEEE f32.
+    ///
+    ///        The class holds nothing but the 16 bits so arrays of it can be used directly as
+    ///        tensor storage. Conversions are inline since kernels apply them per element.
     class bfloat16
     {
     public:
         bfloat16() {}
-        bfloat16(float value, bool rounding = false);
+        bfloat16(float value, bool rounding = false)
+            : m_value(rounding ? round_to_nearest_even(value) : truncate(value))
+        {
+        }
         bfloat16(const bfloat16&) = default;
         bfloat16& operator=(const bfloat16&) = default;
-        virtual ~bfloat16() {}
         std::string to_string() const;
         size_t size() const;
         bool operator==(const bfloat16& other) const;
@@ -43,8 +51,21 @@ namespace ngraph
         bool operator<=(const bfloat16& other) const;
         bool operator>(const bfloat16& other) const;
         bool operator>=(const bfloat16& other) const;
-        operator float() const;
-        operator double() const;
+        operator float() const
+        {
+            uint32_t bits = static_cast<uint32_t>(m_value) << 16;
+            float result;
+            std::memcpy(&result, &bits, sizeof(result));
+            return result;
+        }
+        operator double() const { return static_cast<float>(*this); }
+        uint16_t to_bits() const { return m_value; }
+        static bfloat16 from_bits(uint16_t bits)
+        {
+            bfloat16 result;
+            result.m_value = bits;
+            return result;
+        }
 
         static std::vector<float> to_float_vector(const std::vector<bfloat16>&);
         static std::vector<bfloat16> from_float_vector(const std::vector<float>&);
@@ -52,6 +73,37 @@ namespace ngraph
         friend std::ostream& operator<<(std::ostream&, const bfloat16&);
 
     private:
+        static uint16_t truncate(float value)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            // Keep NaN a NaN even if its payload is only in the low bits
+            if ((bits & 0x7fffffff) > 0x7f800000)
+            {
+                return BF16_NAN_VALUE;
+            }
+            return static_cast<uint16_t>(bits >> 16);
+        }
+
+        // Refer to the TensorFlow implementation for an explanation:
+        // https://github.com/tensorflow/tensorflow/blob/d354efc/tensorflow/core/lib/bfloat16/bfloat16.h#L199
+        static uint16_t round_to_nearest_even(float value)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            if ((bits & 0x7fffffff) > 0x7f800000)
+            {
+                return BF16_NAN_VALUE;
+            }
+            uint32_t lsb = (bits >> 16) & 1;
+            uint32_t rounding_bias = 0x7fff + lsb;
+            return static_cast<uint16_t>((bits + rounding_bias) >> 16);
+        }
+
+        static const uint16_t BF16_NAN_VALUE = 0x7FC0;
+
         uint16_t m_value{0};
     };
+
+    std::ostream& operator<<(std::ostream&, const bfloat16&);
 }
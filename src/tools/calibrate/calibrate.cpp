@@ -0,0 +1,298 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// tool to calibrate an f32 ngraph json model and write out an int8 version of it.
+// Sample data is read from raw files, one per parameter, each holding any number of
+// samples back to back. Without data files uniform random samples in [0, 1) are used.
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <random>
+
+#include "ngraph/except.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/quantization/calibration.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/serializer.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+using TensorVector = vector<shared_ptr<runtime::Tensor>>;
+
+vector<TensorVector> load_samples(shared_ptr<runtime::Backend> backend,
+                                  shared_ptr<Function> f,
+                                  const vector<string>& data_files,
+                                  size_t sample_count)
+{
+    const ParameterVector& parameters = f->get_parameters();
+    vector<vector<char>> data;
+    if (!data_files.empty())
+    {
+        if (data_files.size() != parameters.size())
+        {
+            throw runtime_error("One data file is needed per parameter");
+        }
+        for (size_t i = 0; i < data_files.size(); i++)
+        {
+            data.push_back(file_util::read_file_contents(data_files[i]));
+            size_t sample_bytes = shape_size(parameters[i]->get_shape()) *
+                                  parameters[i]->get_element_type().size();
+            sample_count = min(sample_count, data.back().size() / sample_bytes);
+        }
+    }
+
+    default_random_engine engine;
+    uniform_real_distribution<float> dist(0.0f, 1.0f);
+    vector<TensorVector> samples;
+    for (size_t s = 0; s < sample_count; s++)
+    {
+        TensorVector inputs;
+        for (size_t i = 0; i < parameters.size(); i++)
+        {
+            auto& param = parameters[i];
+            auto tensor = backend->create_tensor(param->get_element_type(), param->get_shape());
+            size_t bytes = shape_size(param->get_shape()) * param->get_element_type().size();
+            if (!data.empty())
+            {
+                tensor->write(data[i].data() + s * bytes, 0, bytes);
+            }
+            else if (param->get_element_type() == element::f32)
+            {
+                vector<float> values(shape_size(param->get_shape()));
+                generate(values.begin(), values.end(), [&]() { return dist(engine); });
+                tensor->write(values.data(), 0, bytes);
+            }
+            else
+            {
+                throw runtime_error("Random samples are only generated for f32 parameters");
+            }
+            inputs.push_back(tensor);
+        }
+        samples.push_back(inputs);
+    }
+    return samples;
+}
+
+TensorVector create_outputs(shared_ptr<runtime::Backend> backend, shared_ptr<Function> f)
+{
+    TensorVector outputs;
+    for (const shared_ptr<op::Result>& result : f->get_results())
+    {
+        outputs.push_back(backend->create_tensor(result->get_element_type(), result->get_shape()));
+    }
+    return outputs;
+}
+
+vector<float> read_f32(shared_ptr<runtime::Tensor> tensor)
+{
+    vector<float> values(tensor->get_element_count());
+    tensor->read(values.data(), 0, values.size() * sizeof(float));
+    return values;
+}
+
+size_t time_function(shared_ptr<runtime::Backend> backend,
+                     shared_ptr<Function> f,
+                     const TensorVector& inputs,
+                     size_t iterations)
+{
+    TensorVector outputs = create_outputs(backend, f);
+    // first call compiles
+    backend->call_with_validate(f, outputs, inputs);
+    stopwatch timer;
+    timer.start();
+    for (size_t i = 0; i < iterations; i++)
+    {
+        backend->call(f, outputs, inputs);
+    }
+    timer.stop();
+    return timer.get_microseconds() / max<size_t>(iterations, 1);
+}
+
+int main(int argc, char** argv)
+{
+    string model;
+    string output;
+    string backend_name = "CPU";
+    vector<string> data_files;
+    size_t sample_count = 16;
+    size_t iterations = 10;
+    quantization::CalibrationMode mode = quantization::CalibrationMode::MIN_MAX;
+    float percentile = 99.99f;
+    bool failed = false;
+    for (size_t i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        try
+        {
+            if (arg == "-f" || arg == "--file")
+            {
+                model = argv[++i];
+            }
+            else if (arg == "-o" || arg == "--output")
+            {
+                output = argv[++i];
+            }
+            else if (arg == "-b" || arg == "--backend")
+            {
+                backend_name = argv[++i];
+            }
+            else if (arg == "-d" || arg == "--data")
+            {
+                data_files.push_back(argv[++i]);
+            }
+            else if (arg == "-n" || arg == "--samples")
+            {
+                sample_count = stoi(argv[++i]);
+            }
+            else if (arg == "-i" || arg == "--iterations")
+            {
+                iterations = stoi(argv[++i]);
+            }
+            else if (arg == "-p" || arg == "--percentile")
+            {
+                mode = quantization::CalibrationMode::PERCENTILE;
+                percentile = stof(argv[++i]);
+            }
+            else
+            {
+                cout << "Unknown option: " << arg << endl;
+                failed = true;
+            }
+        }
+        catch (...)
+        {
+            cout << "Invalid Argument\n";
+            failed = true;
+        }
+    }
+    if (model.empty())
+    {
+        cout << "Model file must be specified\n";
+        failed = true;
+    }
+    else if (!file_util::exists(model))
+    {
+        cout << "File " << model << " not found\n";
+        failed = true;
+    }
+
+    if (failed)
+    {
+        cout << R"###(
+DESCRIPTION
+    Calibrate an f32 ngraph json model and write out a quantized version of it.
+    Convolution and Dot nodes with constant weights are replaced with int8 ops
+    using ranges observed over the samples, and the result is compared with the
+    original model for accuracy and speed.
+
+SYNOPSIS
+        calibrate -f <filename> [-o <filename>] [-d <data file> ...] [-n <samples>]
+
+OPTIONS
+        -f|--file                 Serialized f32 model file
+        -o|--output               Quantized model file (default: <model>.int8.json)
+        -b|--backend              Backend to calibrate and compare on (default: CPU)
+        -d|--data                 Raw sample data for the next parameter, repeat per parameter
+        -n|--samples              Maximum number of samples to use (default: 16)
+        -i|--iterations           Timing iterations (default: 10)
+        -p|--percentile           Clip ranges at this percentile instead of using min/max
+)###";
+        return 1;
+    }
+    if (output.empty())
+    {
+        output = model.substr(0, model.rfind(".json")) + ".int8.json";
+    }
+
+    try
+    {
+        shared_ptr<Function> f = deserialize(model);
+        shared_ptr<runtime::Backend> backend = runtime::Backend::create(backend_name);
+        vector<TensorVector> samples = load_samples(backend, f, data_files, sample_count);
+        if (samples.empty())
+        {
+            throw runtime_error("No samples available for calibration");
+        }
+
+        quantization::Calibrator calibrator(f, backend_name, mode, percentile);
+        for (const TensorVector& sample : samples)
+        {
+            calibrator.add_sample(sample);
+        }
+        shared_ptr<Function> qf = calibrator.quantize();
+        serialize(output, qf);
+
+        cout << "Calibrated over " << samples.size() << " samples, "
+             << calibrator.get_statistics().size() << " tensors observed\n";
+        cout << "Quantized model written to " << output << "\n";
+
+        cout << "\n---- Accuracy (max abs error / max abs f32 value) ----\n";
+        TensorVector f_outputs = create_outputs(backend, f);
+        TensorVector q_outputs = create_outputs(backend, qf);
+        vector<float> max_error(f_outputs.size(), 0);
+        vector<float> max_value(f_outputs.size(), 0);
+        for (const TensorVector& sample : samples)
+        {
+            backend->call_with_validate(f, f_outputs, sample);
+            backend->call_with_validate(qf, q_outputs, sample);
+            for (size_t i = 0; i < f_outputs.size(); i++)
+            {
+                if (f_outputs[i]->get_element_type() != element::f32)
+                {
+                    continue;
+                }
+                vector<float> expected = read_f32(f_outputs[i]);
+                vector<float> actual = read_f32(q_outputs[i]);
+                for (size_t j = 0; j < expected.size(); j++)
+                {
+                    max_error[i] = max(max_error[i], fabs(expected[j] - actual[j]));
+                    max_value[i] = max(max_value[i], fabs(expected[j]));
+                }
+            }
+        }
+        for (size_t i = 0; i < f_outputs.size(); i++)
+        {
+            cout << f->get_results()[i]->get_argument(0)->get_name() << ": " << max_error[i]
+                 << " / " << max_value[i] << "\n";
+        }
+
+        cout << "\n---- Speed (average per iteration) ----\n";
+        size_t f_time = time_function(backend, f, samples[0], iterations);
+        size_t q_time = time_function(backend, qf, samples[0], iterations);
+        cout << "f32:       " << f_time << "us\n";
+        cout << "quantized: " << q_time << "us\n";
+        if (q_time > 0)
+        {
+            cout << "speedup:   " << fixed << setprecision(2)
+                 << static_cast<double>(f_time) / q_time << "x\n";
+        }
+    }
+    catch (ngraph::unsupported_op& ue)
+    {
+        cout << "Unsupported op '" << ue.what() << "' in model " << model << endl;
+        return 1;
+    }
+    catch (exception& e)
+    {
+        cout << "Exception caught on '" << model << "'\n" << e.what() << endl;
+        return 1;
+    }
+    return 0;
+}
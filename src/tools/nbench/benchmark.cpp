@@ -14,11 +14,23 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <iomanip>
+#include <mutex>
 #include <random>
+#include <thread>
 #include <xmmintrin.h>
 
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
+
 #include "benchmark.hpp"
 #include "ngraph/file_util.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/tensor.hpp"
@@ -157,102 +169,373 @@ static void random_init(shared_ptr<runtime::Tensor> tv)
     }
 }
 
-vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
-                                                  const string& backend_name,
-                                                  size_t iterations,
-                                                  bool timing_detail,
-                                                  int warmup_iterations,
-                                                  bool copy_data)
+// Input and result tensors of one caller of a compiled Function, with host copies of their
+// contents
+struct BenchmarkTensors
 {
-    stopwatch timer;
-    timer.start();
-    auto backend = runtime::Backend::create(backend_name);
-    backend->enable_performance_data(f, timing_detail);
-    auto compiled_func = backend->compile(f);
-    timer.stop();
-    cout.imbue(locale(""));
-    cout << "compile time: " << timer.get_milliseconds() << "ms" << endl;
-
     vector<shared_ptr<runtime::HostTensor>> arg_data;
     vector<shared_ptr<runtime::Tensor>> args;
-    vector<bool> args_cacheable;
+    vector<shared_ptr<runtime::HostTensor>> result_data;
+    vector<shared_ptr<runtime::Tensor>> results;
+};
+
+static BenchmarkTensors make_tensors(runtime::Backend& backend, shared_ptr<Function> f)
+{
+    BenchmarkTensors tensors;
     for (shared_ptr<op::Parameter> param : f->get_parameters())
     {
-        auto tensor = backend->create_tensor(param->get_element_type(), param->get_shape());
+        auto tensor = backend.create_tensor(param->get_element_type(), param->get_shape());
         auto tensor_data =
             make_shared<runtime::HostTensor>(param->get_element_type(), param->get_shape());
         random_init(tensor_data);
         tensor->write(tensor_data->get_data_ptr(),
                       0,
                       tensor_data->get_element_count() * tensor_data->get_element_type().size());
-        args.push_back(tensor);
-        arg_data.push_back(tensor_data);
-        args_cacheable.push_back(param->get_cacheable());
+        if (param->get_cacheable())
+        {
+            tensor->set_stale(false);
+        }
+        tensors.args.push_back(tensor);
+        tensors.arg_data.push_back(tensor_data);
     }
-    set_denormals_flush_to_zero();
 
-    vector<shared_ptr<runtime::HostTensor>> result_data;
-    vector<shared_ptr<runtime::Tensor>> results;
     for (shared_ptr<Node> out : f->get_results())
     {
-        auto result = backend->create_tensor(out->get_element_type(), out->get_shape());
+        auto result = backend.create_tensor(out->get_element_type(), out->get_shape());
         auto tensor_data =
             make_shared<runtime::HostTensor>(out->get_element_type(), out->get_shape());
-        results.push_back(result);
-        result_data.push_back(tensor_data);
+        tensors.results.push_back(result);
+        tensors.result_data.push_back(tensor_data);
     }
+    return tensors;
+}
 
-    for (size_t i = 0; i < args.size(); i++)
+// Runs one iteration the way a caller feeding fresh data would
+static void call_with_copies(runtime::Backend& backend,
+                             shared_ptr<Function> compiled_func,
+                             BenchmarkTensors& tensors,
+                             bool copy_data)
+{
+    if (copy_data)
     {
-        if (args_cacheable[i])
+        for (size_t arg_index = 0; arg_index < tensors.args.size(); arg_index++)
         {
-            args[i]->set_stale(false);
+            const shared_ptr<runtime::Tensor>& arg = tensors.args[arg_index];
+            if (arg->get_stale())
+            {
+                const shared_ptr<runtime::HostTensor>& data = tensors.arg_data[arg_index];
+                arg->write(data->get_data_ptr(),
+                           0,
+                           data->get_element_count() * data->get_element_type().size());
+            }
         }
     }
-
-    if (warmup_iterations)
+    backend.call(compiled_func, tensors.results, tensors.args);
+    if (copy_data)
     {
-        for (int i = 0; i < warmup_iterations; i++)
+        for (size_t result_index = 0; result_index < tensors.results.size(); result_index++)
         {
-            backend->call(compiled_func, results, args);
+            const shared_ptr<runtime::HostTensor>& data = tensors.result_data[result_index];
+            const shared_ptr<runtime::Tensor>& result = tensors.results[result_index];
+            result->read(data->get_data_ptr(),
+                         0,
+                         data->get_element_count() * data->get_element_type().size());
         }
     }
+}
+
+BenchmarkMeasurement measure_benchmark(shared_ptr<Function> f,
+                                       const string& backend_name,
+                                       size_t iterations,
+                                       bool timing_detail,
+                                       int warmup_iterations,
+                                       bool copy_data)
+{
+    BenchmarkMeasurement measurement;
+    stopwatch timer;
+    timer.start();
+    auto backend = runtime::Backend::create(backend_name);
+    backend->enable_performance_data(f, timing_detail);
+    auto compiled_func = backend->compile(f);
+    timer.stop();
+    measurement.compile_milliseconds = timer.get_nanoseconds() / 1e6;
+
+    BenchmarkTensors tensors = make_tensors(*backend, f);
+    set_denormals_flush_to_zero();
+
+    for (int i = 0; i < warmup_iterations; i++)
+    {
+        backend->call(compiled_func, tensors.results, tensors.args);
+    }
 
     stopwatch t1;
-    t1.start();
     for (size_t i = 0; i < iterations; i++)
     {
-        if (copy_data)
-        {
-            for (size_t arg_index = 0; arg_index < args.size(); arg_index++)
+        t1.start();
+        call_with_copies(*backend, compiled_func, tensors, copy_data);
+        t1.stop();
+        measurement.iteration_milliseconds.push_back(t1.get_nanoseconds() / 1e6);
+    }
+
+    measurement.perf_data = backend->get_performance_data(f);
+    return measurement;
+}
+
+vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
+                                                  const string& backend_name,
+                                                  size_t iterations,
+                                                  bool timing_detail,
+                                                  int warmup_iterations,
+                                                  bool copy_data)
+{
+    BenchmarkMeasurement measurement =
+        measure_benchmark(f, backend_name, iterations, timing_detail, warmup_iterations, copy_data);
+    cout.imbue(locale(""));
+    cout << "compile time: " << static_cast<size_t>(measurement.compile_milliseconds) << "ms"
+         << endl;
+    double time = 0;
+    for (double iteration_time : measurement.iteration_milliseconds)
+    {
+        time += iteration_time;
+    }
+    cout << time / iterations << "ms per iteration" << endl;
+    return measurement.perf_data;
+}
+
+// Process CPU time, user and system, in seconds
+static double get_cpu_seconds()
+{
+#ifdef __linux__
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+           (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+#else
+    return 0;
+#endif
+}
+
+// Nearest rank percentile of sorted values
+static double percentile(const vector<double>& sorted, double p)
+{
+    size_t rank = static_cast<size_t>(ceil(p * sorted.size()));
+    return sorted[rank == 0 ? 0 : rank - 1];
+}
+
+static double mean(const vector<double>& values)
+{
+    double sum = 0;
+    for (double value : values)
+    {
+        sum += value;
+    }
+    return values.empty() ? 0 : sum / values.size();
+}
+
+// Coefficient of variation, in %
+static double variation(const vector<double>& values)
+{
+    double average = mean(values);
+    double sum = 0;
+    for (double value : values)
+    {
+        sum += (value - average) * (value - average);
+    }
+    return values.empty() || average == 0 ? 0 : 100 * sqrt(sum / values.size()) / average;
+}
+
+vector<runtime::PerformanceCounter>
+    run_concurrent_benchmark(shared_ptr<Function> f,
+                             const string& backend_name,
+                             size_t iterations,
+                             bool timing_detail,
+                             int warmup_iterations,
+                             bool copy_data,
+                             const ConcurrentBenchmarkOptions& options)
+{
+    using clock = chrono::steady_clock;
+
+    // Everything is compiled and allocated before any stream starts, so the streams only
+    // call into the backend
+    stopwatch timer;
+    timer.start();
+    auto backend = runtime::Backend::create(backend_name);
+    size_t instance_count = options.instance_per_stream ? options.streams : 1;
+    vector<shared_ptr<Function>> instances{f};
+    for (size_t i = 1; i < instance_count; i++)
+    {
+        instances.push_back(clone_function(*f));
+    }
+    vector<shared_ptr<Function>> compiled_funcs;
+    for (shared_ptr<Function> instance : instances)
+    {
+        backend->enable_performance_data(instance, timing_detail);
+        compiled_funcs.push_back(backend->compile(instance));
+    }
+    timer.stop();
+    cout.imbue(locale(""));
+    cout << "compile time: " << timer.get_milliseconds() << "ms for " << instance_count
+         << (instance_count == 1 ? " instance" : " instances") << endl;
+
+    vector<BenchmarkTensors> tensors;
+    for (size_t stream = 0; stream < options.streams; stream++)
+    {
+        tensors.push_back(make_tensors(*backend, instances[stream % instance_count]));
+    }
+
+    // Backends do not support concurrent calls to one compiled Function, so streams sharing
+    // an instance take turns, and the time spent waiting for it counts toward their latency
+    vector<unique_ptr<mutex>> instance_mutexes;
+    for (size_t i = 0; i < instance_count; i++)
+    {
+        instance_mutexes.emplace_back(new mutex());
+    }
+
+    // Open loop: each stream receives requests at options.request_rate / streams per second
+    // with exponentially distributed gaps, whether or not earlier requests have finished.
+    // Latency is measured from the arrival of a request, so queueing behind a slow request
+    // is included.
+    vector<vector<double>> latencies(options.streams);
+    vector<double> stream_seconds(options.streams);
+    vector<string> errors(options.streams);
+    double stream_rate = options.request_rate / options.streams;
+    clock::time_point start;
+    double start_cpu = 0;
+    {
+        mutex start_mutex;
+        condition_variable start_condition;
+        size_t ready = 0;
+        bool started = false;
+
+        auto run_stream = [&](size_t stream) {
+            bool signalled = false;
+            try
             {
-                const shared_ptr<runtime::Tensor>& arg = args[arg_index];
-                if (arg->get_stale())
+                set_denormals_flush_to_zero();
+                size_t instance = stream % instance_count;
+                auto call = [&]() {
+                    lock_guard<mutex> guard(*instance_mutexes[instance]);
+                    call_with_copies(
+                        *backend, compiled_funcs[instance], tensors[stream], copy_data);
+                };
+                for (int i = 0; i < warmup_iterations; i++)
                 {
-                    const shared_ptr<runtime::HostTensor>& data = arg_data[arg_index];
-                    arg->write(data->get_data_ptr(),
-                               0,
-                               data->get_element_count() * data->get_element_type().size());
+                    call();
                 }
+
+                default_random_engine engine(static_cast<unsigned>(stream));
+                exponential_distribution<double> gap(stream_rate > 0 ? stream_rate : 1);
+                {
+                    unique_lock<mutex> lock(start_mutex);
+                    ready++;
+                    signalled = true;
+                    start_condition.notify_all();
+                    start_condition.wait(lock, [&]() { return started; });
+                }
+
+                clock::time_point arrival = start;
+                for (size_t i = 0; i < iterations; i++)
+                {
+                    if (stream_rate > 0)
+                    {
+                        arrival += chrono::duration_cast<clock::duration>(
+                            chrono::duration<double>(gap(engine)));
+                        this_thread::sleep_until(arrival);
+                    }
+                    else
+                    {
+                        arrival = clock::now();
+                    }
+                    call();
+                    latencies[stream].push_back(
+                        chrono::duration<double, milli>(clock::now() - arrival).count());
+                }
+                stream_seconds[stream] = chrono::duration<double>(clock::now() - start).count();
             }
-        }
-        backend->call(compiled_func, results, args);
-        if (copy_data)
-        {
-            for (size_t result_index = 0; result_index < results.size(); result_index++)
+            catch (const exception& e)
             {
-                const shared_ptr<runtime::HostTensor>& data = result_data[result_index];
-                const shared_ptr<runtime::Tensor>& result = results[result_index];
-                result->read(data->get_data_ptr(),
-                             0,
-                             data->get_element_count() * data->get_element_type().size());
+                errors[stream] = e.what();
+                if (!signalled)
+                {
+                    unique_lock<mutex> lock(start_mutex);
+                    ready++;
+                    start_condition.notify_all();
+                }
             }
+        };
+
+        vector<thread> threads;
+        for (size_t stream = 0; stream < options.streams; stream++)
+        {
+            threads.emplace_back(run_stream, stream);
+        }
+        {
+            unique_lock<mutex> lock(start_mutex);
+            start_condition.wait(lock, [&]() { return ready == options.streams; });
+            start = clock::now();
+            start_cpu = get_cpu_seconds();
+            started = true;
+        }
+        start_condition.notify_all();
+        for (thread& t : threads)
+        {
+            t.join();
         }
     }
-    t1.stop();
-    float time = t1.get_milliseconds();
-    cout << time / iterations << "ms per iteration" << endl;
+    double wall_seconds = chrono::duration<double>(clock::now() - start).count();
+    double cpu_seconds = get_cpu_seconds() - start_cpu;
+
+    for (const string& error : errors)
+    {
+        if (!error.empty())
+        {
+            throw runtime_error(error);
+        }
+    }
+
+    vector<double> all_latencies;
+    vector<double> stream_throughputs;
+    vector<double> stream_mean_latencies;
+    for (size_t stream = 0; stream < options.streams; stream++)
+    {
+        all_latencies.insert(
+            all_latencies.end(), latencies[stream].begin(), latencies[stream].end());
+        stream_throughputs.push_back(latencies[stream].size() / stream_seconds[stream]);
+        stream_mean_latencies.push_back(mean(latencies[stream]));
+    }
+    sort(all_latencies.begin(), all_latencies.end());
+
+    cout << fixed << setprecision(3);
+    cout << options.streams << " streams, " << all_latencies.size() << " requests in "
+         << wall_seconds << "s" << endl;
+    cout << "throughput: " << all_latencies.size() / wall_seconds << " requests/s";
+    if (options.request_rate > 0)
+    {
+        cout << " (target " << options.request_rate << " requests/s)";
+    }
+    cout << endl;
+    cout << "latency: mean " << mean(all_latencies) << "ms, p50 " << percentile(all_latencies, 0.5)
+         << "ms, p90 " << percentile(all_latencies, 0.9) << "ms, p99 "
+         << percentile(all_latencies, 0.99) << "ms, p99.9 " << percentile(all_latencies, 0.999)
+         << "ms, max " << all_latencies.back() << "ms" << endl;
+    if (cpu_seconds > 0)
+    {
+        unsigned hardware_threads = max(1u, thread::hardware_concurrency());
+        double cores = cpu_seconds / wall_seconds;
+        cout << "CPU utilization: " << cores << " cores (" << 100 * cores / hardware_threads
+             << "% of " << hardware_threads << " hardware threads)" << endl;
+    }
+    cout << "per-stream variation: throughput " << variation(stream_throughputs)
+         << "%, mean latency " << variation(stream_mean_latencies) << "%" << endl;
+    for (size_t stream = 0; stream < options.streams; stream++)
+    {
+        vector<double> sorted = latencies[stream];
+        sort(sorted.begin(), sorted.end());
+        cout << "    stream " << stream << ": " << stream_throughputs[stream]
+             << " requests/s, mean " << stream_mean_latencies[stream] << "ms, p99 "
+             << percentile(sorted, 0.99) << "ms" << endl;
+    }
+    cout.unsetf(ios_base::floatfield);
 
-    vector<runtime::PerformanceCounter> perf_data = backend->get_performance_data(f);
-    return perf_data;
+    return backend->get_performance_data(f);
 }
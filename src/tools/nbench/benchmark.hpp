@@ -28,9 +28,51 @@
 std::multimap<size_t, std::string>
     aggregate_timing(const std::vector<ngraph::runtime::PerformanceCounter>& perf_data);
 
+/// Timings of one benchmarked Function
+struct BenchmarkMeasurement
+{
+    double compile_milliseconds;
+    /// Wall time of each timed iteration, including the copies when copy_data is set
+    std::vector<double> iteration_milliseconds;
+    std::vector<ngraph::runtime::PerformanceCounter> perf_data;
+};
+
+BenchmarkMeasurement measure_benchmark(std::shared_ptr<ngraph::Function> f,
+                                       const std::string& backend_name,
+                                       size_t iterations,
+                                       bool timing_detail,
+                                       int warmup_iterations,
+                                       bool copy_data);
+
 std::vector<ngraph::runtime::PerformanceCounter> run_benchmark(std::shared_ptr<ngraph::Function> f,
                                                                const std::string& backend_name,
                                                                size_t iterations,
                                                                bool timing_detail,
                                                                int warmup_iterations,
                                                                bool copy_data);
+
+/// Settings of a concurrent benchmark
+struct ConcurrentBenchmarkOptions
+{
+    /// Number of threads calling the Function, each with its own input and result tensors
+    size_t streams = 1;
+    /// Compile a separate instance of the Function for each stream. Otherwise all streams
+    /// share one instance and take turns calling it.
+    bool instance_per_stream = false;
+    /// Total requests per second over all streams, arriving at random (Poisson) times
+    /// independent of completions. 0 runs each stream closed loop, issuing its next request
+    /// as soon as the previous one completes.
+    double request_rate = 0;
+};
+
+/// Runs `iterations` requests on each stream and prints throughput, latency percentiles,
+/// CPU utilization and the variation between streams. Returns the performance data of the
+/// first instance.
+std::vector<ngraph::runtime::PerformanceCounter>
+    run_concurrent_benchmark(std::shared_ptr<ngraph::Function> f,
+                             const std::string& backend_name,
+                             size_t iterations,
+                             bool timing_detail,
+                             int warmup_iterations,
+                             bool copy_data,
+                             const ConcurrentBenchmarkOptions& options);
@@ -197,6 +197,7 @@ int main(int argc, char** argv)
     bool visualize = false;
     int warmup_iterations = 1;
     bool copy_data = true;
+    ConcurrentBenchmarkOptions concurrency;
 
     for (size_t i = 1; i < argc; i++)
     {
@@ -253,6 +254,34 @@ int main(int argc, char** argv)
                 failed = true;
             }
         }
+        else if (arg == "--streams")
+        {
+            try
+            {
+                concurrency.streams = stoul(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--instance_per_stream")
+        {
+            concurrency.instance_per_stream = true;
+        }
+        else if (arg == "--request_rate")
+        {
+            try
+            {
+                concurrency.request_rate = stod(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
         else
         {
             cout << "Unknown option: " << arg << endl;
@@ -274,6 +303,11 @@ int main(int argc, char** argv)
         cout << "Either file or directory must be specified\n";
         failed = true;
     }
+    if (concurrency.streams < 1 || concurrency.request_rate < 0)
+    {
+        cout << "Invalid concurrency settings\n";
+        failed = true;
+    }
 
     if (failed)
     {
@@ -294,6 +328,12 @@ OPTIONS
         --timing_detail           Gather detailed timing
         -w|--warmup_iterations    Number of warm-up iterations
         --no_copy_data            Disable copy of input/result data every iteration
+        --streams                 Number of concurrent streams calling the model (default: 1).
+                                  Iterations are per stream.
+        --instance_per_stream     Compile a separate instance of the model for each stream
+                                  instead of sharing one
+        --request_rate            Open-loop load: total requests per second over all streams,
+                                  with random arrival times (default: 0, closed loop)
 )###";
         return 1;
     }
@@ -395,8 +435,22 @@ OPTIONS
             {
                 cout << "\n---- Benchmark ----\n";
                 shared_ptr<Function> f = deserialize(model);
-                auto perf_data = run_benchmark(
-                    f, backend, iterations, timing_detail, warmup_iterations, copy_data);
+                vector<runtime::PerformanceCounter> perf_data;
+                if (concurrency.streams > 1 || concurrency.request_rate > 0)
+                {
+                    perf_data = run_concurrent_benchmark(f,
+                                                         backend,
+                                                         iterations,
+                                                         timing_detail,
+                                                         warmup_iterations,
+                                                         copy_data,
+                                                         concurrency);
+                }
+                else
+                {
+                    perf_data = run_benchmark(
+                        f, backend, iterations, timing_detail, warmup_iterations, copy_data);
+                }
                 auto perf_shape = to_perf_shape(f, perf_data);
                 aggregate_perf_data.insert(
                     aggregate_perf_data.end(), perf_shape.begin(), perf_shape.end());
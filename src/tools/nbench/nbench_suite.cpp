@@ -0,0 +1,229 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// Runs the benchmark suite, a fixed catalog of graphs, on a set of backends, writes the
+// measurements as JSON and optionally checks them against a baseline written by an
+// earlier run.
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/util.hpp"
+#include "suite.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static double parse_tolerance(const string& arg, bool& failed)
+{
+    try
+    {
+        return stod(arg) / 100;
+    }
+    catch (...)
+    {
+        cout << "Invalid Argument\n";
+        failed = true;
+    }
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    vector<string> backends{"CPU", "INTERPRETER"};
+    string models_directory = NBENCH_MODELS_DIR;
+    string output;
+    string baseline_file;
+    string filter;
+    int iterations = 20;
+    int warmup_iterations = 2;
+    SuiteTolerance tolerance;
+    bool failed = false;
+
+    for (size_t i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg == "-b" || arg == "--backends")
+        {
+            backends = split(argv[++i], ',', true);
+        }
+        else if (arg == "-m" || arg == "--models")
+        {
+            models_directory = argv[++i];
+        }
+        else if (arg == "-o" || arg == "--output")
+        {
+            output = argv[++i];
+        }
+        else if (arg == "--baseline")
+        {
+            baseline_file = argv[++i];
+        }
+        else if (arg == "--filter")
+        {
+            filter = argv[++i];
+        }
+        else if (arg == "-i" || arg == "--iterations")
+        {
+            try
+            {
+                iterations = stoi(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "-w" || arg == "--warmup_iterations")
+        {
+            try
+            {
+                warmup_iterations = stoi(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--tolerance")
+        {
+            tolerance.runtime = parse_tolerance(argv[++i], failed);
+        }
+        else if (arg == "--compile_tolerance")
+        {
+            tolerance.compile = parse_tolerance(argv[++i], failed);
+        }
+        else if (arg == "--memory_tolerance")
+        {
+            tolerance.memory = parse_tolerance(argv[++i], failed);
+        }
+        else if (arg == "--runtime_floor")
+        {
+            try
+            {
+                tolerance.runtime_floor_milliseconds = stod(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else
+        {
+            cout << "Unknown option: " << arg << endl;
+            failed = true;
+        }
+    }
+    if (!baseline_file.empty() && !file_util::exists(baseline_file))
+    {
+        cout << "Baseline " << baseline_file << " not found\n";
+        failed = true;
+    }
+    if (iterations < 1)
+    {
+        cout << "At least one iteration is required\n";
+        failed = true;
+    }
+
+    if (failed)
+    {
+        cout << R"###(
+DESCRIPTION
+    Benchmark a catalog of synthetic graphs and serialized models on several backends and
+    track regressions against a baseline.
+
+SYNOPSIS
+        nbench_suite [-b <backends>] [-o <output>] [--baseline <file>]
+
+OPTIONS
+        -b|--backends             Comma separated backends (default: CPU,INTERPRETER)
+        -m|--models               Directory of serialized models (default: test/models)
+        -o|--output               Write the results as JSON to this file
+        -i|--iterations           Timed iterations per graph (default: 20)
+        -w|--warmup_iterations    Untimed iterations per graph (default: 2)
+        --filter                  Only run graphs whose name contains this string
+        --baseline                Results of an earlier run to compare against. Exits with
+                                  a non-zero status when any graph regressed.
+        --tolerance               Allowed latency and throughput change, in % (default: 10).
+                                  Latency is gated on the min and p50 of the iterations.
+        --runtime_floor           Latency changes below this many ms are ignored
+                                  (default: 0.1)
+        --compile_tolerance       Allowed compile time change, in % (default: 25)
+        --memory_tolerance        Allowed peak memory change, in % (default: 10)
+)###";
+        return 1;
+    }
+
+    vector<SuiteEntry> suite = get_synthetic_suite();
+    if (file_util::exists(models_directory))
+    {
+        vector<SuiteEntry> models = get_model_suite(models_directory);
+        suite.insert(suite.end(), models.begin(), models.end());
+    }
+
+    vector<SuiteResult> results;
+    for (const SuiteEntry& entry : suite)
+    {
+        if (entry.name.find(filter) == string::npos)
+        {
+            continue;
+        }
+        for (const string& backend : backends)
+        {
+            SuiteResult result = run_suite_entry(entry, backend, iterations, warmup_iterations);
+            cout << left << setw(50) << result.name << setw(12) << result.backend;
+            if (result.error.empty())
+            {
+                cout << fixed << setprecision(3) << "p50 " << result.p50_milliseconds
+                     << "ms  p99 " << result.p99_milliseconds << "ms  compile "
+                     << result.compile_milliseconds << "ms  peak " << result.peak_memory_kb
+                     << "KiB\n";
+            }
+            else
+            {
+                cout << "error: " << result.error << "\n";
+            }
+            results.push_back(result);
+        }
+    }
+
+    if (!output.empty())
+    {
+        ofstream out(output);
+        write_suite_results(out, results);
+    }
+
+    int rc = 0;
+    if (!baseline_file.empty())
+    {
+        ifstream in(baseline_file);
+        vector<string> regressions =
+            compare_suite_results(results, read_suite_results(in), tolerance);
+        cout << "\n---- " << regressions.size() << " regressions against " << baseline_file
+             << " ----\n";
+        for (const string& regression : regressions)
+        {
+            cout << regression << "\n";
+        }
+        rc = regressions.empty() ? 0 : 1;
+    }
+    return rc;
+}
@@ -0,0 +1,464 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
+
+#include <nlohmann/json.hpp>
+
+#include "benchmark.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/serializer.hpp"
+#include "suite.hpp"
+
+using namespace std;
+using namespace ngraph;
+using json = nlohmann::json;
+
+static shared_ptr<Node> add_bias(const shared_ptr<Node>& node, const shared_ptr<Node>& bias)
+{
+    return make_shared<op::Add>(
+        node, make_shared<op::Broadcast>(bias, node->get_shape(), AxisSet{0}));
+}
+
+// Fully connected layers with Relu activations and a Softmax classifier
+static shared_ptr<Function> make_mlp()
+{
+    const size_t batch = 64;
+    const vector<size_t> widths{784, 512, 512, 10};
+
+    auto input = make_shared<op::Parameter>(element::f32, Shape{batch, widths[0]});
+    ParameterVector params{input};
+    shared_ptr<Node> layer = input;
+    for (size_t i = 1; i < widths.size(); i++)
+    {
+        auto weights = make_shared<op::Parameter>(element::f32, Shape{widths[i - 1], widths[i]});
+        auto bias = make_shared<op::Parameter>(element::f32, Shape{widths[i]});
+        params.push_back(weights);
+        params.push_back(bias);
+        layer = add_bias(make_shared<op::Dot>(layer, weights), bias);
+        if (i + 1 < widths.size())
+        {
+            layer = make_shared<op::Relu>(layer);
+        }
+    }
+    auto output = make_shared<op::Softmax>(layer, AxisSet{1});
+    return make_shared<Function>(NodeVector{output}, params);
+}
+
+// Two convolution, Relu and max pooling stages followed by a fully connected classifier
+static shared_ptr<Function> make_cnn()
+{
+    const size_t batch = 16;
+    const vector<size_t> channels{3, 32, 64};
+    size_t image_size = 32;
+
+    auto input = make_shared<op::Parameter>(
+        element::f32, Shape{batch, channels[0], image_size, image_size});
+    ParameterVector params{input};
+    shared_ptr<Node> layer = input;
+    for (size_t i = 1; i < channels.size(); i++)
+    {
+        auto filters =
+            make_shared<op::Parameter>(element::f32, Shape{channels[i], channels[i - 1], 3, 3});
+        auto bias = make_shared<op::Parameter>(element::f32, Shape{channels[i]});
+        params.push_back(filters);
+        params.push_back(bias);
+        auto conv = make_shared<op::Convolution>(layer,
+                                                 filters,
+                                                 Strides{1, 1},
+                                                 Strides{1, 1},
+                                                 CoordinateDiff{1, 1},
+                                                 CoordinateDiff{1, 1});
+        auto relu = make_shared<op::Relu>(make_shared<op::Add>(
+            conv, make_shared<op::Broadcast>(bias, conv->get_shape(), AxisSet{0, 2, 3})));
+        layer = make_shared<op::MaxPool>(relu, Shape{2, 2}, Strides{2, 2});
+        image_size /= 2;
+    }
+
+    size_t features = channels.back() * image_size * image_size;
+    auto flat = make_shared<op::Reshape>(layer, AxisVector{0, 1, 2, 3}, Shape{batch, features});
+    auto weights = make_shared<op::Parameter>(element::f32, Shape{features, 10});
+    auto bias = make_shared<op::Parameter>(element::f32, Shape{10});
+    params.push_back(weights);
+    params.push_back(bias);
+    auto output = add_bias(make_shared<op::Dot>(flat, weights), bias);
+    return make_shared<Function>(NodeVector{output}, params);
+}
+
+// A single layer LSTM unrolled over its timesteps, decomposed the way framework bridges
+// emit it
+static shared_ptr<Function> make_lstm()
+{
+    const size_t batch = 32;
+    const size_t input_size = 128;
+    const size_t hidden_size = 128;
+    const size_t timesteps = 10;
+    const Shape state_shape{batch, hidden_size};
+
+    auto W = make_shared<op::Parameter>(element::f32, Shape{input_size, 4 * hidden_size});
+    auto Wb = make_shared<op::Parameter>(element::f32, Shape{4 * hidden_size});
+    auto R = make_shared<op::Parameter>(element::f32, Shape{hidden_size, 4 * hidden_size});
+    auto Rb = make_shared<op::Parameter>(element::f32, Shape{4 * hidden_size});
+    auto h0 = make_shared<op::Parameter>(element::f32, state_shape);
+    auto c0 = make_shared<op::Parameter>(element::f32, state_shape);
+    ParameterVector params{W, Wb, R, Rb, h0, c0};
+
+    auto gate = [&](const shared_ptr<Node>& gates, size_t index) {
+        return make_shared<op::Slice>(gates,
+                                      Coordinate{0, index * hidden_size},
+                                      Coordinate{batch, (index + 1) * hidden_size});
+    };
+
+    shared_ptr<Node> ht = h0;
+    shared_ptr<Node> ct = c0;
+    NodeVector outputs;
+    for (size_t t = 0; t < timesteps; t++)
+    {
+        auto xt = make_shared<op::Parameter>(element::f32, Shape{batch, input_size});
+        params.push_back(xt);
+        auto gates = make_shared<op::Add>(add_bias(make_shared<op::Dot>(xt, W), Wb),
+                                          add_bias(make_shared<op::Dot>(ht, R), Rb));
+        auto it = make_shared<op::Sigmoid>(gate(gates, 0));
+        auto ft = make_shared<op::Sigmoid>(gate(gates, 1));
+        auto gt = make_shared<op::Tanh>(gate(gates, 2));
+        auto ot = make_shared<op::Sigmoid>(gate(gates, 3));
+        ct = make_shared<op::Add>(make_shared<op::Multiply>(ft, ct),
+                                  make_shared<op::Multiply>(it, gt));
+        ht = make_shared<op::Multiply>(ot, make_shared<op::Tanh>(ct));
+        outputs.push_back(ht);
+    }
+    outputs.push_back(ct);
+    return make_shared<Function>(outputs, params);
+}
+
+// Single head scaled dot product self attention over a batch of sequences
+static shared_ptr<Function> make_attention()
+{
+    const size_t batch = 8;
+    const size_t sequence_length = 64;
+    const size_t model_size = 128;
+
+    auto input =
+        make_shared<op::Parameter>(element::f32, Shape{batch * sequence_length, model_size});
+    auto Wq = make_shared<op::Parameter>(element::f32, Shape{model_size, model_size});
+    auto Wk = make_shared<op::Parameter>(element::f32, Shape{model_size, model_size});
+    auto Wv = make_shared<op::Parameter>(element::f32, Shape{model_size, model_size});
+    auto Wo = make_shared<op::Parameter>(element::f32, Shape{model_size, model_size});
+    ParameterVector params{input, Wq, Wk, Wv, Wo};
+
+    auto Q = make_shared<op::Dot>(input, Wq);
+    auto K = make_shared<op::Dot>(input, Wk);
+    auto V = make_shared<op::Dot>(input, Wv);
+    auto scale = make_shared<op::Broadcast>(
+        op::Constant::create(element::f32, Shape{}, {1.0f / sqrt(static_cast<float>(model_size))}),
+        Shape{sequence_length, sequence_length},
+        AxisSet{0, 1});
+
+    NodeVector heads;
+    for (size_t b = 0; b < batch; b++)
+    {
+        auto rows = [&](const shared_ptr<Node>& node) {
+            return make_shared<op::Slice>(node,
+                                          Coordinate{b * sequence_length, 0},
+                                          Coordinate{(b + 1) * sequence_length, model_size});
+        };
+        auto Kt = make_shared<op::Reshape>(
+            rows(K), AxisVector{1, 0}, Shape{model_size, sequence_length});
+        auto scores = make_shared<op::Multiply>(make_shared<op::Dot>(rows(Q), Kt), scale);
+        auto weights = make_shared<op::Softmax>(scores, AxisSet{1});
+        heads.push_back(make_shared<op::Dot>(weights, rows(V)));
+    }
+    auto output = make_shared<op::Dot>(make_shared<op::Concat>(heads, 0), Wo);
+    return make_shared<Function>(NodeVector{output}, params);
+}
+
+vector<SuiteEntry> get_synthetic_suite()
+{
+    return vector<SuiteEntry>{{"synthetic/mlp", make_mlp},
+                              {"synthetic/cnn", make_cnn},
+                              {"synthetic/lstm", make_lstm},
+                              {"synthetic/attention", make_attention}};
+}
+
+vector<SuiteEntry> get_model_suite(const string& directory)
+{
+    vector<string> files;
+    file_util::iterate_files(directory,
+                             [&](const string& file, bool is_dir) {
+                                 if (!is_dir && file.size() > 5 &&
+                                     file.compare(file.size() - 5, 5, ".json") == 0)
+                                 {
+                                     files.push_back(file);
+                                 }
+                             },
+                             true);
+    sort(files.begin(), files.end());
+
+    vector<SuiteEntry> entries;
+    for (const string& file : files)
+    {
+        string name = file;
+        if (name.compare(0, directory.size(), directory) == 0)
+        {
+            name = name.substr(directory.size());
+            name = name.substr(name.find_first_not_of('/'));
+        }
+        entries.push_back({"model/" + name, [file]() { return deserialize(file); }});
+    }
+    return entries;
+}
+
+#ifdef __linux__
+// Resets the peak resident set size reported in /proc/self/status (Linux 4.0 and later)
+static void reset_peak_memory()
+{
+    ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+}
+
+static size_t get_peak_memory_kb()
+{
+    ifstream status("/proc/self/status");
+    string line;
+    while (getline(status, line))
+    {
+        if (line.compare(0, 6, "VmHWM:") == 0)
+        {
+            return stoul(line.substr(6));
+        }
+    }
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+#else
+static void reset_peak_memory()
+{
+}
+
+static size_t get_peak_memory_kb()
+{
+    return 0;
+}
+#endif
+
+// Nearest rank percentile of sorted values
+static double percentile(const vector<double>& sorted, double p)
+{
+    size_t rank = static_cast<size_t>(ceil(p * sorted.size()));
+    return sorted[rank == 0 ? 0 : rank - 1];
+}
+
+SuiteResult run_suite_entry(const SuiteEntry& entry,
+                            const string& backend_name,
+                            size_t iterations,
+                            int warmup_iterations)
+{
+    SuiteResult result;
+    result.name = entry.name;
+    result.backend = backend_name;
+    try
+    {
+        reset_peak_memory();
+        BenchmarkMeasurement measurement = measure_benchmark(
+            entry.make_function(), backend_name, iterations, false, warmup_iterations, true);
+        result.peak_memory_kb = get_peak_memory_kb();
+
+        vector<double> times = measurement.iteration_milliseconds;
+        sort(times.begin(), times.end());
+        result.iterations = times.size();
+        result.compile_milliseconds = measurement.compile_milliseconds;
+        if (!times.empty())
+        {
+            double total = 0;
+            for (double time : times)
+            {
+                total += time;
+            }
+            result.min_milliseconds = times.front();
+            result.mean_milliseconds = total / times.size();
+            result.p50_milliseconds = percentile(times, 0.5);
+            result.p90_milliseconds = percentile(times, 0.9);
+            result.p99_milliseconds = percentile(times, 0.99);
+            result.throughput = total > 0 ? 1000.0 * times.size() / total : 0;
+        }
+    }
+    catch (const exception& e)
+    {
+        result.error = e.what();
+    }
+    return result;
+}
+
+void write_suite_results(ostream& out, const vector<SuiteResult>& results)
+{
+    json benchmarks = json::array();
+    for (const SuiteResult& result : results)
+    {
+        json benchmark;
+        benchmark["name"] = result.name;
+        benchmark["backend"] = result.backend;
+        if (!result.error.empty())
+        {
+            benchmark["error"] = result.error;
+        }
+        else
+        {
+            benchmark["iterations"] = result.iterations;
+            benchmark["compile_ms"] = result.compile_milliseconds;
+            benchmark["latency_ms"] = {{"min", result.min_milliseconds},
+                                       {"mean", result.mean_milliseconds},
+                                       {"p50", result.p50_milliseconds},
+                                       {"p90", result.p90_milliseconds},
+                                       {"p99", result.p99_milliseconds}};
+            benchmark["throughput"] = result.throughput;
+            benchmark["peak_memory_kb"] = result.peak_memory_kb;
+        }
+        benchmarks.push_back(benchmark);
+    }
+    json document;
+    document["benchmarks"] = benchmarks;
+    out << setw(4) << document << endl;
+}
+
+vector<SuiteResult> read_suite_results(istream& in)
+{
+    json document;
+    in >> document;
+    vector<SuiteResult> results;
+    for (const json& benchmark : document.at("benchmarks"))
+    {
+        SuiteResult result;
+        result.name = benchmark.at("name").get<string>();
+        result.backend = benchmark.at("backend").get<string>();
+        if (benchmark.count("error"))
+        {
+            result.error = benchmark.at("error").get<string>();
+        }
+        else
+        {
+            const json& latency = benchmark.at("latency_ms");
+            result.iterations = benchmark.at("iterations").get<size_t>();
+            result.compile_milliseconds = benchmark.at("compile_ms").get<double>();
+            result.min_milliseconds = latency.at("min").get<double>();
+            result.mean_milliseconds = latency.at("mean").get<double>();
+            result.p50_milliseconds = latency.at("p50").get<double>();
+            result.p90_milliseconds = latency.at("p90").get<double>();
+            result.p99_milliseconds = latency.at("p99").get<double>();
+            result.throughput = benchmark.at("throughput").get<double>();
+            result.peak_memory_kb = benchmark.at("peak_memory_kb").get<size_t>();
+        }
+        results.push_back(result);
+    }
+    return results;
+}
+
+vector<string> compare_suite_results(const vector<SuiteResult>& results,
+                                     const vector<SuiteResult>& baseline,
+                                     const SuiteTolerance& tolerance)
+{
+    map<pair<string, string>, const SuiteResult*> baseline_map;
+    for (const SuiteResult& result : baseline)
+    {
+        baseline_map[{result.name, result.backend}] = &result;
+    }
+
+    vector<string> regressions;
+    for (const SuiteResult& result : results)
+    {
+        auto it = baseline_map.find({result.name, result.backend});
+        if (it == baseline_map.end() || !it->second->error.empty())
+        {
+            continue;
+        }
+        const SuiteResult& base = *it->second;
+        string prefix = result.name + " on " + result.backend + ": ";
+        if (!result.error.empty())
+        {
+            regressions.push_back(prefix + "fails with '" + result.error + "'");
+            continue;
+        }
+
+        // Higher is worse for all metrics but throughput
+        auto check = [&](const string& metric,
+                         double value,
+                         double base_value,
+                         double allowed,
+                         double floor) {
+            if (base_value > 0 && value > base_value * (1 + allowed) && value - base_value > floor)
+            {
+                stringstream ss;
+                ss << prefix << metric << " " << value << " vs " << base_value << " (+"
+                   << 100 * (value / base_value - 1) << "%)";
+                regressions.push_back(ss.str());
+            }
+        };
+        check("compile_ms",
+              result.compile_milliseconds,
+              base.compile_milliseconds,
+              tolerance.compile,
+              tolerance.compile_floor_milliseconds);
+        check("min_ms",
+              result.min_milliseconds,
+              base.min_milliseconds,
+              tolerance.runtime,
+              tolerance.runtime_floor_milliseconds);
+        check("p50_ms",
+              result.p50_milliseconds,
+              base.p50_milliseconds,
+              tolerance.runtime,
+              tolerance.runtime_floor_milliseconds);
+        check("peak_memory_kb",
+              static_cast<double>(result.peak_memory_kb),
+              static_cast<double>(base.peak_memory_kb),
+              tolerance.memory,
+              0);
+        if (result.throughput < base.throughput * (1 - tolerance.runtime) &&
+            result.mean_milliseconds - base.mean_milliseconds >
+                tolerance.runtime_floor_milliseconds)
+        {
+            stringstream ss;
+            ss << prefix << "throughput " << result.throughput << " vs " << base.throughput << " ("
+               << 100 * (result.throughput / base.throughput - 1) << "%)";
+            regressions.push_back(ss.str());
+        }
+    }
+    return regressions;
+}
@@ -0,0 +1,89 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ngraph/function.hpp"
+
+/// A graph of the benchmark suite. Functions are built on demand so that every backend
+/// compiles a fresh copy.
+struct SuiteEntry
+{
+    std::string name;
+    std::function<std::shared_ptr<ngraph::Function>()> make_function;
+};
+
+/// Synthetic MLP, CNN, LSTM and attention graphs
+std::vector<SuiteEntry> get_synthetic_suite();
+
+/// Every serialized model (*.json) under `directory`, named by its path relative to it
+std::vector<SuiteEntry> get_model_suite(const std::string& directory);
+
+/// Measurements of one graph on one backend. `error` is set, and the measurements are zero,
+/// when the graph could not be compiled or run.
+struct SuiteResult
+{
+    std::string name;
+    std::string backend;
+    std::string error;
+    size_t iterations = 0;
+    double compile_milliseconds = 0;
+    double min_milliseconds = 0;
+    double mean_milliseconds = 0;
+    double p50_milliseconds = 0;
+    double p90_milliseconds = 0;
+    double p99_milliseconds = 0;
+    /// Iterations per second over the timed iterations
+    double throughput = 0;
+    /// Peak resident set size while compiling and running, in KiB. Zero when the platform
+    /// does not report it.
+    size_t peak_memory_kb = 0;
+};
+
+SuiteResult run_suite_entry(const SuiteEntry& entry,
+                            const std::string& backend_name,
+                            size_t iterations,
+                            int warmup_iterations);
+
+void write_suite_results(std::ostream& out, const std::vector<SuiteResult>& results);
+std::vector<SuiteResult> read_suite_results(std::istream& in);
+
+/// Allowed relative change of each metric before it counts as a regression
+struct SuiteTolerance
+{
+    double runtime = 0.1;
+    double compile = 0.25;
+    double memory = 0.1;
+    /// Compile time changes smaller than this are noise, whatever their relative size
+    double compile_floor_milliseconds = 10;
+    /// Same for the latency of one iteration. Small graphs run in microseconds, where
+    /// scheduling jitter alone exceeds the relative tolerance.
+    double runtime_floor_milliseconds = 0.1;
+};
+
+/// Compares `results` with the entries of `baseline` that have the same name and backend and
+/// returns a description of each regression. Entries missing from either side are ignored,
+/// and a graph that ran in the baseline but fails now is a regression. Latency is gated on
+/// the min and p50, which are stable over a few iterations; p90 and p99 are only reported.
+std::vector<std::string> compare_suite_results(const std::vector<SuiteResult>& results,
+                                               const std::vector<SuiteResult>& baseline,
+                                               const SuiteTolerance& tolerance);
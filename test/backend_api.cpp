@@ -17,7 +17,9 @@
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
 #include "ngraph/util.hpp"
+#include "util/test_tools.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -34,3 +36,47 @@ TEST(backend_api, invalid_name)
 {
     ASSERT_ANY_THROW(ngraph::runtime::Backend::create("COMPLETELY-BOGUS-NAME"));
 }
+
+TEST(backend_api, executable_bind_once)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(A + B, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+
+    auto executable = backend->create_executable(f);
+    executable->bind_input(0, a);
+    executable->bind_output(0, result);
+    EXPECT_ANY_THROW(executable->run());
+    EXPECT_ANY_THROW(executable->bind_input(1, backend->create_tensor(element::f32, Shape{4})));
+    EXPECT_ANY_THROW(executable->bind_input(1, backend->create_tensor(element::i32, shape)));
+    EXPECT_ANY_THROW(executable->bind_input(2, b));
+    executable->bind_input(1, b);
+
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    executable->run();
+    EXPECT_EQ((vector<float>{6, 8, 10, 12}), read_vector<float>(result));
+
+    copy_data(b, vector<float>{1, 1, 1, 1});
+    executable->run();
+    EXPECT_EQ((vector<float>{2, 3, 4, 5}), read_vector<float>(result));
+}
+
+TEST(backend_api, host_data_ptr)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    vector<float> data{1, 2, 3, 4};
+    auto wrapped = backend->create_tensor(element::f32, Shape{2, 2}, data.data());
+    EXPECT_EQ(data.data(), wrapped->get_host_data_ptr());
+
+    auto owned = backend->create_tensor(element::f32, Shape{2, 2});
+    copy_data(owned, data);
+    ASSERT_NE(nullptr, owned->get_host_data_ptr());
+    EXPECT_EQ(3, static_cast<float*>(owned->get_host_data_ptr())[2]);
+}
@@ -23,11 +23,20 @@
 #include "ngraph/codegen/compiler.hpp"
 #include "ngraph/codegen/execution_engine.hpp"
 #include "ngraph/file_util.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
 #include "ngraph/op/concat.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/multiply.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
+#include "util/all_close.hpp"
 #include "util/random.hpp"
 #include "util/test_tools.hpp"
 
@@ -140,3 +149,274 @@ TEST(benchmark, concat_32x1x200_axis1_6)
         }
     }
 }
+
+//
+// Benchmarks small-batch fully-connected layers where the weights are either a Constant,
+// and therefore packed into GEMM panel layout once at compile time, or a Parameter, which
+// is repacked by every GEMM call.
+//
+TEST(benchmark, fc_constant_weight_packing)
+{
+    const size_t n_runs = 1000;
+    const size_t input_size = 1024;
+    const size_t output_size = 1024;
+    vector<size_t> batch_sizes{1, 4, 16};
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    Shape shape_w{input_size, output_size};
+    vector<float> weights(shape_size(shape_w));
+    rng.initialize(weights);
+
+    auto backend = runtime::Backend::create("CPU");
+
+    for (size_t batch : batch_sizes)
+    {
+        Shape shape_x{batch, input_size};
+        Shape shape_r{batch, output_size};
+        vector<float> input(shape_size(shape_x));
+        rng.initialize(input);
+
+        auto X0 = make_shared<op::Parameter>(element::f32, shape_x);
+        auto W0 = op::Constant::create(element::f32, shape_w, weights);
+        auto packed_f = make_shared<Function>(make_shared<op::Dot>(X0, W0), ParameterVector{X0});
+
+        auto X1 = make_shared<op::Parameter>(element::f32, shape_x);
+        auto W1 = make_shared<op::Parameter>(element::f32, shape_w);
+        auto unpacked_f =
+            make_shared<Function>(make_shared<op::Dot>(X1, W1), ParameterVector{X1, W1});
+
+        auto x = backend->create_tensor(element::f32, shape_x);
+        auto w = backend->create_tensor(element::f32, shape_w);
+        auto packed_result = backend->create_tensor(element::f32, shape_r);
+        auto unpacked_result = backend->create_tensor(element::f32, shape_r);
+        copy_data(x, input);
+        copy_data(w, weights);
+
+        auto packed_handle = backend->compile(packed_f);
+        auto unpacked_handle = backend->compile(unpacked_f);
+
+        stopwatch packed_sw;
+        packed_sw.start();
+        for (size_t i = 0; i < n_runs; i++)
+        {
+            backend->call(packed_handle, {packed_result}, {x});
+        }
+        packed_sw.stop();
+
+        stopwatch unpacked_sw;
+        unpacked_sw.start();
+        for (size_t i = 0; i < n_runs; i++)
+        {
+            backend->call(unpacked_handle, {unpacked_result}, {x, w});
+        }
+        unpacked_sw.stop();
+
+        std::cout << "batch " << batch << ": packed " << (packed_sw.get_microseconds() / n_runs)
+                  << " us/call, unpacked " << (unpacked_sw.get_microseconds() / n_runs)
+                  << " us/call" << std::endl;
+
+        EXPECT_TRUE(test::all_close(read_vector<float>(packed_result),
+                                    read_vector<float>(unpacked_result),
+                                    1e-4f,
+                                    1e-5f));
+    }
+}
+
+//
+// Benchmarks the CPU convolution fallback, used whenever MKLDNN does not take a convolution,
+// against the reference kernel run by INTERPRETER. f64 is never sent to MKLDNN.
+//
+TEST(benchmark, convolution_fallback)
+{
+    const size_t n_runs = 5;
+    Shape shape_data{2, 16, 28, 28};
+    Shape shape_filters{16, 16, 3, 3};
+    Shape shape_delta{2, 16, 28, 28};
+    Strides strides{1, 1};
+    Strides dilation{1, 1};
+    CoordinateDiff padding{1, 1};
+    Strides data_dilation{1, 1};
+
+    auto data = make_shared<op::Parameter>(element::f64, shape_data);
+    auto filters = make_shared<op::Parameter>(element::f64, shape_filters);
+    auto delta = make_shared<op::Parameter>(element::f64, shape_delta);
+    vector<pair<string, shared_ptr<Function>>> functions{
+        {"forward",
+         make_shared<Function>(
+             make_shared<op::Convolution>(
+                 data, filters, strides, dilation, padding, padding, data_dilation),
+             ParameterVector{data, filters})},
+        {"backprop data",
+         make_shared<Function>(
+             make_shared<op::ConvolutionBackpropData>(
+                 shape_data, filters, delta, strides, dilation, padding, padding, data_dilation),
+             ParameterVector{filters, delta})},
+        {"backprop filters",
+         make_shared<Function>(
+             make_shared<op::ConvolutionBackpropFilters>(
+                 data, shape_filters, delta, strides, dilation, padding, padding, data_dilation),
+             ParameterVector{data, delta})}};
+
+    test::Uniform<double> rng(-1.0, 1.0);
+    map<shared_ptr<Node>, vector<double>> values;
+    for (auto param : {data, filters, delta})
+    {
+        values[param].resize(shape_size(param->get_shape()));
+        rng.initialize(values[param]);
+    }
+
+    for (auto& named_function : functions)
+    {
+        auto f = named_function.second;
+        vector<vector<double>> results;
+        for (string backend_name : {"INTERPRETER", "CPU"})
+        {
+            auto backend = runtime::Backend::create(backend_name);
+            vector<shared_ptr<runtime::Tensor>> args;
+            for (auto param : f->get_parameters())
+            {
+                args.push_back(backend->create_tensor(element::f64, param->get_shape()));
+                copy_data(args.back(), values[param]);
+            }
+            auto result = backend->create_tensor(element::f64, f->get_output_shape(0));
+            auto handle = backend->compile(f);
+
+            stopwatch sw;
+            sw.start();
+            for (size_t i = 0; i < n_runs; i++)
+            {
+                backend->call(handle, {result}, args);
+            }
+            sw.stop();
+            std::cout << named_function.first << " " << backend_name << ": "
+                      << (sw.get_microseconds() / n_runs) << " us/call" << std::endl;
+            results.push_back(read_vector<double>(result));
+        }
+        EXPECT_TRUE(test::all_close(results.at(1), results.at(0), 1e-9, 1e-9));
+    }
+}
+
+// A long chain of elementwise ops on tiny tensors, where per-op dispatch rather than arithmetic
+// dominates the call time
+TEST(benchmark, small_elementwise_op_overhead)
+{
+    const size_t n_runs = 100;
+    const size_t n_steps = 500;
+    Shape shape{4, 4};
+
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto H = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> x = A;
+    for (size_t i = 0; i < n_steps; i++)
+    {
+        x = make_shared<op::Multiply>(make_shared<op::Add>(x, B), H);
+    }
+    auto f = make_shared<Function>(x, ParameterVector{A, B, H});
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> values(3, vector<float>(shape_size(shape)));
+    rng.initialize(values[0]);
+    rng.initialize(values[1]);
+    fill(values[2].begin(), values[2].end(), 0.5f);
+
+    vector<vector<float>> results;
+    for (string backend_name : {"INTERPRETER", "CPU"})
+    {
+        auto backend = runtime::Backend::create(backend_name);
+        vector<shared_ptr<runtime::Tensor>> args;
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            args.push_back(backend->create_tensor(element::f32, shape));
+            copy_data(args.back(), values[i]);
+        }
+        auto result = backend->create_tensor(element::f32, shape);
+        auto handle = backend->compile(f);
+        backend->call(handle, {result}, args);
+
+        stopwatch sw;
+        sw.start();
+        for (size_t i = 0; i < n_runs; i++)
+        {
+            backend->call(handle, {result}, args);
+        }
+        sw.stop();
+        double us_per_call = static_cast<double>(sw.get_microseconds()) / n_runs;
+        std::cout << backend_name << ": " << us_per_call << " us/call, "
+                  << us_per_call / (2 * n_steps) << " us/op" << std::endl;
+        results.push_back(read_vector<float>(result));
+    }
+    EXPECT_TRUE(test::all_close(results.at(1), results.at(0)));
+}
+
+// Fixed cost of a call on a small graph, through the Tensor interface and through raw buffers
+TEST(benchmark, cpu_call_overhead)
+{
+    const size_t n_runs = 10000;
+    Shape shape{8};
+
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> x = A;
+    for (size_t i = 0; i < 10; i++)
+    {
+        x = make_shared<op::Multiply>(make_shared<op::Add>(x, B), B);
+    }
+    auto f = make_shared<Function>(x, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_cast<runtime::cpu::CPU_Backend*>(backend.get());
+    auto handle = backend->compile(f);
+    auto call_frame = cpu_backend->get_call_frame(f);
+
+    vector<float> a(shape_size(shape), 0.5f);
+    vector<float> b(shape_size(shape), 0.25f);
+    vector<float> raw_result(shape_size(shape));
+    vector<shared_ptr<runtime::Tensor>> args{backend->create_tensor(element::f32, shape),
+                                             backend->create_tensor(element::f32, shape)};
+    copy_data(args[0], a);
+    copy_data(args[1], b);
+    auto result = backend->create_tensor(element::f32, shape);
+    vector<void*> inputs{a.data(), b.data()};
+    vector<void*> outputs{raw_result.data()};
+    backend->call(handle, {result}, args);
+
+    stopwatch sw;
+    sw.start();
+    for (size_t i = 0; i < n_runs; i++)
+    {
+        backend->call(handle, {result}, args);
+    }
+    sw.stop();
+    std::cout << "Tensor call: " << static_cast<double>(sw.get_microseconds()) / n_runs
+              << " us/call" << std::endl;
+
+    sw.start();
+    for (size_t i = 0; i < n_runs; i++)
+    {
+        call_frame->call(outputs.data(), inputs.data());
+    }
+    sw.stop();
+    std::cout << "Raw pointer call: " << static_cast<double>(sw.get_microseconds()) / n_runs
+              << " us/call" << std::endl;
+    EXPECT_EQ(read_vector<float>(result), raw_result);
+
+    auto frozen_f = clone_function(*f);
+    cpu_backend->set_frozen_execution(frozen_f, true);
+    backend->compile(frozen_f);
+    auto frozen_call_frame = cpu_backend->get_call_frame(frozen_f);
+    vector<float> frozen_result(shape_size(shape));
+    vector<void*> frozen_outputs{frozen_result.data()};
+    frozen_call_frame->pin(frozen_outputs.data(), inputs.data());
+    frozen_call_frame->call_pinned();
+
+    sw.start();
+    for (size_t i = 0; i < n_runs; i++)
+    {
+        frozen_call_frame->call_pinned();
+    }
+    sw.stop();
+    std::cout << "Frozen pinned call: " << static_cast<double>(sw.get_microseconds()) / n_runs
+              << " us/call" << std::endl;
+    EXPECT_EQ(frozen_result, raw_result);
+}
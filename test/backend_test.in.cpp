@@ -28,6 +28,7 @@
 #include "ngraph/log.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/experimental/generate_mask.hpp"
+#include "ngraph/op/experimental/quantized_dot.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/state/rng_state.hpp"
 #include "util/all_close.hpp"
@@ -6729,6 +6730,82 @@ NGRAPH_TEST(${BACKEND_NAME}, quantize_ROUND_DOWN)
               read_vector<output_c_type>(y));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, quantized_dot)
+{
+    Shape shape_a{2, 3};
+    Shape shape_b{3, 2};
+    Shape shape_r{2, 2};
+    auto A = make_shared<op::Parameter>(element::u8, shape_a);
+    auto B = make_shared<op::Parameter>(element::i8, shape_b);
+    auto scale = op::Constant::create(element::f32, Shape{}, {0.25f});
+    auto f = make_shared<Function>(make_shared<op::QuantizedDot>(A, B, scale),
+                                   ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::u8, shape_a);
+    copy_data(a, vector<uint8_t>{1, 2, 3, 4, 5, 6});
+    auto b = backend->create_tensor(element::i8, shape_b);
+    copy_data(b, vector<int8_t>{1, -1, 2, -3, 3, 1});
+    auto result = backend->create_tensor(element::i8, shape_r);
+
+    // accumulators  14   -4   32  -13
+    // times scale  3.5   -1    8  -3.25
+    auto handle = backend->compile(f);
+    backend->call_with_validate(handle, {result}, {a, b});
+    EXPECT_EQ((vector<int8_t>{4, -1, 8, -3}), read_vector<int8_t>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, quantized_dot_bias_relu)
+{
+    Shape shape_a{2, 3};
+    Shape shape_b{3, 2};
+    Shape shape_r{2, 2};
+    auto A = make_shared<op::Parameter>(element::u8, shape_a);
+    auto B = make_shared<op::Parameter>(element::i8, shape_b);
+    auto Bias = make_shared<op::Parameter>(element::i32, Shape{2});
+    auto scale = op::Constant::create(element::f32, Shape{}, {0.5f});
+    auto qdot = make_shared<op::QuantizedDotBias>(A, B, Bias, scale, true, true);
+    auto f = make_shared<Function>(qdot, ParameterVector{A, B, Bias});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::u8, shape_a);
+    copy_data(a, vector<uint8_t>{1, 2, 3, 4, 5, 6});
+    auto b = backend->create_tensor(element::i8, shape_b);
+    copy_data(b, vector<int8_t>{1, -1, 2, -3, 3, 1});
+    auto c = backend->create_tensor(element::i32, Shape{2});
+    copy_data(c, vector<int32_t>{2, 5});
+    auto result = backend->create_tensor(element::u8, shape_r);
+
+    // accumulators plus bias  16    1   34   -8
+    // times scale              8  0.5   17   -4
+    auto handle = backend->compile(f);
+    backend->call_with_validate(handle, {result}, {a, b, c});
+    EXPECT_EQ((vector<uint8_t>{8, 0, 17, 0}), read_vector<uint8_t>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, quantized_dot_int32)
+{
+    Shape shape_a{2, 3};
+    Shape shape_b{3, 2};
+    Shape shape_r{2, 2};
+    auto A = make_shared<op::Parameter>(element::u8, shape_a);
+    auto B = make_shared<op::Parameter>(element::i8, shape_b);
+    auto scale = op::Constant::create(element::f32, Shape{}, {1.0f});
+    auto qdot = make_shared<op::QuantizedDot>(A, B, scale, false);
+    auto f = make_shared<Function>(qdot, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::u8, shape_a);
+    copy_data(a, vector<uint8_t>{1, 2, 3, 4, 5, 6});
+    auto b = backend->create_tensor(element::i8, shape_b);
+    copy_data(b, vector<int8_t>{1, -1, 2, -3, 3, 1});
+    auto result = backend->create_tensor(element::i32, shape_r);
+
+    auto handle = backend->compile(f);
+    backend->call_with_validate(handle, {result}, {a, b});
+    EXPECT_EQ((vector<int32_t>{14, -4, 32, -13}), read_vector<int32_t>(result));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, shape_of_scalar)
 {
     Shape input_shape{};
@@ -802,6 +802,70 @@ TEST(builder, scaled_QC_with_f32_bias_and_relu)
     EXPECT_EQ((vector<uint8_t>{0, 0, 0, 0, 0, 0, 191, 255, 234}), read_vector<uint8_t>(result));
 }
 
+TEST(builder, scaled_QD)
+{
+    Shape shape_a{2, 3}; // input shape
+    Shape shape_b{3, 2}; // weights shape
+    Shape shape_r{2, 2}; // output shape
+    vector<uint8_t> a_data = {1, 2, 3, 4, 5, 6};
+    vector<int8_t> b_data = {1, -1, 2, -3, 3, 1};
+    auto A = make_shared<op::Parameter>(element::u8, shape_a);
+    auto B = make_shared<op::Parameter>(element::i8, shape_b);
+    auto C = op::Constant::create(element::f32, Shape{1}, {0.0f});
+    auto D = op::Constant::create(element::f32, Shape{1}, {255.0f});
+    auto E = op::Constant::create(element::f32, Shape{1}, {-127.0f});
+    auto F = op::Constant::create(element::f32, Shape{1}, {127.0f});
+    auto G = op::Constant::create(element::f32, Shape{1}, {-127.0f});
+    auto H = op::Constant::create(element::f32, Shape{1}, {127.0f});
+    auto QD = ngraph::builder::ScaledQuantizedDot(A, B, C, D, E, F, G, H);
+    auto f = make_shared<Function>(NodeVector{QD}, ParameterVector{A, B});
+    constant_fold(f);
+    auto backend = runtime::Backend::create("CPU");
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::u8, shape_a);
+    copy_data(a, a_data);
+    auto b = backend->create_tensor(element::i8, shape_b);
+    copy_data(b, b_data);
+    auto result = backend->create_tensor(element::i8, shape_r);
+    auto handle = backend->compile(f);
+    backend->call_with_validate(handle, {result}, {a, b});
+    EXPECT_EQ((vector<int8_t>{14, -4, 32, -13}), read_vector<int8_t>(result));
+}
+
+TEST(builder, scaled_QD_with_bias_and_relu)
+{
+    Shape shape_a{2, 3}; // input shape
+    Shape shape_b{3, 2}; // weights shape
+    Shape shape_r{2, 2}; // output shape
+    vector<uint8_t> a_data = {1, 2, 3, 4, 5, 6};
+    vector<int8_t> b_data = {1, -1, 2, -3, 3, 1};
+    vector<int32_t> c_data = {2, 5};
+    auto A = make_shared<op::Parameter>(element::u8, shape_a);
+    auto B = make_shared<op::Parameter>(element::i8, shape_b);
+    auto Bias = make_shared<op::Parameter>(element::i32, Shape{2});
+    auto C = op::Constant::create(element::f32, Shape{1}, {0.0f});
+    auto D = op::Constant::create(element::f32, Shape{1}, {255.0f});
+    auto E = op::Constant::create(element::f32, Shape{1}, {-127.0f});
+    auto F = op::Constant::create(element::f32, Shape{1}, {127.0f});
+    auto G = op::Constant::create(element::f32, Shape{1}, {0.0f});
+    auto H = op::Constant::create(element::f32, Shape{1}, {255.0f});
+    auto QD = ngraph::builder::ScaledQuantizedDotBias(A, B, Bias, C, D, E, F, G, H, true);
+    auto f = make_shared<Function>(NodeVector{QD}, ParameterVector{A, B, Bias});
+    constant_fold(f);
+    auto backend = runtime::Backend::create("CPU");
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::u8, shape_a);
+    copy_data(a, a_data);
+    auto b = backend->create_tensor(element::i8, shape_b);
+    copy_data(b, b_data);
+    auto c = backend->create_tensor(element::i32, Shape{2});
+    copy_data(c, c_data);
+    auto result = backend->create_tensor(element::u8, shape_r);
+    auto handle = backend->compile(f);
+    backend->call_with_validate(handle, {result}, {a, b, c});
+    EXPECT_EQ((vector<uint8_t>{16, 1, 34, 0}), read_vector<uint8_t>(result));
+}
+
 TEST(builder, scaled_Q_unsigned)
 {
     vector<float> a_data = {-255.0, 0.0, 1.0, 1.25, 1.75, 64.0, 127.0, 500.0};
@@ -0,0 +1,103 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/constant_deduplication.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(constant_deduplication, within_function)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto c1 = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto c2 = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto c3 = op::Constant::create(element::f32, shape, {4, 3, 2, 1});
+    auto f = make_shared<Function>(NodeVector{A + c1, A * c2, A - c3}, ParameterVector{A});
+
+    pass::ConstantDeduplication dedup;
+    dedup.run_on_function(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 2);
+    auto add = f->get_results().at(0)->get_argument(0);
+    auto multiply = f->get_results().at(1)->get_argument(0);
+    auto subtract = f->get_results().at(2)->get_argument(0);
+    EXPECT_EQ(add->get_argument(1), multiply->get_argument(1));
+    EXPECT_EQ(subtract->get_argument(1), c3);
+    EXPECT_EQ(dedup.get_bytes_saved(), shape_size(shape) * sizeof(float));
+}
+
+TEST(constant_deduplication, type_and_shape_must_match)
+{
+    // The same four bytes of zeros as f32 {1}, i32 {1} and i8 {4}, {2, 2}
+    auto A = make_shared<op::Parameter>(element::f32, Shape{1});
+    auto B = make_shared<op::Parameter>(element::i32, Shape{1});
+    auto C = make_shared<op::Parameter>(element::i8, Shape{4});
+    auto D = make_shared<op::Parameter>(element::i8, Shape{2, 2});
+    auto f = make_shared<Function>(
+        NodeVector{A + op::Constant::create(element::f32, Shape{1}, {0}),
+                   B + op::Constant::create(element::i32, Shape{1}, {0}),
+                   C + op::Constant::create(element::i8, Shape{4}, {0, 0, 0, 0}),
+                   D + op::Constant::create(element::i8, Shape{2, 2}, {0, 0, 0, 0})},
+        ParameterVector{A, B, C, D});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantDeduplication>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 4);
+}
+
+TEST(constant_deduplication, across_functions)
+{
+    Shape shape{3};
+    auto make_function = [&](float bias) {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto weights = op::Constant::create(element::f32, shape, {1, 2, 3});
+        auto other = op::Constant::create(element::f32, shape, {bias, bias, bias});
+        return make_shared<Function>(A * weights + other, ParameterVector{A});
+    };
+    auto get_weights = [](const shared_ptr<Function>& f) {
+        auto add = f->get_results().at(0)->get_argument(0);
+        return static_pointer_cast<op::Constant>(add->get_argument(0)->get_argument(1));
+    };
+
+    auto store = make_shared<pass::ConstantStore>();
+    auto f = make_function(0);
+    auto g = make_function(1);
+    for (auto function : {f, g})
+    {
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::ConstantDeduplication>(store);
+        pass_manager.run_passes(function);
+    }
+
+    // g reads the weights of f, its other constant is unique
+    EXPECT_NE(get_weights(f), get_weights(g));
+    EXPECT_EQ(get_weights(f)->get_data_ptr(), get_weights(g)->get_data_ptr());
+    EXPECT_EQ((vector<float>{1, 2, 3}), get_weights(g)->get_vector<float>());
+    EXPECT_EQ(store->get_bytes_saved(), shape_size(shape) * sizeof(float));
+
+    // The shared data outlives the Function it came from
+    f.reset();
+    EXPECT_EQ((vector<float>{1, 2, 3}), get_weights(g)->get_vector<float>());
+}
@@ -28,6 +28,7 @@
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/batch_norm.hpp"
 #include "ngraph/op/concat.hpp"
+#include "ngraph/op/experimental/quantized_dot.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/negative.hpp"
@@ -67,6 +68,7 @@
 #include "ngraph/runtime/cpu/pass/cpu_loop_kernel_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_quant_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_workspace_insertion.hpp"
 #include "ngraph/serializer.hpp"
@@ -162,6 +164,40 @@ TEST(cpu_fusion, gemm_cpu_broadcast_row)
     EXPECT_EQ(read_vector<float>(result), expected);
 }
 
+TEST(cpu_fusion, gemm_cpu_packed_constant_weights)
+{
+    Shape shapeA{3, 2};
+    Shape shapeB{2, 3};
+    Shape shapeC{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shapeA);
+    auto B = op::Constant::create<float>(
+        element::f32, shapeB, std::vector<float>{3.0f, 3.0f, 3.0f, 9.0f, 9.0f, 9.0f});
+
+    auto bias = op::Constant::create<float>(element::f32, Shape{2}, std::vector<float>{2.0f, 3.0f});
+
+    auto cg = make_shared<op::MatmulBias>(
+        A, B, bias, A->get_shape(), B->get_shape(), true, true, AxisSet{0});
+
+    auto f = make_shared<Function>(cg, ParameterVector{A});
+
+    auto backend = runtime::Backend::create("CPU");
+
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shapeA);
+    shared_ptr<runtime::Tensor> result = backend->create_tensor(element::f32, shapeC);
+
+    vector<float> dataA{1.0f, 4.0f, 1.0f, 4.0f, 1.0f, 4.0f};
+    copy_data(a, dataA);
+
+    auto handle = backend->compile(f);
+    vector<float> expected{11, 30, 38, 111};
+    // The packed weights must be reusable across calls
+    for (size_t i = 0; i < 2; i++)
+    {
+        backend->call_with_validate(handle, {result}, {a});
+        EXPECT_EQ(read_vector<float>(result), expected);
+    }
+}
+
 TEST(cpu_fusion, gemm_cpu_broadcast_column)
 {
     Shape shapeA{3, 2};
@@ -3438,3 +3474,452 @@ TEST(cpu_fusion, rnn_input_fusion_inter_vs_cpu)
         EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
     }
 }
+
+// Builds GRU (3 gates) or vanilla RNN (1 gate) cells unrolled over `timesteps`, decomposed
+// the way the ONNX importer does it, or LSTM (4 gates) cells decomposed the way LSTMFusion
+// matches them, with transposed weights. LSTM functions also return the last cell state. A
+// bidirectional function adds a second chain of cells, with its own weights, that reads the
+// same inputs from the last timestep to the first.
+static shared_ptr<Function>
+    create_rnn_cells_function(size_t timesteps, size_t gates, bool bidirectional = false)
+{
+    const size_t batch = 2;
+    const size_t input_size = 4;
+    const size_t hidden_size = 3;
+    const Shape state_shape{batch, hidden_size};
+
+    ParameterVector params;
+    NodeVector xs;
+    for (size_t t = 0; t < timesteps; t++)
+    {
+        auto xt = make_shared<op::Parameter>(element::f32, Shape{batch, input_size});
+        params.push_back(xt);
+        xs.push_back(xt);
+    }
+
+    auto gate = [&](const shared_ptr<Node>& gates_node, size_t index) {
+        return make_shared<op::Slice>(gates_node,
+                                      Coordinate{0, index * hidden_size},
+                                      Coordinate{batch, (index + 1) * hidden_size});
+    };
+    auto add_bias = [&](const shared_ptr<Node>& node, const shared_ptr<Node>& bias) {
+        return node + make_shared<op::Broadcast>(bias, node->get_shape(), AxisSet{0});
+    };
+    auto ones = make_shared<op::Broadcast>(
+        op::Constant::create(element::f32, Shape{}, {1}), state_shape, AxisSet{0, 1});
+
+    NodeVector outputs;
+    for (size_t direction = 0; direction < (bidirectional ? 2 : 1); direction++)
+    {
+        auto W = make_shared<op::Parameter>(element::f32, Shape{input_size, gates * hidden_size});
+        auto Wb = make_shared<op::Parameter>(element::f32, Shape{gates * hidden_size});
+        auto R = make_shared<op::Parameter>(element::f32, Shape{hidden_size, hidden_size});
+        auto Rb = make_shared<op::Parameter>(element::f32, Shape{hidden_size});
+        auto R_ur =
+            make_shared<op::Parameter>(element::f32, Shape{hidden_size, 2 * hidden_size});
+        auto Rb_ur = make_shared<op::Parameter>(element::f32, Shape{2 * hidden_size});
+        auto W_lstm =
+            make_shared<op::Parameter>(element::f32, Shape{gates * hidden_size, input_size});
+        auto R_lstm =
+            make_shared<op::Parameter>(element::f32, Shape{gates * hidden_size, hidden_size});
+        auto Rb_lstm = make_shared<op::Parameter>(element::f32, Shape{gates * hidden_size});
+        if (gates == 4)
+        {
+            params.insert(params.end(), {W_lstm, Wb, R_lstm, Rb_lstm});
+        }
+        else
+        {
+            params.insert(params.end(), {W, Wb, R, Rb});
+        }
+        if (gates == 3)
+        {
+            params.push_back(R_ur);
+            params.push_back(Rb_ur);
+        }
+        auto W_lstm_t = make_shared<op::Reshape>(
+            W_lstm, AxisVector{1, 0}, Shape{input_size, gates * hidden_size});
+        auto R_lstm_t = make_shared<op::Reshape>(
+            R_lstm, AxisVector{1, 0}, Shape{hidden_size, gates * hidden_size});
+
+        shared_ptr<Node> ht = make_shared<op::Broadcast>(
+            op::Constant::create(element::f32, Shape{}, {0}), state_shape, AxisSet{0, 1});
+        shared_ptr<Node> ct = make_shared<op::Broadcast>(
+            op::Constant::create(element::f32, Shape{}, {0}), state_shape, AxisSet{0, 1});
+        for (size_t step = 0; step < timesteps; step++)
+        {
+            auto xt = xs[direction == 0 ? step : timesteps - 1 - step];
+            if (gates == 4)
+            {
+                auto x_gates = add_bias(make_shared<op::Dot>(xt, W_lstm_t), Wb);
+                auto h_gates = add_bias(make_shared<op::Dot>(ht, R_lstm_t), Rb_lstm);
+                auto all_gates = h_gates + x_gates;
+                auto it = make_shared<op::Sigmoid>(gate(all_gates, 0));
+                auto ft = make_shared<op::Sigmoid>(gate(all_gates, 1));
+                auto gt = make_shared<op::Tanh>(gate(all_gates, 2));
+                auto ot = make_shared<op::Sigmoid>(gate(all_gates, 3));
+                ct = ft * ct + it * gt;
+                ht = ot * make_shared<op::Tanh>(ct);
+                outputs.push_back(ht);
+                continue;
+            }
+            auto x_gates = add_bias(make_shared<op::Dot>(xt, W), Wb);
+            if (gates == 1)
+            {
+                ht = make_shared<op::Tanh>(x_gates + add_bias(make_shared<op::Dot>(ht, R), Rb));
+            }
+            else
+            {
+                auto h_gates = add_bias(make_shared<op::Dot>(ht, R_ur), Rb_ur);
+                auto ut = make_shared<op::Sigmoid>(gate(x_gates, 0) + gate(h_gates, 0));
+                auto rt = make_shared<op::Sigmoid>(gate(x_gates, 1) + gate(h_gates, 1));
+                auto ct = make_shared<op::Tanh>(gate(x_gates, 2) +
+                                                add_bias(make_shared<op::Dot>(rt * ht, R), Rb));
+                ht = (ones - ut) * ct + ut * ht;
+            }
+            outputs.push_back(ht);
+        }
+        if (gates == 4)
+        {
+            outputs.push_back(ct);
+        }
+    }
+    return make_shared<Function>(outputs, params);
+}
+
+TEST(cpu_fusion, fuse_gru_cells)
+{
+    auto func = create_rnn_cells_function(3, 3);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::RNNCellFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::RNNFusion>();
+    pass_manager.run_passes(func);
+    auto rnn_ops = get_ops_of_type<op::Rnn>(func);
+    ASSERT_EQ(rnn_ops.size(), 1);
+    EXPECT_EQ(rnn_ops[0]->get_num_timesteps(), 3);
+    EXPECT_EQ(rnn_ops[0]->get_gates_per_cell(), 3);
+    EXPECT_EQ(rnn_ops[0]->get_num_cell_states(), 1);
+}
+
+TEST(cpu_fusion, fuse_vanilla_rnn_cells)
+{
+    auto func = create_rnn_cells_function(3, 1);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::RNNCellFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::RNNFusion>();
+    pass_manager.run_passes(func);
+    auto rnn_ops = get_ops_of_type<op::Rnn>(func);
+    ASSERT_EQ(rnn_ops.size(), 1);
+    EXPECT_EQ(rnn_ops[0]->get_num_timesteps(), 3);
+    EXPECT_EQ(rnn_ops[0]->get_gates_per_cell(), 1);
+    EXPECT_EQ(rnn_ops[0]->get_num_cell_states(), 1);
+}
+
+// tanh(x * W1 + b1 + p * W2 + b2) with a square W2 looks like a vanilla RNN cell, but nothing
+// feeds its output back through W2
+TEST(cpu_fusion, dense_tanh_is_not_rnn_cell)
+{
+    auto X = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+    auto P = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto W1 = make_shared<op::Parameter>(element::f32, Shape{4, 3});
+    auto W2 = make_shared<op::Parameter>(element::f32, Shape{3, 3});
+    auto b1 = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto b2 = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto add_bias = [](const shared_ptr<Node>& node, const shared_ptr<Node>& bias) {
+        return node + make_shared<op::Broadcast>(bias, node->get_shape(), AxisSet{0});
+    };
+    auto dense = make_shared<op::Tanh>(add_bias(make_shared<op::Dot>(X, W1), b1) +
+                                       add_bias(make_shared<op::Dot>(P, W2), b2));
+    auto func = make_shared<Function>(NodeVector{dense}, ParameterVector{X, P, W1, W2, b1, b2});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::RNNCellFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::RNNFusion>();
+    pass_manager.run_passes(func);
+    EXPECT_EQ(count_ops_of_type<op::Rnn>(func), 0);
+    EXPECT_EQ(count_ops_of_type<op::Dot>(func), 2);
+}
+
+static void check_rnn_cells_inter_vs_cpu(size_t gates, bool bidirectional = false)
+{
+    shared_ptr<Function> cpu_func = create_rnn_cells_function(3, gates, bidirectional);
+    shared_ptr<Function> int_func = create_rnn_cells_function(3, gates, bidirectional);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_func->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_results = execute(int_func, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_func, args, "CPU");
+    auto rnn_ops = get_ops_of_type<op::Rnn>(cpu_func);
+    ASSERT_EQ(rnn_ops.size(), 1);
+    EXPECT_EQ(rnn_ops[0]->get_direction(), bidirectional ? 2 : 1);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(cpu_fusion, gru_fusion_inter_vs_cpu)
+{
+    check_rnn_cells_inter_vs_cpu(3);
+}
+
+TEST(cpu_fusion, vanilla_rnn_fusion_inter_vs_cpu)
+{
+    check_rnn_cells_inter_vs_cpu(1);
+}
+
+TEST(cpu_fusion, fuse_bidirectional_rnn_cells)
+{
+    auto func = create_rnn_cells_function(3, 3, true);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::RNNCellFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::RNNFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::BiDirectionalRNNFusion>();
+    pass_manager.run_passes(func);
+    auto rnn_ops = get_ops_of_type<op::Rnn>(func);
+    ASSERT_EQ(rnn_ops.size(), 1);
+    EXPECT_EQ(rnn_ops[0]->get_direction(), 2);
+    EXPECT_EQ(rnn_ops[0]->get_num_timesteps(), 3);
+    EXPECT_EQ(rnn_ops[0]->get_output_shape(0), (Shape{6, 6}));
+    EXPECT_EQ(rnn_ops[0]->get_output_shape(1), (Shape{4, 3}));
+}
+
+TEST(cpu_fusion, bidirectional_gru_fusion_inter_vs_cpu)
+{
+    check_rnn_cells_inter_vs_cpu(3, true);
+}
+
+TEST(cpu_fusion, bidirectional_vanilla_rnn_fusion_inter_vs_cpu)
+{
+    check_rnn_cells_inter_vs_cpu(1, true);
+}
+
+TEST(cpu_fusion, fuse_bidirectional_lstm_cells)
+{
+    auto func = create_rnn_cells_function(3, 4, true);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::LSTMFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::RNNFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::BiDirectionalRNNFusion>();
+    pass_manager.run_passes(func);
+    auto rnn_ops = get_ops_of_type<op::Rnn>(func);
+    ASSERT_EQ(rnn_ops.size(), 1);
+    EXPECT_EQ(rnn_ops[0]->get_direction(), 2);
+    EXPECT_EQ(rnn_ops[0]->get_num_timesteps(), 3);
+    EXPECT_EQ(rnn_ops[0]->get_gates_per_cell(), 4);
+    EXPECT_EQ(rnn_ops[0]->get_num_cell_states(), 2);
+    EXPECT_EQ(rnn_ops[0]->get_output_shape(0), (Shape{6, 6}));
+    // {ht | ct} of the left to right direction, then of the right to left one
+    EXPECT_EQ(rnn_ops[0]->get_output_shape(1), (Shape{8, 3}));
+}
+
+TEST(cpu_fusion, lstm_fusion_inter_vs_cpu)
+{
+    check_rnn_cells_inter_vs_cpu(4);
+}
+
+TEST(cpu_fusion, bidirectional_lstm_fusion_inter_vs_cpu)
+{
+    check_rnn_cells_inter_vs_cpu(4, true);
+}
+
+// Runs a vanilla Rnn over a ragged batch and compares each sequence with a run of the same
+// Rnn over that sequence alone
+static void check_rnn_sequence_lengths(size_t direction)
+{
+    const size_t timesteps = 4;
+    const size_t batch = 3;
+    const size_t feature_size = 5;
+    const vector<int32_t> lengths{2, 4, 0};
+
+    auto backend = runtime::Backend::create("CPU");
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    auto make_tensor = [&](const Shape& shape) {
+        auto tensor = backend->create_tensor(element::f32, shape);
+        vector<float> values(shape_size(shape));
+        rng.initialize(values);
+        copy_data(tensor, values);
+        return tensor;
+    };
+    auto weights_layer = make_tensor(Shape{direction * feature_size, feature_size});
+    auto weights_iter = make_tensor(Shape{direction * feature_size, feature_size});
+    auto bias = make_tensor(Shape{direction * feature_size});
+
+    // Runs the Rnn over `steps` timesteps of `batch_size` sequences
+    auto run = [&](size_t steps,
+                   size_t batch_size,
+                   shared_ptr<runtime::Tensor> src_layer,
+                   shared_ptr<runtime::Tensor> src_iter,
+                   shared_ptr<runtime::Tensor> sequence_lengths) {
+        ParameterVector params;
+        NodeVector args;
+        for (auto tensor : {src_layer, src_iter, weights_layer, weights_iter, bias})
+        {
+            params.push_back(make_shared<op::Parameter>(element::f32, tensor->get_shape()));
+            args.push_back(params.back());
+        }
+        if (sequence_lengths)
+        {
+            params.push_back(make_shared<op::Parameter>(element::i32, Shape{batch_size}));
+            args.push_back(params.back());
+        }
+        shared_ptr<op::Rnn> rnn;
+        if (sequence_lengths)
+        {
+            rnn = make_shared<op::Rnn>(args[0],
+                                       args[1],
+                                       args[2],
+                                       args[3],
+                                       args[4],
+                                       args[5],
+                                       steps,
+                                       1,
+                                       steps,
+                                       1,
+                                       direction,
+                                       1);
+        }
+        else
+        {
+            rnn = make_shared<op::Rnn>(
+                args[0], args[1], args[2], args[3], args[4], steps, 1, steps, 1, direction, 1);
+        }
+        auto f = make_shared<Function>(NodeVector{make_shared<op::GetOutputElement>(rnn, 0),
+                                                  make_shared<op::GetOutputElement>(rnn, 1)},
+                                       params);
+
+        auto dst_layer = backend->create_tensor(element::f32, rnn->get_output_shape(0));
+        auto dst_iter = backend->create_tensor(element::f32, rnn->get_output_shape(1));
+        vector<shared_ptr<runtime::Tensor>> inputs{
+            src_layer, src_iter, weights_layer, weights_iter, bias};
+        if (sequence_lengths)
+        {
+            inputs.push_back(sequence_lengths);
+        }
+        auto handle = backend->compile(f);
+        backend->call_with_validate(handle, {dst_layer, dst_iter}, inputs);
+        return make_pair(read_vector<float>(dst_layer), read_vector<float>(dst_iter));
+    };
+
+    auto src_layer = make_tensor(Shape{timesteps * batch, feature_size});
+    auto src_iter = make_tensor(Shape{direction * batch, feature_size});
+    auto sequence_lengths = backend->create_tensor(element::i32, Shape{batch});
+    copy_data(sequence_lengths, lengths);
+    auto ragged = run(timesteps, batch, src_layer, src_iter, sequence_lengths);
+
+    vector<float> src_layer_values = read_vector<float>(src_layer);
+    vector<float> src_iter_values = read_vector<float>(src_iter);
+    const size_t row_size = direction * feature_size;
+    for (size_t n = 0; n < batch; n++)
+    {
+        size_t length = lengths[n];
+        vector<float> expected_dst_layer(timesteps * row_size, 0);
+        vector<float> expected_dst_iter;
+        for (size_t d = 0; d < direction; d++)
+        {
+            auto row = src_iter_values.begin() + (d * batch + n) * feature_size;
+            expected_dst_iter.insert(expected_dst_iter.end(), row, row + feature_size);
+        }
+        if (length > 0)
+        {
+            vector<float> sequence;
+            for (size_t t = 0; t < length; t++)
+            {
+                auto row = src_layer_values.begin() + (t * batch + n) * feature_size;
+                sequence.insert(sequence.end(), row, row + feature_size);
+            }
+            auto sequence_src_layer =
+                backend->create_tensor(element::f32, Shape{length, feature_size});
+            copy_data(sequence_src_layer, sequence);
+            auto sequence_src_iter =
+                backend->create_tensor(element::f32, Shape{direction, feature_size});
+            copy_data(sequence_src_iter, expected_dst_iter);
+            auto single = run(length, 1, sequence_src_layer, sequence_src_iter, nullptr);
+            copy(single.first.begin(), single.first.end(), expected_dst_layer.begin());
+            expected_dst_iter = single.second;
+        }
+
+        vector<float> dst_layer;
+        for (size_t t = 0; t < timesteps; t++)
+        {
+            auto row = ragged.first.begin() + (t * batch + n) * row_size;
+            dst_layer.insert(dst_layer.end(), row, row + row_size);
+        }
+        vector<float> dst_iter;
+        for (size_t d = 0; d < direction; d++)
+        {
+            auto row = ragged.second.begin() + (d * batch + n) * feature_size;
+            dst_iter.insert(dst_iter.end(), row, row + feature_size);
+        }
+        EXPECT_TRUE(test::all_close(expected_dst_layer, dst_layer, 1.0e-4f, 1.0e-4f));
+        EXPECT_TRUE(test::all_close(expected_dst_iter, dst_iter, 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(cpu_fusion, rnn_sequence_lengths)
+{
+    check_rnn_sequence_lengths(1);
+}
+
+TEST(cpu_fusion, bidirectional_rnn_sequence_lengths)
+{
+    check_rnn_sequence_lengths(2);
+}
+
+TEST(cpu_fusion, qdot_bias_relu)
+{
+    Shape shape_a{2, 3};
+    Shape shape_b{3, 2};
+    Shape shape_r{2, 2};
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::u8, shape_a);
+        auto B = make_shared<op::Parameter>(element::i8, shape_b);
+        auto u8_zero = op::Constant::create(element::u8, Shape{}, {0});
+        auto i8_zero = op::Constant::create(element::i8, Shape{}, {0});
+        auto a_scale = op::Constant::create(element::f32, Shape{}, {0.5f});
+        auto b_scale = op::Constant::create(element::f32, Shape{}, {0.25f});
+        auto out_scale = op::Constant::create(element::f32, Shape{}, {0.25f});
+        auto bias = op::Constant::create(element::f32, Shape{2}, {0.25f, 0.625f});
+
+        auto dq_a = make_shared<op::Dequantize>(A, a_scale, u8_zero, element::f32, AxisSet{});
+        auto dq_b = make_shared<op::Dequantize>(B, b_scale, i8_zero, element::f32, AxisSet{});
+        auto dot = make_shared<op::Dot>(dq_a, dq_b);
+        auto relu =
+            make_shared<op::Relu>(dot + make_shared<op::Broadcast>(bias, shape_r, AxisSet{0}));
+        auto q = make_shared<op::Quantize>(relu,
+                                           out_scale,
+                                           u8_zero,
+                                           element::u8,
+                                           AxisSet{},
+                                           op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN);
+        return make_shared<Function>(q, ParameterVector{A, B});
+    };
+
+    auto fused_f = make_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUQuantFusion>();
+    pass_manager.run_passes(fused_f);
+    ASSERT_EQ(count_ops_of_type<op::QuantizedDotBias>(fused_f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Dot>(fused_f), 0);
+
+    // 0.125 * (acc + {2, 5}) / 0.25 = {8, 0.5, 17, -4} before rounding and relu
+    for (auto backend_name : {"CPU", "INTERPRETER"})
+    {
+        auto f = make_function();
+        auto backend = runtime::Backend::create(backend_name);
+        auto a = backend->create_tensor(element::u8, shape_a);
+        copy_data(a, vector<uint8_t>{1, 2, 3, 4, 5, 6});
+        auto b = backend->create_tensor(element::i8, shape_b);
+        copy_data(b, vector<int8_t>{1, -1, 2, -3, 3, 1});
+        auto result = backend->create_tensor(element::u8, shape_r);
+        auto handle = backend->compile(f);
+        backend->call_with_validate(handle, {result}, {a, b});
+        EXPECT_EQ((vector<uint8_t>{8, 0, 17, 0}), read_vector<uint8_t>(result)) << backend_name;
+    }
+}
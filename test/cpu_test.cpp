@@ -19,6 +19,8 @@
 #include <iostream>
 #include <list>
 #include <memory>
+#include <numeric>
+#include <thread>
 
 #include "gtest/gtest.h"
 #include "ngraph/autodiff/adjoints.hpp"
@@ -27,10 +29,16 @@
 #include "ngraph/log.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/batch_norm.hpp"
+#include "ngraph/op/experimental/quantized_dot.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/mixed_precision.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/quantization/calibration.hpp"
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
@@ -667,3 +675,1260 @@ TEST(cpu_test, convolution_large_padding)
     auto cpu_f = make_function();
     compare_backends(int_f, cpu_f, "INTERPRETER", "CPU", 1e-4, 1e-4);
 }
+
+TEST(cpu_test, inter_op_parallel_branches)
+{
+    // Large enough that the branches take longer than waking another worker
+    Shape shape{512, 512};
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        // Four independent branches joined at the end
+        auto b0 = make_shared<op::Tanh>(A + B);
+        auto b1 = make_shared<op::Sigmoid>(A * B);
+        auto b2 = make_shared<op::Exp>(make_shared<op::Negative>(A - B));
+        auto b3 = make_shared<op::Abs>(make_shared<op::Maximum>(A, B));
+        auto sum = (b0 + b1) * (b2 + b3);
+        return make_shared<Function>(NodeVector{sum, b2}, ParameterVector{A, B});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+
+    auto cpu_backend = static_cast<runtime::cpu::CPU_Backend*>(backend.get());
+    cpu_backend->set_inter_op_parallelism(cpu_f, 4);
+    backend->enable_performance_data(cpu_f, true);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+
+    backend->compile(cpu_f);
+    ASSERT_THROW(cpu_backend->set_inter_op_parallelism(cpu_f, 2), runtime_error);
+
+    vector<shared_ptr<runtime::Tensor>> inputs;
+    for (size_t i = 0; i < args.size(); i++)
+    {
+        inputs.push_back(backend->create_tensor(element::f32, shape));
+        copy_data(inputs.back(), args.at(i));
+    }
+    auto result0 = backend->create_tensor(element::f32, shape);
+    auto result1 = backend->create_tensor(element::f32, shape);
+    for (size_t iteration = 0; iteration < 3; iteration++)
+    {
+        backend->call_with_validate(cpu_f, {result0, result1}, inputs);
+        EXPECT_TRUE(test::all_close(read_vector<float>(result0), int_results.at(0)));
+        EXPECT_TRUE(test::all_close(read_vector<float>(result1), int_results.at(1)));
+    }
+
+    for (auto& counter : backend->get_performance_data(cpu_f))
+    {
+        EXPECT_EQ(counter.call_count(), 3);
+    }
+    // The four branches are ready at the same time, so with more than one core at least two
+    // of them overlap
+    if (thread::hardware_concurrency() > 1)
+    {
+        EXPECT_GE(cpu_backend->get_max_concurrent_ops(cpu_f), 2);
+    }
+}
+
+TEST(cpu_test, dot_constant_weights)
+{
+    Shape shape_x{4, 64};
+    Shape shape_w{64, 32};
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> weights(shape_size(shape_w));
+    rng.initialize(weights);
+
+    auto make_function = [&]() {
+        auto X = make_shared<op::Parameter>(element::f32, shape_x);
+        auto W = op::Constant::create(element::f32, shape_w, weights);
+        auto dot = make_shared<op::Dot>(X, W);
+        return make_shared<Function>(NodeVector{dot}, ParameterVector{X});
+    };
+
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+    compare_backends(int_f, cpu_f, "INTERPRETER", "CPU", 1e-4, 1e-5);
+}
+
+TEST(cpu_test, calibration_statistics_percentile)
+{
+    vector<float> values(1000);
+    iota(values.begin(), values.end(), 0.0f);
+    values.push_back(1e6f);
+
+    quantization::TensorStatistics stats;
+    stats.update(values.data(), values.size());
+    EXPECT_EQ(stats.get_min(), 0.0f);
+    EXPECT_EQ(stats.get_max(), 1e6f);
+    // The outlier is clipped away, at the resolution of the histogram bins
+    float clipped = stats.get_percentile_abs(99.9f);
+    EXPECT_GE(clipped, 999.0f);
+    EXPECT_LE(clipped, 1024.0f);
+    EXPECT_EQ(stats.get_percentile_abs(100.0f), 1e6f);
+}
+
+TEST(cpu_test, calibration_dot_relu)
+{
+    Shape shape_x{4, 64};
+    Shape shape_w{64, 32};
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> weights(shape_size(shape_w));
+    rng.initialize(weights);
+
+    auto X = make_shared<op::Parameter>(element::f32, shape_x);
+    auto W = op::Constant::create(element::f32, shape_w, weights);
+    auto relu = make_shared<op::Relu>(make_shared<op::Dot>(X, W));
+    auto f = make_shared<Function>(NodeVector{relu}, ParameterVector{X});
+
+    auto backend = runtime::Backend::create("CPU");
+    test::Uniform<float> input_rng(0.0f, 1.0f);
+    quantization::Calibrator calibrator(f);
+    vector<shared_ptr<runtime::Tensor>> inputs;
+    for (size_t i = 0; i < 8; i++)
+    {
+        auto x = backend->create_tensor(element::f32, shape_x);
+        input_rng.initialize(x);
+        inputs.push_back(x);
+        calibrator.add_sample({x});
+    }
+    EXPECT_EQ(calibrator.get_sample_count(), 8);
+
+    auto qf = calibrator.quantize();
+    ASSERT_EQ(count_ops_of_type<op::QuantizedDot>(qf), 1);
+    ASSERT_EQ(count_ops_of_type<op::Dot>(qf), 0);
+    ASSERT_EQ(count_ops_of_type<op::Relu>(qf), 0);
+    // the source function is left as it was
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 1);
+
+    auto expected = backend->create_tensor(element::f32, relu->get_shape());
+    auto actual = backend->create_tensor(element::f32, relu->get_shape());
+    for (auto& x : inputs)
+    {
+        backend->call_with_validate(f, {expected}, {x});
+        backend->call_with_validate(qf, {actual}, {x});
+        EXPECT_TRUE(test::all_close(
+            read_vector<float>(expected), read_vector<float>(actual), 0.05f, 0.1f));
+    }
+}
+
+TEST(cpu_test, bf16_elementwise_sum)
+{
+    Shape shape{4, 16};
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> a(shape_size(shape));
+    vector<float> b(shape_size(shape));
+    rng.initialize(a);
+    rng.initialize(b);
+    vector<bfloat16> a_bf16;
+    vector<bfloat16> b_bf16;
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        a_bf16.push_back(bfloat16(a[i], true));
+        b_bf16.push_back(bfloat16(b[i], true));
+        a[i] = a_bf16[i];
+        b[i] = b_bf16[i];
+    }
+
+    auto make_function = [&](const element::Type& type) {
+        auto A = make_shared<op::Parameter>(type, shape);
+        auto B = make_shared<op::Parameter>(type, shape);
+        auto relu = make_shared<op::Relu>(make_shared<op::Add>(A * B, A));
+        auto sum = make_shared<op::Sum>(relu, AxisSet{1});
+        // Dot over a transposed operand
+        auto BT = make_shared<op::Reshape>(B, AxisVector{1, 0}, Shape{16, 4});
+        auto dot = make_shared<op::Dot>(A, BT);
+        return make_shared<Function>(NodeVector{sum, dot}, ParameterVector{A, B});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto f32_a = backend->create_tensor(element::f32, shape);
+    auto f32_b = backend->create_tensor(element::f32, shape);
+    copy_data(f32_a, a);
+    copy_data(f32_b, b);
+    auto f32_sum = backend->create_tensor(element::f32, Shape{4});
+    auto f32_dot = backend->create_tensor(element::f32, Shape{4, 4});
+    backend->call_with_validate(make_function(element::f32), {f32_sum, f32_dot}, {f32_a, f32_b});
+
+    auto bf16_a = backend->create_tensor(element::bf16, shape);
+    auto bf16_b = backend->create_tensor(element::bf16, shape);
+    copy_data(bf16_a, a_bf16);
+    copy_data(bf16_b, b_bf16);
+    auto bf16_sum = backend->create_tensor(element::bf16, Shape{4});
+    auto bf16_dot = backend->create_tensor(element::bf16, Shape{4, 4});
+    backend->call_with_validate(
+        make_function(element::bf16), {bf16_sum, bf16_dot}, {bf16_a, bf16_b});
+
+    auto to_f32 = [](const vector<bfloat16>& values) {
+        return vector<float>(values.begin(), values.end());
+    };
+    EXPECT_TRUE(test::all_close(
+        read_vector<float>(f32_sum), to_f32(read_vector<bfloat16>(bf16_sum)), 2e-2f, 2e-2f));
+    EXPECT_TRUE(test::all_close(
+        read_vector<float>(f32_dot), to_f32(read_vector<bfloat16>(bf16_dot)), 2e-2f, 2e-2f));
+}
+
+TEST(cpu_test, bf16_dot_convolution)
+{
+    Shape shape_x{2, 3, 6, 5};
+    Shape shape_w{4, 3, 3, 3};
+    Shape shape_m{5, 7};
+    vector<Shape> shapes{shape_x, shape_w, shape_m};
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    vector<vector<bfloat16>> bf16_args;
+    for (const Shape& shape : shapes)
+    {
+        vector<float> values(shape_size(shape));
+        rng.initialize(values);
+        vector<bfloat16> bf16_values;
+        for (float& value : values)
+        {
+            bf16_values.push_back(bfloat16(value, true));
+            value = bf16_values.back();
+        }
+        args.push_back(values);
+        bf16_args.push_back(bf16_values);
+    }
+
+    auto make_function = [&](const element::Type& type) {
+        auto X = make_shared<op::Parameter>(type, shape_x);
+        auto W = make_shared<op::Parameter>(type, shape_w);
+        auto M = make_shared<op::Parameter>(type, shape_m);
+        auto conv = make_shared<op::Convolution>(X,
+                                                 W,
+                                                 Strides{1, 1},
+                                                 Strides{1, 1},
+                                                 CoordinateDiff{1, 1},
+                                                 CoordinateDiff{1, 1});
+        // [2, 4, 6, 5] x [5, 7] reduces the innermost axis of the convolution output
+        auto dot = make_shared<op::Dot>(conv, M);
+        return make_shared<Function>(NodeVector{conv, dot}, ParameterVector{X, W, M});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    vector<shared_ptr<runtime::Tensor>> f32_inputs;
+    vector<shared_ptr<runtime::Tensor>> bf16_inputs;
+    for (size_t i = 0; i < shapes.size(); i++)
+    {
+        f32_inputs.push_back(backend->create_tensor(element::f32, shapes[i]));
+        copy_data(f32_inputs.back(), args[i]);
+        bf16_inputs.push_back(backend->create_tensor(element::bf16, shapes[i]));
+        copy_data(bf16_inputs.back(), bf16_args[i]);
+    }
+    Shape shape_conv{2, 4, 6, 5};
+    Shape shape_dot{2, 4, 6, 7};
+    auto f32_conv = backend->create_tensor(element::f32, shape_conv);
+    auto f32_dot = backend->create_tensor(element::f32, shape_dot);
+    backend->call_with_validate(make_function(element::f32), {f32_conv, f32_dot}, f32_inputs);
+
+    auto bf16_function = make_function(element::bf16);
+    auto bf16_conv = backend->create_tensor(element::bf16, shape_conv);
+    auto bf16_dot = backend->create_tensor(element::bf16, shape_dot);
+    backend->call_with_validate(bf16_function, {bf16_conv, bf16_dot}, bf16_inputs);
+    // Both ops ran on their bf16 kernels rather than through f32 copies
+    EXPECT_EQ(count_ops_of_type<op::Convert>(bf16_function), 0);
+
+    auto to_f32 = [](const vector<bfloat16>& values) {
+        return vector<float>(values.begin(), values.end());
+    };
+    EXPECT_TRUE(test::all_close(
+        read_vector<float>(f32_conv), to_f32(read_vector<bfloat16>(bf16_conv)), 2e-2f, 2e-2f));
+    EXPECT_TRUE(test::all_close(
+        read_vector<float>(f32_dot), to_f32(read_vector<bfloat16>(bf16_dot)), 5e-2f, 5e-2f));
+}
+
+TEST(cpu_test, bf16_sum_unit_axis)
+{
+    // The reduced axis is followed by an axis of length one, which the bf16 kernel skips
+    Shape shape{4, 3, 1};
+    vector<bfloat16> a;
+    vector<float> expected(4, 0);
+    for (size_t i = 0; i < shape_size(shape); i++)
+    {
+        a.push_back(bfloat16(static_cast<float>(i), true));
+        expected[i / 3] += static_cast<float>(i);
+    }
+
+    auto A = make_shared<op::Parameter>(element::bf16, shape);
+    auto sum = make_shared<op::Sum>(A, AxisSet{1});
+    auto f = make_shared<Function>(sum, ParameterVector{A});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a_tensor = backend->create_tensor(element::bf16, shape);
+    copy_data(a_tensor, a);
+    auto result = backend->create_tensor(element::bf16, Shape{4, 1});
+    backend->call_with_validate(f, {result}, {a_tensor});
+
+    vector<bfloat16> values = read_vector<bfloat16>(result);
+    EXPECT_EQ(vector<float>(values.begin(), values.end()), expected);
+}
+
+TEST(cpu_test, mixed_precision_pass)
+{
+    Shape shape_x{8, 32};
+    Shape shape_w{32, 16};
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> weights(shape_size(shape_w));
+    rng.initialize(weights);
+
+    auto make_function = [&]() {
+        auto X = make_shared<op::Parameter>(element::f32, shape_x);
+        auto W = op::Constant::create(element::f32, shape_w, weights);
+        auto relu = make_shared<op::Relu>(make_shared<op::Dot>(X, W));
+        auto softmax = make_shared<op::Softmax>(relu, AxisSet{1});
+        softmax->add_control_dependency(relu);
+        return make_shared<Function>(NodeVector{softmax}, ParameterVector{X});
+    };
+    auto f = make_function();
+    auto mixed = make_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::MixedPrecision>();
+    pass_manager.run_passes(mixed);
+
+    // Softmax has no bf16 kernel and is not in the default low precision set
+    for (auto node : mixed->get_ordered_ops())
+    {
+        if (std::dynamic_pointer_cast<op::Relu>(node))
+        {
+            EXPECT_EQ(node->get_element_type(), element::bf16);
+        }
+        if (std::dynamic_pointer_cast<op::Dot>(node))
+        {
+            EXPECT_EQ(node->get_element_type(), element::bf16);
+        }
+        if (std::dynamic_pointer_cast<op::Softmax>(node))
+        {
+            EXPECT_EQ(node->get_element_type(), element::f32);
+            // The control dependency follows the Relu to its bf16 replacement
+            ASSERT_EQ(node->get_control_dependencies().size(), 1);
+            auto dep = *node->get_control_dependencies().begin();
+            EXPECT_TRUE(std::dynamic_pointer_cast<op::Relu>(dep));
+            EXPECT_EQ(dep->get_element_type(), element::bf16);
+        }
+    }
+    EXPECT_EQ(count_ops_of_type<op::Convert>(mixed), 2);
+    EXPECT_EQ(mixed->get_results().at(0)->get_element_type(), element::f32);
+
+    auto backend = runtime::Backend::create("CPU");
+    auto x = backend->create_tensor(element::f32, shape_x);
+    test::Uniform<float> input_rng(0.0f, 1.0f);
+    input_rng.initialize(x);
+    auto expected = backend->create_tensor(element::f32, Shape{8, 16});
+    auto actual = backend->create_tensor(element::f32, Shape{8, 16});
+    backend->call_with_validate(f, {expected}, {x});
+    backend->call_with_validate(mixed, {actual}, {x});
+    EXPECT_TRUE(test::all_close(
+        read_vector<float>(expected), read_vector<float>(actual), 5e-2f, 1e-3f));
+}
+
+TEST(cpu_test, topk_parallel_matches_interpreter)
+{
+    // one long slice is split into chunks, the batched cases are split across slices
+    vector<tuple<Shape, size_t, size_t>> configs{make_tuple(Shape{1000000}, 0, 10),
+                                                 make_tuple(Shape{1000000}, 0, 5000),
+                                                 make_tuple(Shape{64, 4096}, 1, 16),
+                                                 make_tuple(Shape{3, 20000, 4}, 1, 100)};
+    // few distinct values so that ties have to be ordered the same way on both backends
+    test::Uniform<float> rng(0.0f, 64.0f);
+    auto cpu_backend = runtime::Backend::create("CPU");
+    auto int_backend = runtime::Backend::create("INTERPRETER");
+    for (auto& config : configs)
+    {
+        for (bool compute_max : {true, false})
+        {
+            Shape shape = get<0>(config);
+            size_t axis = get<1>(config);
+            size_t k = get<2>(config);
+            vector<float> input(shape_size(shape));
+            rng.initialize(input);
+            for (float& value : input)
+            {
+                value = floor(value);
+            }
+
+            auto A = make_shared<op::Parameter>(element::f32, shape);
+            auto topk = make_shared<op::TopK>(A, axis, element::i32, k, compute_max);
+            auto indices = make_shared<op::GetOutputElement>(topk, 0);
+            auto values = make_shared<op::GetOutputElement>(topk, 1);
+            auto f = make_shared<Function>(NodeVector{indices, values}, ParameterVector{A});
+
+            vector<vector<int32_t>> result_indices;
+            vector<vector<float>> result_values;
+            for (runtime::Backend* backend : {cpu_backend.get(), int_backend.get()})
+            {
+                auto a = backend->create_tensor(element::f32, shape);
+                copy_data(a, input);
+                auto out_indices = backend->create_tensor(element::i32, indices->get_shape());
+                auto out_values = backend->create_tensor(element::f32, values->get_shape());
+                backend->call_with_validate(f, {out_indices, out_values}, {a});
+                result_indices.push_back(read_vector<int32_t>(out_indices));
+                result_values.push_back(read_vector<float>(out_values));
+            }
+            EXPECT_EQ(result_indices.at(0), result_indices.at(1));
+            EXPECT_EQ(result_values.at(0), result_values.at(1));
+        }
+    }
+}
+
+TEST(cpu_test, reduce_with_custom_function)
+{
+    // f(x, y) = x * y + x has no built-in equivalent and is called for every element
+    auto make_function = []() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{});
+        auto rf = make_shared<Function>(A * B + A, ParameterVector{A, B});
+        auto X = make_shared<op::Parameter>(element::f32, Shape{4, 5, 6});
+        auto init = make_shared<op::Parameter>(element::f32, Shape{});
+        auto reduce = make_shared<op::Reduce>(X, init, rf, AxisSet{0, 2});
+        auto reduce_window =
+            make_shared<op::ReduceWindow>(X, init, rf, Shape{2, 1, 3}, Strides{1, 1, 2});
+        return make_shared<Function>(NodeVector{reduce, reduce_window}, ParameterVector{X, init});
+    };
+
+    vector<float> x(4 * 5 * 6);
+    test::Uniform<float> rng(0.0f, 0.2f);
+    rng.initialize(x);
+    vector<vector<float>> args{x, {0.5f}};
+    auto int_results = execute(make_function(), args, "INTERPRETER");
+    auto cpu_results = execute(make_function(), args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i)));
+    }
+}
+
+TEST(cpu_test, softmax_multiple_axes)
+{
+    // Neither case has an MKLDNN or Eigen kernel, so both take the native fallback
+    auto make_function = [](const element::Type& type, const Shape& shape, const AxisSet& axes) {
+        auto A = make_shared<op::Parameter>(type, shape);
+        return make_shared<Function>(make_shared<op::Softmax>(A, axes), ParameterVector{A});
+    };
+
+    vector<float> a(2 * 3 * 4 * 5);
+    test::Uniform<float> rng(-10.0f, 10.0f);
+    rng.initialize(a);
+    vector<vector<float>> args{a};
+    auto int_results =
+        execute(make_function(element::f32, Shape{2, 3, 4, 5}, AxisSet{0, 2}), args, "INTERPRETER");
+    auto cpu_results =
+        execute(make_function(element::f32, Shape{2, 3, 4, 5}, AxisSet{0, 2}), args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0)));
+
+    vector<double> b(4 * 5 * 6);
+    test::Uniform<double> rng_f64(-10.0, 10.0);
+    rng_f64.initialize(b);
+    vector<vector<double>> args_f64{b};
+    auto int_results_f64 = execute(
+        make_function(element::f64, Shape{4, 5, 6}, AxisSet{0, 2}), args_f64, "INTERPRETER");
+    auto cpu_results_f64 =
+        execute(make_function(element::f64, Shape{4, 5, 6}, AxisSet{0, 2}), args_f64, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results_f64.at(0), int_results_f64.at(0)));
+}
+
+TEST(cpu_test, softmax_trailing_axes_collapsed)
+{
+    // Softmax over the two innermost axes is collapsed into a single axis softmax
+    auto make_function = []() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3, 4, 5});
+        return make_shared<Function>(make_shared<op::Softmax>(A, AxisSet{2, 3}),
+                                     ParameterVector{A});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_f = make_function();
+    backend->compile(cpu_f);
+    EXPECT_EQ(count_ops_of_type<op::Reshape>(cpu_f), 2);
+
+    vector<float> a(2 * 3 * 4 * 5);
+    test::Uniform<float> rng(-10.0f, 10.0f);
+    rng.initialize(a);
+    vector<vector<float>> args{a};
+    auto int_results = execute(make_function(), args, "INTERPRETER");
+    auto cpu_results = execute(make_function(), args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0)));
+}
+
+TEST(cpu_test, lrn_native_kernel)
+{
+    // MKLDNN only handles 4D f32 LRN
+    auto make_function = [](const element::Type& type, const Shape& shape) {
+        auto A = make_shared<op::Parameter>(type, shape);
+        return make_shared<Function>(make_shared<op::LRN>(A, 0.1, 0.75, 2.0, 3),
+                                     ParameterVector{A});
+    };
+
+    vector<float> a(2 * 7 * 5);
+    test::Uniform<float> rng(-2.0f, 2.0f);
+    rng.initialize(a);
+    vector<vector<float>> args{a};
+    auto int_results = execute(make_function(element::f32, Shape{2, 7, 5}), args, "INTERPRETER");
+    auto cpu_results = execute(make_function(element::f32, Shape{2, 7, 5}), args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0)));
+
+    vector<double> b(2 * 4 * 3 * 3);
+    test::Uniform<double> rng_f64(-2.0, 2.0);
+    rng_f64.initialize(b);
+    vector<vector<double>> args_f64{b};
+    auto int_results_f64 =
+        execute(make_function(element::f64, Shape{2, 4, 3, 3}), args_f64, "INTERPRETER");
+    auto cpu_results_f64 = execute(make_function(element::f64, Shape{2, 4, 3, 3}), args_f64, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results_f64.at(0), int_results_f64.at(0)));
+}
+
+TEST(cpu_test, batch_norm_native_kernels)
+{
+    // Rank 3 inputs are not handled by MKLDNN
+    Shape shape{4, 3, 10};
+    auto make_function = [&]() {
+        auto input = make_shared<op::Parameter>(element::f32, shape);
+        auto gamma = make_shared<op::Parameter>(element::f32, Shape{3});
+        auto beta = make_shared<op::Parameter>(element::f32, Shape{3});
+        auto bn = make_shared<op::BatchNormTraining>(0.001, gamma, beta, input);
+        auto normed = make_shared<op::GetOutputElement>(bn, 0);
+        auto mean = make_shared<op::GetOutputElement>(bn, 1);
+        auto variance = make_shared<op::GetOutputElement>(bn, 2);
+        auto inference =
+            make_shared<op::BatchNormInference>(0.001, gamma, beta, input, mean, variance);
+        return make_shared<Function>(NodeVector{normed, mean, variance, inference},
+                                     ParameterVector{input, gamma, beta});
+    };
+
+    // A large mean checks the statistics do not lose precision
+    vector<float> input(shape_size(shape));
+    test::Uniform<float> rng(100.0f, 110.0f);
+    rng.initialize(input);
+    vector<vector<float>> args{input, {0.5f, 1.0f, 2.0f}, {-1.0f, 0.0f, 1.0f}};
+    auto int_results = execute(make_function(), args, "INTERPRETER");
+    auto cpu_results = execute(make_function(), args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1e-4f, 1e-4f));
+    }
+}
+
+TEST(cpu_test, reduction_high_rank)
+{
+    // Three separate reduced runs remain after coalescing, so this takes the generic kernel
+    Shape shape{2, 3, 4, 5, 6, 7};
+    AxisSet axes{0, 2, 4};
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        return make_shared<Function>(NodeVector{make_shared<op::Sum>(A, axes),
+                                                make_shared<op::Max>(A, axes),
+                                                make_shared<op::Min>(B, AxisSet{1, 3, 5}),
+                                                make_shared<op::Product>(B, AxisSet{1, 3})},
+                                     ParameterVector{A, B});
+    };
+
+    vector<float> a(shape_size(shape));
+    vector<float> b(shape_size(shape));
+    test::Uniform<float> rng(0.9f, 1.1f);
+    rng.initialize(a);
+    rng.initialize(b);
+    vector<vector<float>> args{a, b};
+    auto int_results = execute(make_function(), args, "INTERPRETER");
+    auto cpu_results = execute(make_function(), args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i)));
+    }
+}
+
+TEST(cpu_test, transpose_high_rank)
+{
+    auto make_function = [](const Shape& shape, const AxisVector& order) {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        Shape out_shape;
+        for (auto axis : order)
+        {
+            out_shape.push_back(shape[axis]);
+        }
+        return make_shared<Function>(make_shared<op::Reshape>(A, order, out_shape),
+                                     ParameterVector{A});
+    };
+
+    // The first and last cases stay above rank 4 after coalescing and take the generic kernel
+    vector<pair<Shape, AxisVector>> cases{{Shape{2, 3, 4, 5, 6, 7}, AxisVector{5, 4, 3, 2, 1, 0}},
+                                          {Shape{2, 3, 4, 5, 6}, AxisVector{1, 0, 3, 2, 4}},
+                                          {Shape{2, 1, 3, 4, 1, 5}, AxisVector{2, 3, 0, 1, 5, 4}},
+                                          {Shape{3, 33, 2, 65, 2}, AxisVector{4, 1, 0, 3, 2}}};
+    for (auto& c : cases)
+    {
+        vector<float> a(shape_size(c.first));
+        iota(a.begin(), a.end(), 0.0f);
+        vector<vector<float>> args{a};
+        auto int_results = execute(make_function(c.first, c.second), args, "INTERPRETER");
+        auto cpu_results = execute(make_function(c.first, c.second), args, "CPU");
+        EXPECT_EQ(cpu_results.at(0), int_results.at(0));
+    }
+}
+
+TEST(cpu_test, convolution_fallback)
+{
+    // f64 never goes to MKLDNN. Data dilation, uneven padding and strides exercise the
+    // im2col indexing of the fallback for all three convolution ops.
+    Shape shape_data{2, 3, 7, 6};
+    Shape shape_filters{4, 3, 3, 2};
+    Strides strides{2, 1};
+    Strides dilation{1, 2};
+    CoordinateDiff padding_below{1, 2};
+    CoordinateDiff padding_above{2, 0};
+    Strides data_dilation{2, 1};
+    auto make_forward = [&]() {
+        auto data = make_shared<op::Parameter>(element::f64, shape_data);
+        auto filters = make_shared<op::Parameter>(element::f64, shape_filters);
+        auto conv = make_shared<op::Convolution>(
+            data, filters, strides, dilation, padding_below, padding_above, data_dilation);
+        return make_shared<Function>(conv, ParameterVector{data, filters});
+    };
+    Shape shape_delta = make_forward()->get_output_shape(0);
+    auto make_backprop = [&]() {
+        auto data = make_shared<op::Parameter>(element::f64, shape_data);
+        auto filters = make_shared<op::Parameter>(element::f64, shape_filters);
+        auto delta = make_shared<op::Parameter>(element::f64, shape_delta);
+        auto backprop_data = make_shared<op::ConvolutionBackpropData>(shape_data,
+                                                                      filters,
+                                                                      delta,
+                                                                      strides,
+                                                                      dilation,
+                                                                      padding_below,
+                                                                      padding_above,
+                                                                      data_dilation);
+        auto backprop_filters = make_shared<op::ConvolutionBackpropFilters>(data,
+                                                                            shape_filters,
+                                                                            delta,
+                                                                            strides,
+                                                                            dilation,
+                                                                            padding_below,
+                                                                            padding_above,
+                                                                            data_dilation);
+        return make_shared<Function>(NodeVector{backprop_data, backprop_filters},
+                                     ParameterVector{data, filters, delta});
+    };
+
+    test::Uniform<double> rng(-1.0, 1.0);
+    vector<double> data(shape_size(shape_data));
+    vector<double> filters(shape_size(shape_filters));
+    vector<double> delta(shape_size(shape_delta));
+    rng.initialize(data);
+    rng.initialize(filters);
+    rng.initialize(delta);
+
+    vector<vector<double>> forward_args{data, filters};
+    auto int_results = execute(make_forward(), forward_args, "INTERPRETER");
+    auto cpu_results = execute(make_forward(), forward_args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0)));
+
+    vector<vector<double>> backprop_args{data, filters, delta};
+    int_results = execute(make_backprop(), backprop_args, "INTERPRETER");
+    cpu_results = execute(make_backprop(), backprop_args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i)));
+    }
+}
+
+TEST(cpu_test, call_frame_raw_pointers)
+{
+    Shape shape{2, 3};
+    auto make_function = []() {
+        Shape shape{2, 3};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto C = make_shared<op::Parameter>(element::f32, shape);
+        return make_shared<Function>(NodeVector{(A + B) * C, make_shared<op::Tanh>(A)},
+                                     ParameterVector{A, B, C});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_cast<runtime::cpu::CPU_Backend*>(backend.get());
+    auto f = make_function();
+    backend->compile(f);
+    auto call_frame = cpu_backend->get_call_frame(f);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args(3, vector<float>(shape_size(shape)));
+    vector<vector<float>> results(2, vector<float>(shape_size(shape)));
+    vector<void*> inputs;
+    vector<void*> outputs;
+    for (auto& arg : args)
+    {
+        inputs.push_back(arg.data());
+    }
+    for (auto& result : results)
+    {
+        outputs.push_back(result.data());
+    }
+
+    // Inputs change in place between calls and must be picked up every time
+    for (size_t iteration = 0; iteration < 3; iteration++)
+    {
+        for (auto& arg : args)
+        {
+            rng.initialize(arg);
+        }
+        call_frame->call(outputs.data(), inputs.data());
+        auto int_results = execute(make_function(), args, "INTERPRETER");
+        EXPECT_TRUE(test::all_close(results.at(0), int_results.at(0)));
+        EXPECT_TRUE(test::all_close(results.at(1), int_results.at(1)));
+    }
+}
+
+TEST(cpu_test, frozen_execution)
+{
+    Shape shape{2, 3};
+    auto make_function = []() {
+        Shape shape{2, 3};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        // Only depends on constants, so it is computed once and left out of the replay
+        auto K = make_shared<op::Exp>(
+            op::Constant::create(element::f32, shape, vector<float>{1, 2, 3, 4, 5, 6}));
+        return make_shared<Function>(NodeVector{(A + K) * B, make_shared<op::Abs>(B)},
+                                     ParameterVector{A, B});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_cast<runtime::cpu::CPU_Backend*>(backend.get());
+    auto f = make_function();
+    cpu_backend->set_frozen_execution(f, true);
+    backend->compile(f);
+    ASSERT_THROW(cpu_backend->set_frozen_execution(f, false), runtime_error);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args(2, vector<float>(shape_size(shape)));
+    vector<shared_ptr<runtime::Tensor>> inputs{backend->create_tensor(element::f32, shape),
+                                               backend->create_tensor(element::f32, shape)};
+    vector<shared_ptr<runtime::Tensor>> results{backend->create_tensor(element::f32, shape),
+                                                backend->create_tensor(element::f32, shape)};
+    for (size_t iteration = 0; iteration < 3; iteration++)
+    {
+        for (size_t i = 0; i < args.size(); i++)
+        {
+            rng.initialize(args[i]);
+            copy_data(inputs[i], args[i]);
+        }
+        backend->call(f, results, inputs);
+        auto int_results = execute(make_function(), args, "INTERPRETER");
+        EXPECT_TRUE(test::all_close(read_vector<float>(results[0]), int_results.at(0)));
+        EXPECT_TRUE(test::all_close(read_vector<float>(results[1]), int_results.at(1)));
+    }
+
+    // Pinned buffers are read and written in place on every call
+    auto call_frame = cpu_backend->get_call_frame(f);
+    vector<vector<float>> pinned_results(2, vector<float>(shape_size(shape)));
+    vector<void*> input_ptrs{args[0].data(), args[1].data()};
+    vector<void*> output_ptrs{pinned_results[0].data(), pinned_results[1].data()};
+    call_frame->pin(output_ptrs.data(), input_ptrs.data());
+    for (size_t iteration = 0; iteration < 3; iteration++)
+    {
+        for (auto& arg : args)
+        {
+            rng.initialize(arg);
+        }
+        call_frame->call_pinned();
+        auto int_results = execute(make_function(), args, "INTERPRETER");
+        EXPECT_TRUE(test::all_close(pinned_results.at(0), int_results.at(0)));
+        EXPECT_TRUE(test::all_close(pinned_results.at(1), int_results.at(1)));
+    }
+}
+
+TEST(cpu_test, optimization_levels)
+{
+    Shape shape{2, 3};
+    auto make_function = []() {
+        Shape shape{2, 3};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto zero = make_shared<op::Broadcast>(
+            op::Constant::create(element::f32, Shape{}, {0}), shape, AxisSet{0, 1});
+        return make_shared<Function>(make_shared<op::Maximum>(zero, A), ParameterVector{A});
+    };
+    auto has_pass = [](const vector<pass::PassProfile>& profiles, const string& name) {
+        return any_of(profiles.begin(), profiles.end(), [&](const pass::PassProfile& p) {
+            return p.name.find(name) != string::npos;
+        });
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_cast<runtime::cpu::CPU_Backend*>(backend.get());
+    auto f0 = make_function();
+    auto f2 = make_function();
+    EXPECT_THROW(cpu_backend->set_optimization_level(f0, 3), ngraph_error);
+    cpu_backend->set_optimization_level(f0, 0);
+    cpu_backend->set_optimization_level(f2, 2);
+    EXPECT_TRUE(cpu_backend->get_pass_profiles(f0).empty());
+    backend->compile(f0);
+    backend->compile(f2);
+    ASSERT_THROW(cpu_backend->set_optimization_level(f0, 1), runtime_error);
+
+    auto profiles0 = cpu_backend->get_pass_profiles(f0);
+    auto profiles2 = cpu_backend->get_pass_profiles(f2);
+    EXPECT_TRUE(has_pass(profiles0, "CPULayout"));
+    EXPECT_FALSE(has_pass(profiles0, "CoreFusion"));
+    EXPECT_TRUE(has_pass(profiles2, "CoreFusion"));
+    EXPECT_TRUE(has_pass(profiles2, "CPUHorizontalFusion"));
+    EXPECT_LT(profiles0.size(), profiles2.size());
+    // Maximum with a zero is only rewritten to Relu when the fusions run
+    EXPECT_EQ(count_ops_of_type<op::Maximum>(f0), 1);
+    EXPECT_EQ(count_ops_of_type<op::Relu>(f2), 1);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> arg(shape_size(shape));
+    rng.initialize(arg);
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, arg);
+    auto result0 = backend->create_tensor(element::f32, shape);
+    auto result2 = backend->create_tensor(element::f32, shape);
+    backend->call(f0, {result0}, {a});
+    backend->call(f2, {result2}, {a});
+    EXPECT_TRUE(test::all_close(read_vector<float>(result0), read_vector<float>(result2)));
+}
+
+TEST(cpu_test, constant_updates)
+{
+    Shape shape_a{1, 2, 5, 5};
+    Shape shape_w{3, 2, 3, 3};
+    Shape shape_r{1, 3, 3, 3};
+    auto make_function = [&](const vector<float>& weights, const vector<float>& bias) {
+        auto A = make_shared<op::Parameter>(element::f32, shape_a);
+        auto W = op::Constant::create(element::f32, shape_w, weights);
+        auto B = make_shared<op::Broadcast>(
+            op::Constant::create(element::f32, Shape{3}, bias), shape_r, AxisSet{0, 2, 3});
+        auto conv = make_shared<op::Convolution>(A, W);
+        return make_shared<Function>(conv + B, ParameterVector{A});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args{vector<float>(shape_size(shape_a))};
+    rng.initialize(args[0]);
+    vector<float> weights(shape_size(shape_w));
+    vector<float> bias(3);
+    rng.initialize(weights);
+    rng.initialize(bias);
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_cast<runtime::cpu::CPU_Backend*>(backend.get());
+    auto f = make_function(weights, bias);
+    cpu_backend->enable_constant_updates(f, true);
+    backend->compile(f);
+    ASSERT_THROW(cpu_backend->enable_constant_updates(f, false), runtime_error);
+
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, args[0]);
+    auto result = backend->create_tensor(element::f32, shape_r);
+    backend->call(f, {result}, {a});
+    EXPECT_TRUE(test::all_close(read_vector<float>(result),
+                                execute(make_function(weights, bias), args, "INTERPRETER")[0]));
+
+    // Unchanged constants are left alone
+    EXPECT_EQ(cpu_backend->update_constants(f, make_function(weights, bias)), 0);
+
+    for (size_t update = 0; update < 2; update++)
+    {
+        rng.initialize(weights);
+        rng.initialize(bias);
+        EXPECT_EQ(cpu_backend->update_constants(f, make_function(weights, bias)), 2);
+        backend->call(f, {result}, {a});
+        EXPECT_TRUE(
+            test::all_close(read_vector<float>(result),
+                            execute(make_function(weights, bias), args, "INTERPRETER")[0]));
+    }
+
+    EXPECT_THROW(cpu_backend->update_constants(
+                     f, make_function(vector<float>(shape_size(shape_w) - 1), bias)),
+                 ngraph_error);
+
+    // Dot and MatmulBias pack constant weights when they are built, so they must be repacked
+    Shape shape_x{2, 4};
+    Shape shape_y{4, 3};
+    Shape shape_z{2, 3};
+    auto make_dot_function = [&](const vector<float>& y0, const vector<float>& y1) {
+        auto X = make_shared<op::Parameter>(element::f32, shape_x);
+        auto Y0 = op::Constant::create(element::f32, shape_y, y0);
+        auto Y1 = op::Constant::create(element::f32, shape_y, y1);
+        auto B = make_shared<op::Broadcast>(
+            op::Constant::create(element::f32, Shape{3}, bias), shape_z, AxisSet{0});
+        auto matmul_bias = make_shared<op::Dot>(X, Y0) + B;
+        auto dot = make_shared<op::Dot>(X, Y1);
+        return make_shared<Function>(NodeVector{matmul_bias, dot}, ParameterVector{X});
+    };
+
+    vector<vector<float>> dot_args{vector<float>(shape_size(shape_x))};
+    rng.initialize(dot_args[0]);
+    vector<float> y0(shape_size(shape_y));
+    vector<float> y1(shape_size(shape_y));
+    rng.initialize(y0);
+    rng.initialize(y1);
+
+    auto g = make_dot_function(y0, y1);
+    cpu_backend->enable_constant_updates(g, true);
+    backend->compile(g);
+    auto x = backend->create_tensor(element::f32, shape_x);
+    copy_data(x, dot_args[0]);
+    auto result0 = backend->create_tensor(element::f32, shape_z);
+    auto result1 = backend->create_tensor(element::f32, shape_z);
+    backend->call(g, {result0, result1}, {x});
+
+    rng.initialize(y0);
+    rng.initialize(y1);
+    EXPECT_EQ(cpu_backend->update_constants(g, make_dot_function(y0, y1)), 2);
+    backend->call(g, {result0, result1}, {x});
+    auto expected = execute(make_dot_function(y0, y1), dot_args, "INTERPRETER");
+    EXPECT_TRUE(test::all_close(read_vector<float>(result0), expected[0]));
+    EXPECT_TRUE(test::all_close(read_vector<float>(result1), expected[1]));
+}
+
+TEST(cpu_test, constant_updates_folded_constant)
+{
+    Shape shape{2, 3};
+    auto make_function = [&](float floor) {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto F = make_shared<op::Broadcast>(
+            op::Constant::create(element::f32, Shape{}, {floor}), shape, AxisSet{0, 1});
+        return make_shared<Function>(make_shared<op::Maximum>(F, A), ParameterVector{A});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_cast<runtime::cpu::CPU_Backend*>(backend.get());
+    auto f = make_function(0);
+    cpu_backend->enable_constant_updates(f, true);
+    backend->compile(f);
+
+    // Maximum with a zero became a Relu, so the zero can't change any more
+    EXPECT_EQ(cpu_backend->update_constants(f, make_function(0)), 0);
+    EXPECT_THROW(cpu_backend->update_constants(f, make_function(1)), ngraph_error);
+
+    auto g = make_function(0);
+    EXPECT_THROW(cpu_backend->update_constants(g, make_function(0)), runtime_error);
+}
+
+TEST(cpu_test, executable_pinned_buffers)
+{
+    Shape shape{2, 3};
+    auto make_function = []() {
+        Shape shape{2, 3};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        return make_shared<Function>(NodeVector{A * B, make_shared<op::Tanh>(A - B)},
+                                     ParameterVector{A, B});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto f = make_function();
+    vector<vector<float>> args(2, vector<float>(shape_size(shape)));
+    vector<vector<float>> results(2, vector<float>(shape_size(shape)));
+
+    // Outputs are written straight into the user's buffers
+    auto executable = backend->create_executable(f);
+    for (size_t i = 0; i < 2; i++)
+    {
+        executable->bind_input(i, backend->create_tensor(element::f32, shape, args[i].data()));
+        executable->bind_output(i,
+                                backend->create_tensor(element::f32, shape, results[i].data()));
+    }
+
+    // A second executable and a regular call on the same Function must not disturb the first
+    auto other = backend->create_executable(f);
+    vector<shared_ptr<runtime::Tensor>> other_inputs;
+    vector<shared_ptr<runtime::Tensor>> other_outputs;
+    for (size_t i = 0; i < 2; i++)
+    {
+        other_inputs.push_back(backend->create_tensor(element::f32, shape));
+        other_outputs.push_back(backend->create_tensor(element::f32, shape));
+        copy_data(other_inputs.back(), vector<float>(shape_size(shape), 1.0f));
+        other->bind_input(i, other_inputs.back());
+        other->bind_output(i, other_outputs.back());
+    }
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    for (size_t iteration = 0; iteration < 3; iteration++)
+    {
+        for (auto& arg : args)
+        {
+            rng.initialize(arg);
+        }
+        executable->run();
+        other->run();
+        backend->call(f, other_outputs, other_inputs);
+        auto int_results = execute(make_function(), args, "INTERPRETER");
+        EXPECT_TRUE(test::all_close(results.at(0), int_results.at(0)));
+        EXPECT_TRUE(test::all_close(results.at(1), int_results.at(1)));
+        EXPECT_EQ(vector<float>(shape_size(shape), 1.0f), read_vector<float>(other_outputs[0]));
+    }
+}
+
+TEST(cpu_test, results_written_in_place)
+{
+    Shape shape{2, 3};
+    auto make_function = []() {
+        Shape shape{2, 3};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto sum = A + B;
+        // sum is still read after the reshape, so the two can't share a pool buffer
+        auto reshape = make_shared<op::Reshape>(sum, AxisVector{0, 1}, Shape{3, 2});
+        auto product = make_shared<op::Multiply>(sum, B);
+        return make_shared<Function>(NodeVector{reshape, product}, ParameterVector{A, B});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_cast<runtime::cpu::CPU_Backend*>(backend.get());
+    auto f = make_function();
+    backend->compile(f);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args(2, vector<float>(shape_size(shape)));
+    vector<shared_ptr<runtime::Tensor>> inputs;
+    for (auto& arg : args)
+    {
+        rng.initialize(arg);
+        inputs.push_back(backend->create_tensor(element::f32, shape));
+        copy_data(inputs.back(), arg);
+    }
+    auto reshaped = backend->create_tensor(element::f32, Shape{3, 2});
+    auto product = backend->create_tensor(element::f32, shape);
+    backend->call(f, {reshaped, product}, inputs);
+
+    auto int_results = execute(make_function(), args, "INTERPRETER");
+    EXPECT_TRUE(test::all_close(read_vector<float>(reshaped), int_results.at(0)));
+    EXPECT_TRUE(test::all_close(read_vector<float>(product), int_results.at(1)));
+    EXPECT_EQ(0, cpu_backend->get_call_frame(f)->get_output_bytes_copied());
+
+    // Returning a parameter always takes a copy
+    auto P = make_shared<op::Parameter>(element::f32, shape);
+    auto g = make_shared<Function>(NodeVector{P, make_shared<op::Negative>(P)}, ParameterVector{P});
+    auto copied = backend->create_tensor(element::f32, shape);
+    auto negated = backend->create_tensor(element::f32, shape);
+    backend->call_with_validate(g, {copied, negated}, {inputs[0]});
+    EXPECT_EQ(args[0], read_vector<float>(copied));
+    EXPECT_EQ(shape_size(shape) * sizeof(float),
+              cpu_backend->get_call_frame(g)->get_output_bytes_copied());
+}
+
+TEST(cpu_test, constants_shared_between_functions)
+{
+    Shape shape{4, 4};
+    vector<float> weights(shape_size(shape));
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    rng.initialize(weights);
+    // Two heads reading the same weights, each holding its own copy of them
+    auto make_function = [&](bool add) {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto W1 = op::Constant::create(element::f32, shape, weights);
+        auto W2 = op::Constant::create(element::f32, shape, weights);
+        auto dot = make_shared<op::Dot>(A, W1);
+        shared_ptr<Node> head = add ? dot + W2 : dot * W2;
+        return make_shared<Function>(head, ParameterVector{A});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_cast<runtime::cpu::CPU_Backend*>(backend.get());
+    auto f = make_function(true);
+    auto g = make_function(false);
+    backend->compile(f);
+    backend->compile(g);
+    size_t weight_bytes = shape_size(shape) * sizeof(float);
+    // One copy merged within f, both copies of g replaced by the data of f
+    EXPECT_EQ(3 * weight_bytes, cpu_backend->get_constant_bytes_saved());
+
+    vector<vector<float>> args{vector<float>(shape_size(shape))};
+    rng.initialize(args[0]);
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, args[0]);
+    for (auto function : {f, g})
+    {
+        auto result = backend->create_tensor(element::f32, shape);
+        backend->call_with_validate(function, {result}, {a});
+        auto int_results = execute(make_function(function == f), args, "INTERPRETER");
+        EXPECT_TRUE(test::all_close(read_vector<float>(result), int_results.at(0)));
+    }
+}
+
+TEST(cpu_test, shared_convolution_primitives)
+{
+    if (getenv("NGRAPH_CODEGEN") != nullptr)
+    {
+        // Generated code builds its own primitives
+        return;
+    }
+
+    Shape shape_a{1, 2, 7, 7};
+    Shape shape_w{4, 2, 3, 3};
+    Shape shape_r{1, 4, 5, 5};
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape_a);
+        auto W = make_shared<op::Parameter>(element::f32, shape_w);
+        auto conv = make_shared<op::Convolution>(A, W);
+        return make_shared<Function>(conv, ParameterVector{A, W});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args{vector<float>(shape_size(shape_a)),
+                               vector<float>(shape_size(shape_w))};
+    rng.initialize(args[0]);
+    rng.initialize(args[1]);
+    auto expected = execute(make_function(), args, "INTERPRETER")[0];
+
+    auto& cache = runtime::cpu::MKLDNNPrimitiveCache::get();
+    size_t pools = cache.get_pool_count();
+    size_t hits = cache.get_hit_count();
+    auto check = [&](runtime::Backend* backend, const shared_ptr<Function>& f) {
+        auto a = backend->create_tensor(element::f32, shape_a);
+        auto w = backend->create_tensor(element::f32, shape_w);
+        copy_data(a, args[0]);
+        copy_data(w, args[1]);
+        auto result = backend->create_tensor(element::f32, shape_r);
+        backend->call(f, {result}, {a, w});
+        EXPECT_TRUE(test::all_close(read_vector<float>(result), expected));
+    };
+    {
+        auto backend1 = runtime::Backend::create("CPU");
+        auto backend2 = runtime::Backend::create("CPU");
+        auto f1 = make_function();
+        auto f2 = make_function();
+        backend1->compile(f1);
+        EXPECT_EQ(cache.get_pool_count(), pools + 1);
+        backend2->compile(f2);
+        EXPECT_EQ(cache.get_pool_count(), pools + 1);
+        EXPECT_EQ(cache.get_hit_count(), hits + 1);
+
+        check(backend1.get(), f1);
+        check(backend2.get(), f2);
+    }
+    // Released with the last function using it
+    EXPECT_EQ(cache.get_pool_count(), pools);
+}
+
+TEST(cpu_test, layout_conversion_cost_model)
+{
+    Shape shape_a{1, 16, 8, 8};
+    Shape shape_w{16, 16, 3, 3};
+    Shape shape_c{1, 16, 6, 6};
+    Shape shape_r{1, 16, 4, 4};
+    // The elementwise Multiply has one argument in the native layout and one in the layout
+    // picked by the first convolution, whose result the second convolution prefers.
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape_a);
+        auto W1 = make_shared<op::Parameter>(element::f32, shape_w);
+        auto P = make_shared<op::Parameter>(element::f32, shape_c);
+        auto W2 = make_shared<op::Parameter>(element::f32, shape_w);
+        auto conv1 = make_shared<op::Convolution>(A, W1);
+        auto conv2 = make_shared<op::Convolution>(P * conv1, W2);
+        return make_shared<Function>(conv2, ParameterVector{A, W1, P, W2});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (auto shape : {shape_a, shape_w, shape_c, shape_w})
+    {
+        vector<float> arg(shape_size(shape));
+        rng.initialize(arg);
+        args.push_back(arg);
+    }
+    auto expected = execute(make_function(), args, "INTERPRETER")[0];
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_cast<runtime::cpu::CPU_Backend*>(backend.get());
+    vector<runtime::cpu::LayoutConversionStats> stats;
+    for (bool cost_model : {false, true})
+    {
+        auto f = make_function();
+        cpu_backend->set_optimization_level(f, 2);
+        cpu_backend->set_layout_cost_model(f, cost_model);
+        backend->compile(f);
+
+        vector<shared_ptr<runtime::Tensor>> inputs;
+        for (size_t i = 0; i < args.size(); i++)
+        {
+            auto shape = f->get_parameters()[i]->get_shape();
+            inputs.push_back(backend->create_tensor(element::f32, shape));
+            copy_data(inputs.back(), args[i]);
+        }
+        auto result = backend->create_tensor(element::f32, shape_r);
+        backend->call(f, {result}, inputs);
+        EXPECT_TRUE(test::all_close(read_vector<float>(result), expected));
+
+        stats.push_back(cpu_backend->get_layout_conversions(f));
+        EXPECT_EQ(stats.back().cost_model, cost_model);
+    }
+    // Without the cost model the Multiply takes P's native layout, so the output of the first
+    // convolution is converted to it and the product back again for the second convolution.
+    // With it only P is converted.
+    EXPECT_LT(stats[1].count, stats[0].count);
+    EXPECT_LT(stats[1].bytes, stats[0].bytes);
+}
+
+TEST(cpu_test, layout_conversion_cost_model_region)
+{
+    Shape shape_a{1, 16, 8, 8};
+    Shape shape_w{16, 16, 3, 3};
+    Shape shape_c{1, 16, 6, 6};
+    Shape shape_r{1, 16, 4, 4};
+    // The second convolution is several elementwise ops away from the Multiply, further than
+    // its users could be followed one by one, but in the same elementwise region.
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape_a);
+        auto W1 = make_shared<op::Parameter>(element::f32, shape_w);
+        auto P = make_shared<op::Parameter>(element::f32, shape_c);
+        auto W2 = make_shared<op::Parameter>(element::f32, shape_w);
+        auto conv1 = make_shared<op::Convolution>(A, W1);
+        shared_ptr<Node> chain = P * conv1;
+        for (int i = 0; i < 4; i++)
+        {
+            chain = make_shared<op::Tanh>(chain);
+        }
+        auto conv2 = make_shared<op::Convolution>(chain, W2);
+        return make_shared<Function>(conv2, ParameterVector{A, W1, P, W2});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (auto shape : {shape_a, shape_w, shape_c, shape_w})
+    {
+        vector<float> arg(shape_size(shape));
+        rng.initialize(arg);
+        args.push_back(arg);
+    }
+    auto expected = execute(make_function(), args, "INTERPRETER")[0];
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_cast<runtime::cpu::CPU_Backend*>(backend.get());
+    vector<runtime::cpu::LayoutConversionStats> stats;
+    for (bool cost_model : {false, true})
+    {
+        auto f = make_function();
+        cpu_backend->set_optimization_level(f, 2);
+        cpu_backend->set_layout_cost_model(f, cost_model);
+        backend->compile(f);
+
+        vector<shared_ptr<runtime::Tensor>> inputs;
+        for (size_t i = 0; i < args.size(); i++)
+        {
+            auto shape = f->get_parameters()[i]->get_shape();
+            inputs.push_back(backend->create_tensor(element::f32, shape));
+            copy_data(inputs.back(), args[i]);
+        }
+        auto result = backend->create_tensor(element::f32, shape_r);
+        backend->call(f, {result}, inputs);
+        EXPECT_TRUE(test::all_close(read_vector<float>(result), expected));
+
+        stats.push_back(cpu_backend->get_layout_conversions(f));
+    }
+    // Without the cost model the Multiply takes P's native layout, so the output of the first
+    // convolution is converted to it and the last Tanh back again. Laying out the whole region
+    // in the first convolution's layout only converts P.
+    EXPECT_LT(stats[1].count, stats[0].count);
+    EXPECT_LT(stats[1].bytes, stats[0].bytes);
+}
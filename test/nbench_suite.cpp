@@ -0,0 +1,121 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <gtest/gtest.h>
+#include <sstream>
+
+#include "suite.hpp"
+
+using namespace std;
+
+static SuiteResult make_suite_result(const string& name, double latency_milliseconds)
+{
+    SuiteResult result;
+    result.name = name;
+    result.backend = "CPU";
+    result.iterations = 20;
+    result.compile_milliseconds = 100;
+    result.min_milliseconds = latency_milliseconds;
+    result.mean_milliseconds = latency_milliseconds;
+    result.p50_milliseconds = latency_milliseconds;
+    result.p90_milliseconds = latency_milliseconds;
+    result.p99_milliseconds = latency_milliseconds;
+    result.throughput = 1000 / latency_milliseconds;
+    result.peak_memory_kb = 1024;
+    return result;
+}
+
+TEST(tools, nbench_suite_results_round_trip)
+{
+    SuiteResult ran = make_suite_result("mlp", 2);
+    ran.p90_milliseconds = 3;
+    ran.p99_milliseconds = 4;
+    SuiteResult failed;
+    failed.name = "cnn";
+    failed.backend = "INTERPRETER";
+    failed.error = "unsupported op";
+
+    stringstream ss;
+    write_suite_results(ss, {ran, failed});
+    vector<SuiteResult> results = read_suite_results(ss);
+
+    ASSERT_EQ(results.size(), 2);
+    EXPECT_EQ(results[0].name, "mlp");
+    EXPECT_EQ(results[0].backend, "CPU");
+    EXPECT_TRUE(results[0].error.empty());
+    EXPECT_EQ(results[0].iterations, 20);
+    EXPECT_EQ(results[0].compile_milliseconds, 100);
+    EXPECT_EQ(results[0].min_milliseconds, 2);
+    EXPECT_EQ(results[0].mean_milliseconds, 2);
+    EXPECT_EQ(results[0].p50_milliseconds, 2);
+    EXPECT_EQ(results[0].p90_milliseconds, 3);
+    EXPECT_EQ(results[0].p99_milliseconds, 4);
+    EXPECT_EQ(results[0].throughput, 500);
+    EXPECT_EQ(results[0].peak_memory_kb, 1024);
+    EXPECT_EQ(results[1].name, "cnn");
+    EXPECT_EQ(results[1].backend, "INTERPRETER");
+    EXPECT_EQ(results[1].error, "unsupported op");
+    EXPECT_EQ(results[1].iterations, 0);
+}
+
+TEST(tools, nbench_suite_compare)
+{
+    SuiteTolerance tolerance;
+    vector<SuiteResult> baseline{make_suite_result("unchanged", 5),
+                                 make_suite_result("slower", 5),
+                                 make_suite_result("tiny", 0.01),
+                                 make_suite_result("outlier", 5),
+                                 make_suite_result("broken", 5),
+                                 make_suite_result("bigger", 5)};
+    vector<SuiteResult> results = baseline;
+    results.push_back(make_suite_result("new", 5));
+
+    // 20% slower
+    results[1] = make_suite_result("slower", 6);
+    // Three times slower, but by less than the runtime floor
+    results[2] = make_suite_result("tiny", 0.03);
+    // One slow iteration only moves the tail
+    results[3].p99_milliseconds = 50;
+    results[4].error = "unsupported op";
+    results[5].peak_memory_kb = 2048;
+    results[5].compile_milliseconds = 200;
+
+    vector<string> regressions = compare_suite_results(results, baseline, tolerance);
+    auto reported = [&](const string& prefix) {
+        size_t count = 0;
+        for (const string& regression : regressions)
+        {
+            count += regression.compare(0, prefix.size(), prefix) == 0;
+        }
+        return count;
+    };
+    EXPECT_EQ(reported("unchanged on CPU"), 0);
+    EXPECT_EQ(reported("slower on CPU: min_ms"), 1);
+    EXPECT_EQ(reported("slower on CPU: p50_ms"), 1);
+    EXPECT_EQ(reported("slower on CPU: throughput"), 1);
+    EXPECT_EQ(reported("tiny on CPU"), 0);
+    EXPECT_EQ(reported("outlier on CPU"), 0);
+    EXPECT_EQ(reported("broken on CPU: fails with 'unsupported op'"), 1);
+    EXPECT_EQ(reported("bigger on CPU: peak_memory_kb"), 1);
+    EXPECT_EQ(reported("bigger on CPU: compile_ms"), 1);
+    EXPECT_EQ(reported("new on CPU"), 0);
+    EXPECT_EQ(regressions.size(), 6);
+
+    // Without a floor the tiny graph counts as slower too
+    tolerance.runtime_floor_milliseconds = 0;
+    regressions = compare_suite_results(results, baseline, tolerance);
+    EXPECT_EQ(reported("tiny on CPU"), 3);
+}
@@ -22,6 +22,9 @@
 #include "gtest/gtest.h"
 #include "ngraph/frontend/onnx_import/onnx.hpp"
 #include "ngraph/ngraph.hpp"
+#ifdef NGRAPH_CPU_ENABLE
+#include "ngraph/runtime/cpu/op/rnn.hpp"
+#endif
 #include "util/all_close.hpp"
 #include "util/all_close_f.hpp"
 #include "util/ndarray.hpp"
@@ -1535,3 +1538,191 @@ TEST(onnx, model_matmul_vec_ten3d)
     Outputs outputs{execute(function, inputs, "INTERPRETER")};
     EXPECT_TRUE(test::all_close_f(expected_output.front(), outputs.front()));
 }
+
+// X of the recurrent models, [seq_length, batch_size, input_size] = [3, 2, 4]. The expected
+// outputs Y, [seq_length, num_directions, batch_size, hidden_size], Y_h and Y_c were computed
+// with a NumPy implementation of the ONNX operator definitions. The sequence_lens of the models
+// with sequences of different lengths are {1, 3}.
+static const Inputs recurrent_inputs{{0.10f, 0.43f, 0.21f, 0.09f, -0.15f, 0.29f, -0.12f, 0.78f,
+                                      0.93f, -0.23f, 0.58f, 0.06f, 0.14f, 0.85f, -0.86f, -0.83f,
+                                      -0.96f, 0.67f, 0.56f, 0.74f, 0.96f, 0.60f, -0.08f, 0.56f}};
+
+static const Outputs gru_fwd_outputs{{0.426181f, 0.0539012f, -0.176187f, 0.268858f, -0.190532f,
+                                      -0.125357f, 0.543551f, 0.649525f, -0.311978f, 0.504762f,
+                                      0.547797f, -0.172695f, 0.550617f, -0.687668f, -0.500069f,
+                                      0.0986275f, 0.361013f, -0.309056f},
+                                     {0.550617f, -0.687668f, -0.500069f, 0.0986275f, 0.361013f,
+                                      -0.309056f}};
+
+static const Outputs rnn_fwd_outputs{{-0.863405f, 0.0655618f, 0.407299f, -0.946832f, -0.0989372f,
+                                      0.777894f, -0.822668f, 0.805512f, -0.529544f, -0.663003f,
+                                      -0.645849f, 0.107508f, -0.896854f, -0.853597f, 0.745679f,
+                                      -0.964446f, 0.544596f, 0.492394f},
+                                     {-0.896854f, -0.853597f, 0.745679f, -0.964446f, 0.544596f,
+                                      0.492394f}};
+
+static const Outputs lstm_fwd_outputs{{0.222259f, -0.178064f, 0.0542399f, 0.365077f, -0.148541f,
+                                       0.000375408f, 0.0275038f, -0.116938f, 0.0444878f, 0.700053f,
+                                       -0.442335f, -0.0388398f, 0.0938481f, -0.246344f, 0.192528f,
+                                       0.548283f, -0.035237f, -0.221812f},
+                                      {0.0938481f, -0.246344f, 0.192528f, 0.548283f, -0.035237f,
+                                       -0.221812f},
+                                      {0.10777f, -0.87254f, 0.316343f, 1.13618f, -0.121171f,
+                                       -0.258765f}};
+
+static const Outputs lstm_bidirectional_outputs{{-0.14822f, 0.210702f, -0.111021f, 0.0385417f,
+                                                 0.442731f, 0.055012f, 0.195438f, 0.0382847f,
+                                                 0.0558457f, 0.224745f, 0.11393f, -0.0181786f,
+                                                 -0.181317f, 0.485695f, -0.0825633f, -0.286424f,
+                                                 0.150495f, -0.0819401f, 0.270751f, 0.0598826f,
+                                                 0.0582417f, -0.0335185f, -0.0899042f, -0.0553306f,
+                                                 -0.0263322f, 0.304494f, -0.249075f, -0.206269f,
+                                                 0.601486f, -0.0623064f, 0.342917f, 0.283821f,
+                                                 -0.00359875f, 0.268251f, -0.100405f, 0.0506009f},
+                                                {-0.0263322f, 0.304494f, -0.249075f, -0.206269f,
+                                                 0.601486f, -0.0623064f, 0.195438f, 0.0382847f,
+                                                 0.0558457f, 0.224745f, 0.11393f, -0.0181786f}};
+
+static const Outputs lstm_fwd_sequence_lens_outputs{{0.222259f, -0.178064f, 0.0542399f, 0.365077f,
+                                                     -0.148541f, 0.000375408f, 0.0f, 0.0f, 0.0f,
+                                                     0.700053f, -0.442335f, -0.0388398f, 0.0f, 0.0f,
+                                                     0.0f, 0.548283f, -0.035237f, -0.221812f},
+                                                    {0.222259f, -0.178064f, 0.0542399f, 0.548283f,
+                                                     -0.035237f, -0.221812f}};
+
+static const Outputs lstm_bidirectional_sequence_lens_outputs{{-0.14822f, 0.210702f, -0.111021f,
+                                                               0.0385417f, 0.442731f, 0.055012f,
+                                                               0.121667f, 0.0230666f, 0.0263644f,
+                                                               0.224745f, 0.11393f, -0.0181786f,
+                                                               0.0f, 0.0f, 0.0f, -0.286424f,
+                                                               0.150495f, -0.0819401f, 0.0f, 0.0f,
+                                                               0.0f, -0.0335185f, -0.0899042f,
+                                                               -0.0553306f, 0.0f, 0.0f, 0.0f,
+                                                               -0.206269f, 0.601486f, -0.0623064f,
+                                                               0.0f, 0.0f, 0.0f, 0.268251f,
+                                                               -0.100405f, 0.0506009f},
+                                                              {-0.14822f, 0.210702f, -0.111021f,
+                                                               -0.206269f, 0.601486f, -0.0623064f,
+                                                               0.121667f, 0.0230666f, 0.0263644f,
+                                                               0.224745f, 0.11393f, -0.0181786f},
+                                                              {-0.253916f, 0.289599f, -0.174017f,
+                                                               -0.593805f, 0.789219f, -0.101492f,
+                                                               0.221921f, 0.0525104f, 0.100082f,
+                                                               0.321308f, 0.235885f, -0.0669677f}};
+
+static std::shared_ptr<Function> check_recurrent_model(const std::string& model,
+                                                       const Outputs& expected_outputs,
+                                                       const std::string& backend)
+{
+    auto function =
+        onnx_import::import_onnx_model(file_util::path_join(SERIALIZED_ZOO, "onnx/" + model));
+
+    Outputs outputs{execute(function, recurrent_inputs, backend)};
+    EXPECT_EQ(outputs.size(), expected_outputs.size());
+    for (std::size_t i = 0; i < expected_outputs.size(); ++i)
+    {
+        EXPECT_TRUE(test::all_close(expected_outputs.at(i), outputs.at(i), 1.0e-5f, 1.0e-5f));
+    }
+    return function;
+}
+
+TEST(onnx, model_gru_fwd)
+{
+    check_recurrent_model("gru_fwd.onnx", gru_fwd_outputs, "INTERPRETER");
+}
+
+TEST(onnx, model_rnn_fwd)
+{
+    check_recurrent_model("rnn_fwd.onnx", rnn_fwd_outputs, "INTERPRETER");
+}
+
+TEST(onnx, model_lstm_fwd)
+{
+    check_recurrent_model("lstm_fwd.onnx", lstm_fwd_outputs, "INTERPRETER");
+}
+
+TEST(onnx, model_lstm_bidirectional)
+{
+    check_recurrent_model("lstm_bidirectional.onnx", lstm_bidirectional_outputs, "INTERPRETER");
+}
+
+TEST(onnx, model_lstm_fwd_sequence_lens)
+{
+    check_recurrent_model(
+        "lstm_fwd_sequence_lens.onnx", lstm_fwd_sequence_lens_outputs, "INTERPRETER");
+}
+
+TEST(onnx, model_lstm_bidirectional_sequence_lens)
+{
+    check_recurrent_model("lstm_bidirectional_sequence_lens.onnx",
+                          lstm_bidirectional_sequence_lens_outputs,
+                          "INTERPRETER");
+}
+
+TEST(onnx, model_rnn_fwd_unsupported_activation)
+{
+    EXPECT_THROW(onnx_import::import_onnx_model(
+                     file_util::path_join(SERIALIZED_ZOO, "onnx/rnn_fwd_relu.onnx")),
+                 ngraph_error);
+}
+
+// Sequences of different lengths would need masking the importer does not do
+TEST(onnx, model_gru_rnn_fwd_unsupported_sequence_lens)
+{
+    EXPECT_THROW(onnx_import::import_onnx_model(
+                     file_util::path_join(SERIALIZED_ZOO, "onnx/gru_fwd_sequence_lens.onnx")),
+                 ngraph_error);
+    EXPECT_THROW(onnx_import::import_onnx_model(
+                     file_util::path_join(SERIALIZED_ZOO, "onnx/rnn_fwd_sequence_lens.onnx")),
+                 ngraph_error);
+}
+
+#ifdef NGRAPH_CPU_ENABLE
+// The imported cells of all timesteps are fused into a single Rnn kernel
+TEST(onnx, model_gru_fwd_cpu_fusion)
+{
+    auto function = check_recurrent_model("gru_fwd.onnx", gru_fwd_outputs, "CPU");
+    EXPECT_EQ(count_ops_of_type<op::Rnn>(function), 1);
+}
+
+TEST(onnx, model_rnn_fwd_cpu_fusion)
+{
+    auto function = check_recurrent_model("rnn_fwd.onnx", rnn_fwd_outputs, "CPU");
+    EXPECT_EQ(count_ops_of_type<op::Rnn>(function), 1);
+}
+
+TEST(onnx, model_lstm_fwd_cpu_fusion)
+{
+    auto function = check_recurrent_model("lstm_fwd.onnx", lstm_fwd_outputs, "CPU");
+    EXPECT_EQ(count_ops_of_type<op::Rnn>(function), 1);
+}
+
+TEST(onnx, model_lstm_bidirectional_cpu_fusion)
+{
+    auto function =
+        check_recurrent_model("lstm_bidirectional.onnx", lstm_bidirectional_outputs, "CPU");
+    ASSERT_EQ(count_ops_of_type<op::Rnn>(function), 1);
+    for (auto node : function->get_ordered_ops())
+    {
+        if (auto rnn = std::dynamic_pointer_cast<op::Rnn>(node))
+        {
+            EXPECT_EQ(rnn->get_direction(), 2);
+        }
+    }
+}
+
+// The masks of the outputs past the end of the sequences become the lengths of the fused Rnn
+TEST(onnx, model_lstm_fwd_sequence_lens_cpu_fusion)
+{
+    auto function = check_recurrent_model(
+        "lstm_fwd_sequence_lens.onnx", lstm_fwd_sequence_lens_outputs, "CPU");
+    ASSERT_EQ(count_ops_of_type<op::Rnn>(function), 1);
+    for (auto node : function->get_ordered_ops())
+    {
+        if (auto rnn = std::dynamic_pointer_cast<op::Rnn>(node))
+        {
+            EXPECT_TRUE(rnn->has_sequence_lengths());
+        }
+    }
+}
+#endif
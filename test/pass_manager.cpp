@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <cstdlib>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -23,6 +25,7 @@
 
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/core_fusion.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "util/test_tools.hpp"
 
@@ -42,6 +45,51 @@ TEST(pass_manager, add)
     EXPECT_TRUE(validate_list(sorted));
 }
 
+TEST(pass_manager, pass_profiles)
+{
+    auto make_function = []() {
+        Shape shape{2, 2};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto zero = make_shared<op::Broadcast>(
+            op::Constant::create(element::f32, Shape{}, {0}), shape, AxisSet{0, 1});
+        return make_shared<Function>(make_shared<op::Maximum>(zero, A), ParameterVector{A});
+    };
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    auto profiles = pass_manager.run_passes(make_function());
+    ASSERT_EQ(profiles.size(), 1);
+    EXPECT_NE(profiles.at(0).name.find("CoreFusion"), string::npos);
+    // Ops are only counted when profiling
+    if (getenv("NGRAPH_PROFILE_PASS_ENABLE") == nullptr)
+    {
+        EXPECT_EQ(profiles.at(0).ops_before, 0);
+        EXPECT_EQ(profiles.at(0).ops_after, 0);
+    }
+
+    pass::Manager counting_pass_manager;
+    counting_pass_manager.register_pass<pass::CoreFusion>();
+    counting_pass_manager.set_pass_profiling(true);
+    profiles = counting_pass_manager.run_passes(make_function());
+    ASSERT_EQ(profiles.size(), 1);
+    // Maximum(Broadcast(Constant), Parameter) is replaced by Relu(Parameter)
+    EXPECT_EQ(profiles.at(0).ops_before, 5);
+    EXPECT_EQ(profiles.at(0).ops_after, 3);
+
+    pass::Manager profiling_pass_manager;
+    profiling_pass_manager.register_pass<pass::CoreFusion>();
+    profiling_pass_manager.set_matcher_profiling(true);
+    profiles = profiling_pass_manager.run_passes(make_function());
+    ASSERT_EQ(profiles.size(), 1);
+    auto relu = find_if(profiles.at(0).matchers.begin(),
+                        profiles.at(0).matchers.end(),
+                        [](const pass::MatcherProfile& m) { return m.name == "CoreFusion.Relu"; });
+    ASSERT_NE(relu, profiles.at(0).matchers.end());
+    EXPECT_EQ(relu->matches, 1);
+    EXPECT_EQ(relu->rewrites, 1);
+    EXPECT_GE(relu->attempts, relu->matches);
+}
+
 TEST(pass_manager, module_add_function)
 {
     // First create "f(A,B,C) = (A+B)*C".
@@ -0,0 +1,125 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/pass/reduce_lowering.hpp"
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/random.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+template <typename T>
+static shared_ptr<Function> make_reduction_function(const element::Type& type)
+{
+    auto A = make_shared<op::Parameter>(type, Shape{});
+    auto B = make_shared<op::Parameter>(type, Shape{});
+    return make_shared<Function>(make_shared<T>(B, A), ParameterVector{A, B});
+}
+
+static void run_reduce_lowering(const shared_ptr<Function>& f)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ReduceLowering>();
+    pass_manager.run_passes(f);
+}
+
+TEST(reduce_lowering, add_with_zero_init)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{2, 3, 4});
+    auto zero = op::Constant::create(element::f32, Shape{}, {0});
+    auto reduce = make_shared<op::Reduce>(
+        param, zero, make_reduction_function<op::Add>(element::f32), AxisSet{0, 2});
+    auto f = make_shared<Function>(reduce, ParameterVector{param});
+    run_reduce_lowering(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Reduce>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Add>(f), 0);
+    auto sum = dynamic_pointer_cast<op::Sum>(f->get_results().at(0)->get_argument(0));
+    ASSERT_NE(sum, nullptr);
+    ASSERT_EQ(sum->get_reduction_axes(), (AxisSet{0, 2}));
+    ASSERT_EQ(sum->get_argument(0), param);
+}
+
+TEST(reduce_lowering, maximum_with_init)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{3, 4});
+    auto init = make_shared<op::Parameter>(element::f32, Shape{});
+    auto reduce = make_shared<op::Reduce>(
+        param, init, make_reduction_function<op::Maximum>(element::f32), AxisSet{1});
+    auto f = make_shared<Function>(reduce, ParameterVector{param, init});
+    auto lowered = clone_function(*f);
+    run_reduce_lowering(lowered);
+
+    ASSERT_EQ(count_ops_of_type<op::Reduce>(lowered), 0);
+    ASSERT_EQ(count_ops_of_type<op::Max>(lowered), 1);
+    ASSERT_EQ(count_ops_of_type<op::Maximum>(lowered), 1);
+
+    vector<vector<float>> args{{1, 7, 3, 4, -1, -5, -2, -3, 9, 0, 2, 1}, {2}};
+    auto expected = execute(f, args, "INTERPRETER");
+    auto actual = execute(lowered, args, "INTERPRETER");
+    EXPECT_EQ((vector<float>{7, 2, 9}), actual.at(0));
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(reduce_lowering, reduce_window_maximum)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{2, 3, 8, 8});
+    auto init = op::Constant::create(element::f32, Shape{}, {-1});
+    auto rf = make_reduction_function<op::Maximum>(element::f32);
+    auto reduce_window =
+        make_shared<op::ReduceWindow>(param, init, rf, Shape{1, 1, 3, 3}, Strides{1, 1, 2, 2});
+    auto f = make_shared<Function>(reduce_window, ParameterVector{param});
+    auto lowered = clone_function(*f);
+    run_reduce_lowering(lowered);
+
+    ASSERT_EQ(count_ops_of_type<op::ReduceWindow>(lowered), 0);
+    auto max_pool = dynamic_pointer_cast<op::MaxPool>(
+        lowered->get_results().at(0)->get_argument(0)->get_argument(0));
+    ASSERT_NE(max_pool, nullptr);
+    ASSERT_EQ(max_pool->get_window_shape(), (Shape{3, 3}));
+    ASSERT_EQ(max_pool->get_window_movement_strides(), (Strides{2, 2}));
+
+    vector<float> input(shape_size(param->get_shape()));
+    test::Uniform<float> rng(-2.0f, 2.0f);
+    rng.initialize(input);
+    vector<vector<float>> args{input};
+    auto expected = execute(f, args, "INTERPRETER");
+    auto actual = execute(lowered, args, "INTERPRETER");
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(reduce_lowering, keep_unrecognized)
+{
+    auto param = make_shared<op::Parameter>(element::boolean, Shape{2, 3});
+    auto k_true = op::Constant::create(element::boolean, Shape{}, vector<char>{1});
+    auto all = make_shared<op::Reduce>(
+        param, k_true, make_reduction_function<op::And>(element::boolean), AxisSet{1});
+
+    // f(x, y) = x * y + x is not a single op
+    auto A = make_shared<op::Parameter>(element::f32, Shape{});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{});
+    auto rf = make_shared<Function>(A * B + A, ParameterVector{A, B});
+    auto fparam = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto init = op::Constant::create(element::f32, Shape{}, {1});
+    auto custom = make_shared<op::Reduce>(fparam, init, rf, AxisSet{0});
+
+    auto f = make_shared<Function>(NodeVector{all, custom}, ParameterVector{param, fparam});
+    run_reduce_lowering(f);
+    ASSERT_EQ(count_ops_of_type<op::Reduce>(f), 2);
+}